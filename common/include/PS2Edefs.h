@@ -89,6 +89,7 @@ void CALLBACK GSclose();
 void CALLBACK GSshutdown();
 
 void CALLBACK GSvsync(int field);
+u32 CALLBACK GSgetGPUTimeUs(void);
 void CALLBACK GSgifTransfer(const u32 *pMem, u32 addr);
 void CALLBACK GSgifTransfer1(u32 *pMem, u32 addr);
 void CALLBACK GSgifTransfer2(u32 *pMem, u32 size);
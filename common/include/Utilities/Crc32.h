@@ -0,0 +1,75 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "Pcsx2Types.h"
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
+
+// CRC-32C (Castagnoli).  Uses the SSE4.2 crc32 instruction when the build
+// targets it, and a plain table otherwise, so hashes are comparable across
+// hosts.  Chain calls by feeding the previous return value back in as crc
+// (start with 0).
+
+inline u32 crc32c_update(u32 crc, const void* data, size_t size)
+{
+	const u8* p = (const u8*)data;
+
+	crc = ~crc;
+
+#ifdef __SSE4_2__
+
+#ifdef __x86_64__
+	u64 crc64 = crc;
+	for (; size >= 8; p += 8, size -= 8)
+		crc64 = _mm_crc32_u64(crc64, *(const u64*)p);
+	crc = (u32)crc64;
+#else
+	for (; size >= 4; p += 4, size -= 4)
+		crc = _mm_crc32_u32(crc, *(const u32*)p);
+#endif
+
+	for (; size; p++, size--)
+		crc = _mm_crc32_u8(crc, *p);
+
+#else
+
+	static u32 table[256];
+	static bool table_built = false;
+
+	if (!table_built)
+	{
+		for (u32 i = 0; i < 256; i++)
+		{
+			u32 c = i;
+			for (int k = 0; k < 8; k++)
+				c = (c >> 1) ^ ((c & 1) ? 0x82F63B78u : 0);
+			table[i] = c;
+		}
+		table_built = true;
+	}
+
+	for (; size; p++, size--)
+		crc = table[(crc ^ *p) & 0xff] ^ (crc >> 8);
+
+#endif
+
+	return ~crc;
+}
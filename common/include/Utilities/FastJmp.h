@@ -26,6 +26,9 @@ struct fastjmp_buf
 	static constexpr std::size_t BUF_SIZE = 64;
 #elif defined(_M_X86_32)
 	static constexpr std::size_t BUF_SIZE = 24;
+#elif defined(__aarch64__)
+	// lr, sp, x19-x29, d8-d15
+	static constexpr std::size_t BUF_SIZE = 168;
 #else
 #error Unknown architecture.
 #endif
@@ -125,6 +125,41 @@ extern void SpinWait();
 // sleeps the current thread for the given number of milliseconds.
 extern void Sleep(int ms);
 
+// --------------------------------------------------------------------------------------
+//  NUMA-aware thread placement
+// --------------------------------------------------------------------------------------
+// On multi-socket hosts the emulation threads (EE, MTGS, MTVU, GS workers) land on
+// arbitrary nodes, splitting the MTGS ringbuffer and GS local memory across sockets.
+// Selecting a preferred node groups all of them onto one node's processors; since the
+// OS commits pages on first touch, the reserves those threads populate become
+// node-local as a side effect, without any explicit NUMA allocation API.
+
+// Selects the node emulation threads should be grouped on, or -1 to disable placement
+// (threads stay wherever the scheduler puts them).  Takes effect for threads started
+// afterward; call before the core threads spin up.
+extern void SetPreferredNumaNode(int node);
+extern int GetPreferredNumaNode();
+
+// Pins the calling thread to the preferred node's processors.  No-op when placement is
+// disabled, the node does not exist, or the platform has no affinity API.  pxThread
+// applies this automatically on startup; threads created directly through std::thread
+// should call it themselves at the top of their thread proc.
+extern void SetNumaAffinityForSelf();
+
+// --------------------------------------------------------------------------------------
+//  Worker thread budgeting
+// --------------------------------------------------------------------------------------
+// The persistent emulation threads (EE core, MTGS, MTVU) each keep a processor busy
+// for the life of a session.  The auxiliary worker pools (software rasterizers,
+// texture conversion, savestate memory copies) are sized independently of each other,
+// so without a common budget they collectively oversubscribe small hosts and spend
+// their time preempting the latency-critical emulation threads instead of helping.
+
+// Returns how many logical processors are left for worker pools once the persistent
+// emulation threads are accounted for.  Always at least 1; pools apply their own
+// smaller caps on top of this.
+extern int GetWorkerThreadBudget();
+
 class Semaphore
 {
 protected:
@@ -43,4 +43,10 @@ __forceinline void Threading::SpinWait()
     // performance hint and isn't required).
     __asm__("pause");
 }
+
+// Darwin offers no thread-to-processor binding API (thread_policy_set affinity tags
+// are hints only, and Apple hardware is single-node anyway), so placement is a no-op.
+void Threading::SetNumaAffinityForSelf()
+{
+}
 #endif
@@ -87,6 +87,51 @@ asm(
 	jmp *%edx
 )");
 
+#elif defined(__aarch64__)
+
+// AAPCS64: x19-x28, x29 (fp), x30 (lr), sp and the low halves of v8-v15 are
+// callee-saved.  No return-address-on-stack fixup is needed here since the
+// link register holds it, so restoring lr/sp and ret-ing replays the original
+// return from fastjmp_set with the caller's ret value in w0.
+asm(
+	"\t.global " PREFIX "fastjmp_set\n"
+	"\t.global " PREFIX "fastjmp_jmp\n"
+	"\t.text\n"
+	"\t" PREFIX "fastjmp_set:" R"(
+	str x30, [x0]
+	mov x1, sp
+	str x1, [x0, #8]
+	stp x19, x20, [x0, #16]
+	stp x21, x22, [x0, #32]
+	stp x23, x24, [x0, #48]
+	stp x25, x26, [x0, #64]
+	stp x27, x28, [x0, #80]
+	str x29, [x0, #96]
+	stp d8, d9, [x0, #104]
+	stp d10, d11, [x0, #120]
+	stp d12, d13, [x0, #136]
+	stp d14, d15, [x0, #152]
+	mov w0, wzr
+	ret
+)"
+	"\t" PREFIX "fastjmp_jmp:" R"(
+	ldr x30, [x0]
+	ldr x2, [x0, #8]
+	mov sp, x2
+	ldp x19, x20, [x0, #16]
+	ldp x21, x22, [x0, #32]
+	ldp x23, x24, [x0, #48]
+	ldp x25, x26, [x0, #64]
+	ldp x27, x28, [x0, #80]
+	ldr x29, [x0, #96]
+	ldp d8, d9, [x0, #104]
+	ldp d10, d11, [x0, #120]
+	ldp d12, d13, [x0, #136]
+	ldp d14, d15, [x0, #152]
+	mov w0, w1
+	ret
+)");
+
 #endif
 
 #endif // __WIN32
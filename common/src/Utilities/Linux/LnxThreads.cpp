@@ -50,4 +50,64 @@ __forceinline void Threading::SpinWait()
     // performance hint and isn't required).
     __asm__("pause");
 }
+
+// Builds the processor set of the given NUMA node from sysfs.  The cpulist format
+// is a comma-separated list of ranges, e.g. "0-7,16-23".  Returns false when the
+// node does not exist (single-node hosts have only node0).
+static bool GetNumaNodeCpuSet(int node, cpu_set_t &cpuset)
+{
+#if defined(__linux__)
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return false;
+
+    char list[256] = {0};
+    const bool ok = fgets(list, sizeof(list), fp) != NULL;
+    fclose(fp);
+
+    if (!ok)
+        return false;
+
+    CPU_ZERO(&cpuset);
+
+    const char *p = list;
+    while (*p) {
+        char *end;
+        long first = strtol(p, &end, 10);
+        if (end == p)
+            break;
+
+        long last = first;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+        }
+
+        for (long cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+            CPU_SET(cpu, &cpuset);
+
+        if (*end != ',')
+            break;
+        p = end + 1;
+    }
+
+    return CPU_COUNT(&cpuset) > 0;
+#else
+    return false;
+#endif
+}
+
+void Threading::SetNumaAffinityForSelf()
+{
+    const int node = GetPreferredNumaNode();
+    if (node < 0)
+        return;
+
+    cpu_set_t cpuset;
+    if (GetNumaNodeCpuSet(node, cpuset))
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+}
 #endif
@@ -24,6 +24,10 @@
 #include "ThreadingInternal.h"
 #include "EventSource.inl"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 using namespace Threading;
 
 template class EventSource<EventListener_Thread>;
@@ -45,6 +49,30 @@ public:
     }
 };
 
+// The NUMA node emulation threads are grouped on, or -1 for no placement.  Written
+// once at startup before the core threads spin up; read at every thread start by
+// SetNumaAffinityForSelf (platform-specific, in LnxThreads/WinThreads).
+static std::atomic<int> s_preferred_numa_node(-1);
+
+void Threading::SetPreferredNumaNode(int node)
+{
+    s_preferred_numa_node = node;
+}
+
+int Threading::GetPreferredNumaNode()
+{
+    return s_preferred_numa_node;
+}
+
+// EE core, MTGS and MTVU run near-saturated loops for the whole session; worker
+// pools should only claim the processors left over.  MTVU may be disabled, but
+// reserving for it unconditionally just errs on the side of the emulation threads.
+int Threading::GetWorkerThreadBudget()
+{
+    const int cores = (int)std::thread::hardware_concurrency();
+    return std::max(1, cores - 3);
+}
+
 static pthread_key_t curthread_key = 0;
 static s32 total_key_count = 0;
 
@@ -492,6 +520,10 @@ void Threading::pxThread::OnStartInThread()
 {
     m_detached = false;
     m_running = true;
+
+    // Group this thread with the rest of the emulation threads when a NUMA
+    // node preference has been configured (no-op otherwise).
+    SetNumaAffinityForSelf();
 }
 
 void Threading::pxThread::_internal_execute()
@@ -35,4 +35,19 @@ __fi void Threading::SpinWait()
 {
     _mm_pause();
 }
+
+void Threading::SetNumaAffinityForSelf()
+{
+    const int node = GetPreferredNumaNode();
+    if (node < 0)
+        return;
+
+    ULONG highest = 0;
+    if (!GetNumaHighestNodeNumber(&highest) || (ULONG)node > highest)
+        return;
+
+    GROUP_AFFINITY affinity;
+    if (GetNumaNodeProcessorMaskEx((USHORT)node, &affinity) && affinity.Mask != 0)
+        SetThreadGroupAffinity(GetCurrentThread(), &affinity, NULL);
+}
 #endif
@@ -7,5 +7,6 @@ void Init();
 void Update();
 void Shutdown();
 void RumbleEnabled(bool enabled, int percent);
+void LateSamplingEnabled(bool enabled);
 void setRumbleLevel(int percent);
 }
@@ -0,0 +1,212 @@
+
+#include "input_trace.h"
+#include "libretro.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+extern retro_log_printf_t log_cb;
+
+namespace InputTrace {
+
+// File layout (little endian):
+//   header : char magic[4] = "P2IT", u32 version = 1, u32 record_bytes,
+//            u8 rtc[8]
+//   record : s16 button[2][16], s16 axis[2][4]   (one per retro_run)
+//
+// rtc is second/minute/hour/day/month/year plus two spare bytes, written
+// back into the header when CDVD resets; record_bytes keeps old readers
+// working if the record ever grows.
+
+enum Mode
+{
+	MODE_OFF,
+	MODE_RECORD,
+	MODE_REPLAY
+};
+
+static const u32 TRACE_VERSION = 1;
+static const u32 RECORD_BYTES = (2 * 16 + 2 * 4) * sizeof(s16);
+static const long HEADER_RTC_OFFSET = 12;
+
+static Mode s_mode = MODE_OFF;
+static bool s_init = false;
+static FILE* s_file = NULL;
+static u8 s_rtc[8];
+static u32 s_frames = 0;
+static bool s_exhausted = false;
+
+// Host time between consecutive replayed frames, for the percentile report.
+static std::vector<u32> s_frame_us;
+static std::chrono::steady_clock::time_point s_prev_time;
+static bool s_have_prev_time = false;
+
+static void Init()
+{
+	s_init = true;
+
+	const char* play = getenv("PCSX2_INPUT_TRACE_REPLAY");
+	const char* rec = getenv("PCSX2_INPUT_TRACE_RECORD");
+
+	if (play)
+	{
+		s_file = fopen(play, "rb");
+		if (!s_file)
+		{
+			log_cb(RETRO_LOG_ERROR, "InputTrace: cannot open %s for replay\n", play);
+			return;
+		}
+
+		char magic[4];
+		u32 version = 0, record_bytes = 0;
+		if (fread(magic, 1, 4, s_file) != 4 || memcmp(magic, "P2IT", 4) != 0 ||
+			fread(&version, 4, 1, s_file) != 1 || version != TRACE_VERSION ||
+			fread(&record_bytes, 4, 1, s_file) != 1 || record_bytes != RECORD_BYTES ||
+			fread(s_rtc, 1, 8, s_file) != 8)
+		{
+			log_cb(RETRO_LOG_ERROR, "InputTrace: %s is not a version %u trace\n", play, TRACE_VERSION);
+			fclose(s_file);
+			s_file = NULL;
+			return;
+		}
+
+		s_mode = MODE_REPLAY;
+		log_cb(RETRO_LOG_INFO, "InputTrace: replaying %s\n", play);
+	}
+	else if (rec)
+	{
+		s_file = fopen(rec, "wb");
+		if (!s_file)
+		{
+			log_cb(RETRO_LOG_ERROR, "InputTrace: cannot open %s for recording\n", rec);
+			return;
+		}
+
+		fwrite("P2IT", 1, 4, s_file);
+		fwrite(&TRACE_VERSION, 4, 1, s_file);
+		const u32 record_bytes = RECORD_BYTES;
+		fwrite(&record_bytes, 4, 1, s_file);
+		memset(s_rtc, 0, sizeof(s_rtc));
+		fwrite(s_rtc, 1, 8, s_file);
+
+		s_mode = MODE_RECORD;
+		log_cb(RETRO_LOG_INFO, "InputTrace: recording to %s\n", rec);
+	}
+}
+
+bool IsRecording()
+{
+	if (!s_init)
+		Init();
+	return s_mode == MODE_RECORD;
+}
+
+bool IsReplaying()
+{
+	if (!s_init)
+		Init();
+	return s_mode == MODE_REPLAY;
+}
+
+static u32 Percentile(const std::vector<u32>& sorted, int pct)
+{
+	size_t i = (sorted.size() - 1) * pct / 100;
+	return sorted[i];
+}
+
+static void ReportReplayTimings()
+{
+	if (s_frame_us.empty())
+		return;
+
+	std::vector<u32> sorted(s_frame_us);
+	std::sort(sorted.begin(), sorted.end());
+
+	u64 total = 0;
+	for (u32 us : s_frame_us)
+		total += us;
+
+	log_cb(RETRO_LOG_INFO,
+		"InputTrace: replayed %u frames, frame time avg %.2f ms, p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+		s_frames,
+		total / 1000.0 / s_frame_us.size(),
+		Percentile(sorted, 50) / 1000.0,
+		Percentile(sorted, 90) / 1000.0,
+		Percentile(sorted, 99) / 1000.0,
+		sorted.back() / 1000.0);
+}
+
+void CaptureFrame(s16 button[2][16], s16 axis[2][4])
+{
+	if (!s_init)
+		Init();
+
+	if (s_mode == MODE_OFF)
+		return;
+
+	if (s_mode == MODE_RECORD)
+	{
+		fwrite(button, 1, 2 * 16 * sizeof(s16), s_file);
+		fwrite(axis, 1, 2 * 4 * sizeof(s16), s_file);
+
+		// The file is never explicitly closed (the frontend just unloads the
+		// core), so push the tail out every second or so.
+		if ((++s_frames & 63) == 0)
+			fflush(s_file);
+		return;
+	}
+
+	// Replay: one frame per call; live input takes over when the trace ends.
+	if (s_exhausted)
+		return;
+
+	if (fread(button, 1, 2 * 16 * sizeof(s16), s_file) != 2 * 16 * sizeof(s16) ||
+		fread(axis, 1, 2 * 4 * sizeof(s16), s_file) != 2 * 4 * sizeof(s16))
+	{
+		s_exhausted = true;
+		ReportReplayTimings();
+		return;
+	}
+
+	s_frames++;
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (s_have_prev_time)
+		s_frame_us.push_back((u32)std::chrono::duration_cast<std::chrono::microseconds>(now - s_prev_time).count());
+	s_prev_time = now;
+	s_have_prev_time = true;
+}
+
+void CaptureRTC(u8 rtc[6])
+{
+	if (!s_init)
+		Init();
+
+	if (s_mode == MODE_RECORD)
+	{
+		memcpy(s_rtc, rtc, 6);
+		long pos = ftell(s_file);
+		fseek(s_file, HEADER_RTC_OFFSET, SEEK_SET);
+		fwrite(s_rtc, 1, 8, s_file);
+		fseek(s_file, pos, SEEK_SET);
+	}
+	else if (s_mode == MODE_REPLAY)
+	{
+		// An all-zero header means the recording ended before CDVD reset;
+		// keep the wall clock in that case.
+		for (int i = 0; i < 6; i++)
+		{
+			if (s_rtc[i])
+			{
+				memcpy(rtc, s_rtc, 6);
+				break;
+			}
+		}
+	}
+}
+
+} // namespace InputTrace
@@ -0,0 +1,35 @@
+/*
+* Deterministic input trace record/replay.
+* Captures the nondeterministic inputs of a session - the per-frame pad
+* state sampled by the PAD plugin and the RTC snapshot CDVD takes at
+* reset - into a compact binary trace. Replaying the trace against the
+* same content (with a savestate as starting point) reproduces the
+* workload, which makes per-frame timings comparable across builds;
+* replay logs frame time percentiles when the trace runs out.
+*
+* Activated by environment variable so automated runs need no frontend
+* support: PCSX2_INPUT_TRACE_RECORD=<path> records a session,
+* PCSX2_INPUT_TRACE_REPLAY=<path> replays one. Running headless is the
+* frontend's job (null video/audio drivers); the core stays a normal
+* libretro build.
+*/
+
+#pragma once
+
+#include "Pcsx2Types.h"
+
+namespace InputTrace {
+	bool IsRecording();
+	bool IsReplaying();
+
+	// Called once per retro_run with the sampled pad state: 16 button
+	// pressure values and 4 analog axes per pad. Recording appends a frame
+	// record; replay overwrites the arrays with the recorded frame.
+	void CaptureFrame(s16 button[2][16], s16 axis[2][4]);
+
+	// Called from cdvdReset with the wall-clock RTC values (second, minute,
+	// hour, day, month, year). Recording stores them in the trace header;
+	// replay substitutes the recorded ones so the guest clock matches the
+	// original run.
+	void CaptureRTC(u8 rtc[6]);
+}
@@ -145,6 +145,155 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      BOOL_PCSX2_OPT_KERNEL_BOOT_SNAPSHOT,
+      "System: Fast Boot Kernel Snapshot",
+      "Fast Boot Kernel Snapshot",
+      "With Fast Boot enabled, captures the console state right after BIOS kernel init once per BIOS, then restores it on later launches so games start in under a second instead of re-emulating the kernel boot. The snapshot is stored in the savestate folder and invalidated automatically when the BIOS or savestate format changes. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
+   {
+      BOOL_PCSX2_OPT_REWIND_DELTA,
+      "System: Delta Rewind States",
+      "Delta Rewind States",
+      "Keep savestates in a fixed-size internal ring as deltas against the previous state, and hand the frontend a small token instead of a full state. Shrinks the memory needed for rewind from several GB to the ring budget, but states saved this way can only be loaded within the same session. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
+   {
+      INT_PCSX2_OPT_REWIND_BUFFER_SIZE,
+      "System: Delta Rewind Buffer Size (MB)",
+      "Delta Rewind Buffer Size (MB)",
+      "Memory budget for the delta rewind ring. Older states are evicted once the budget is reached. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"128", NULL},
+         {"256", NULL},
+         {"384", NULL},
+         {"512", NULL},
+         {"768", NULL},
+         {"1024", NULL},
+         {NULL, NULL},
+      },
+      "256"
+   },
+   {
+      BOOL_PCSX2_OPT_IPU_PIPELINE,
+      "System: Threaded FMV Decode (IPU Pipeline)",
+      "Threaded FMV Decode (IPU Pipeline)",
+      "Run the inverse DCT stage of MPEG2 video decode on a worker thread, overlapping it with the bitstream decode on the emulated EE thread. Reduces the EE-thread cost of FMV playback. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
+   {
+      BOOL_PCSX2_OPT_PERF_OVERLAY,
+      "System: Performance Statistics Overlay",
+      "Performance Statistics Overlay",
+      "Periodically show the average time per frame spent in each emulated subsystem (EE, VU, GS, SPU2, CDVD) as an on-screen notification. A JSON report with per-frame histograms is written next to the savestates when the content is unloaded.",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
+   {
+      BOOL_PCSX2_OPT_PERF_TRACE,
+      "System: Performance Trace File",
+      "Performance Trace File",
+      "Record one binary record per frame (host frame time, vsync drift and per-subsystem times) to a .perf.trace file next to the savestates. The overhead is a single buffered write per frame, so it can stay enabled for whole sessions. See pcsx2/PerfStats.h for the file format.",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
+   {
+      BOOL_PCSX2_OPT_DETERMINISTIC,
+      "System: Deterministic Mode (Netplay)",
+      "Deterministic Mode (Netplay)",
+      "Make execution bit-identical across machines given identical inputs: forces the threaded VU1 speedhack off, seeds the emulated clock from a fixed date instead of the host clock, and logs a running hash of the machine state every 60 frames so diverging peers can be diffed. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
+   {
+      INT_PCSX2_OPT_CDVD_CACHE_SIZE,
+      "System: CDVD Image Cache Size (MB)",
+      "CDVD Image Cache Size (MB)",
+      "RAM budget for the disc image block cache with adaptive readahead. Frequently read sectors stay resident and sequential streams (FMVs) are prefetched ahead of the game, which hides storage latency on slow or network-mounted image libraries. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"0", "disabled"},
+         {"128", NULL},
+         {"256", NULL},
+         {"512", NULL},
+         {NULL, NULL},
+      },
+      "256"
+   },
+   {
+      INT_PCSX2_OPT_NUMA_NODE,
+      "System: NUMA Node Placement",
+      "NUMA Node Placement",
+      "On multi-socket hosts, groups all emulation threads (EE, GS, VU, workers) onto one NUMA node so their shared buffers stay socket-local. Useful when running several core instances per machine: give each instance its own node. Leave disabled on single-socket machines. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"-1", "disabled"},
+         {"0", "Node 0"},
+         {"1", "Node 1"},
+         {"2", "Node 2"},
+         {"3", "Node 3"},
+         {NULL, NULL},
+      },
+      "-1"
+   },
+   {
+      BOOL_PCSX2_OPT_EE_CACHE,
+      "System: EE Data Cache Emulation",
+      "EE Data Cache Emulation",
+      "Emulate the EE data cache for TLB pages mapped as cached. Needed by a handful of titles that read through the cache; only those pages pay the tag check, so other code is unaffected. Most effective combined with accurate (interpreter) EE settings. (Content restart required)",
+      NULL,
+      "system_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
    {
       BOOL_PCSX2_OPT_BOOT_TO_BIOS,
       "System: Boot to BIOS",
@@ -476,6 +625,20 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "1"
    },
+   {
+      BOOL_PCSX2_OPT_AUTO_FRAMESKIP,
+      "Video: Adaptive Frame Pacing (Auto Frameskip)",
+      "Adaptive Frame Pacing (Auto Frameskip)",
+      "Drops rendered frames automatically when the frontend's audio buffer runs low, so transient emulation spikes cause a few skipped draws instead of audio crackling. Emulation itself keeps running at full speed while frames are dropped. Requires a frontend that reports audio buffer status.",
+      NULL,
+      "video_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
    {
       BOOL_PCSX2_OPT_GAMEPAD_RUMBLE_ENABLE,
       "Gamepad: Enable Rumble",
@@ -490,6 +653,20 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "enabled"
    },
+   {
+      BOOL_PCSX2_OPT_GAMEPAD_LATE_POLL,
+      "Gamepad: Late Input Polling",
+      "Late Input Polling",
+      "Defers input polling from the start of the frame to the moment the game actually queries the pad over SIO, shaving up to a frame of input latency. May misbehave with frontend input drivers that require polling from the main thread.",
+      NULL,
+      "gamepad_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
    {
       INT_PCSX2_OPT_GAMEPAD_RUMBLE_FORCE,
       "Gamepad: Rumble Intensity",
@@ -953,6 +1130,21 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      BOOL_PCSX2_OPT_USERHACK_OVERDRAW_SKIP,
+      "Hack: Overdraw Elimination",
+      "Overdraw Elimination",
+      "Skip draws whose output was entirely overwritten before being sampled on the previous frame. Helps GPU bound games at high internal resolutions with heavy full-screen overdraw. \
+      \nSpeculative: may cause one-frame glitches when a scene changes.",
+      NULL,
+      "hacks_options",
+      {
+         {"disabled", NULL},
+         {"enabled", NULL},
+         {NULL, NULL},
+      },
+      "disabled"
+   },
    {
       INT_PCSX2_OPT_USERHACK_TEXTURE_OFFSET_X_HUNDREDS,
       "Hack: Texture Offset X - Hundreds",
@@ -26,8 +26,18 @@
 #include "svnrev.h"
 #include "disk_control.h"
 #include "SPU2/Global.h"
+#include "SPU2/spu2.h"
+#include "PAD/PAD.h"
 #include "ps2/BiosTools.h"
 #include "memcard_retro.h"
+#include "SaveState.h"
+#include "state_rewind.h"
+#include "PerfStats.h"
+#include "PathDefs.h"
+#include "Elfheader.h"
+#include "IPU/IPU_Pipeline.h"
+#include "CDVD/CachedFileReader.h"
+#include "Cache.h"
 
 
 
@@ -56,12 +66,19 @@ static struct retro_perf_callback perf_cb;
 static bool libretro_supports_option_categories = false;
 static bool init_failed = false;
 int option_upscale_mult = 1;
+// Multiplier the frontend framebuffer was sized for at load time; runtime
+// changes above it would overflow the av_info geometry, so they are clamped.
+static int option_upscale_mult_max = 1;
 int option_pad_left_deadzone = 0;
 int option_pad_right_deadzone = 0;
 bool option_palette_conversion = false;
 bool hack_fb_conversion = false;
 bool hack_AutoFlush = false;
 bool hack_fast_invalidation = false;
+static bool option_perf_overlay = false;
+static bool option_perf_trace = false;
+static bool perf_trace_running = false;
+static bool option_auto_frameskip = false;
 
 std::string sel_bios_path = "";
 retro_environment_t environ_cb;
@@ -315,10 +332,21 @@ void retro_init(void)
 	// start init some core settings
 
 	option_upscale_mult = option_value(INT_PCSX2_OPT_UPSCALE_MULTIPLIER, KeyOptionInt::return_type);
+	option_upscale_mult_max = option_upscale_mult;
 	option_palette_conversion = option_value(BOOL_PCSX2_OPT_PALETTE_CONVERSION, KeyOptionBool::return_type);
 	hack_fb_conversion = option_value(BOOL_PCSX2_OPT_USERHACK_FB_CONVERSION, KeyOptionBool::return_type);
 	hack_AutoFlush = option_value(BOOL_PCSX2_OPT_USERHACK_AUTO_FLUSH, KeyOptionBool::return_type);
 	hack_fast_invalidation = option_value(BOOL_PCSX2_OPT_USERHACK_FAST_INVALIDATION, KeyOptionBool::return_type);
+	option_perf_overlay = option_value(BOOL_PCSX2_OPT_PERF_OVERLAY, KeyOptionBool::return_type);
+	option_perf_trace = option_value(BOOL_PCSX2_OPT_PERF_TRACE, KeyOptionBool::return_type);
+	option_auto_frameskip = option_value(BOOL_PCSX2_OPT_AUTO_FRAMESKIP, KeyOptionBool::return_type);
+	IpuPipeline::Enable = option_value(BOOL_PCSX2_OPT_IPU_PIPELINE, KeyOptionBool::return_type);
+	CachedFileReader::SetCacheSize(option_value(INT_PCSX2_OPT_CDVD_CACHE_SIZE, KeyOptionInt::return_type));
+	// Must be set before the core threads spin up so they start on the right node.
+	Threading::SetPreferredNumaNode(option_value(INT_PCSX2_OPT_NUMA_NODE, KeyOptionInt::return_type));
+	g_eeCacheEnable = option_value(BOOL_PCSX2_OPT_EE_CACHE, KeyOptionBool::return_type);
+	g_KernelBootSnapshotEnable = option_value(BOOL_PCSX2_OPT_KERNEL_BOOT_SNAPSHOT, KeyOptionBool::return_type);
+	g_DeterministicMode = option_value(BOOL_PCSX2_OPT_DETERMINISTIC, KeyOptionBool::return_type);
 
 	wxFileName f_bios;
 	f_bios.Assign(option_value(STRING_PCSX2_OPT_BIOS, KeyOptionString::return_type));
@@ -464,7 +492,7 @@ void retro_get_system_info(retro_system_info* info)
 #endif
 
 	info->library_name = "pcsx2 (alpha)";
-	info->valid_extensions = "elf|iso|ciso|chd|cso|cue|bin|m3u";
+	info->valid_extensions = "elf|iso|ciso|chd|cso|cue|bin|m3u|xz";
 	info->need_fullpath = true;
 	info->block_extract = true;
 }
@@ -825,6 +853,7 @@ bool retro_load_game(const struct retro_game_info* game)
 			option_value(BOOL_PCSX2_OPT_GAMEPAD_RUMBLE_ENABLE, KeyOptionBool::return_type),
 			option_value(INT_PCSX2_OPT_GAMEPAD_RUMBLE_FORCE, KeyOptionInt::return_type)
 			);
+	Input::LateSamplingEnabled(option_value(BOOL_PCSX2_OPT_GAMEPAD_LATE_POLL, KeyOptionBool::return_type));
 
 	retro_hw_context_type context_type = RETRO_HW_CONTEXT_OPENGL;
 	const char* option_renderer = option_value(STRING_PCSX2_OPT_RENDERER, KeyOptionString::return_type);
@@ -860,6 +889,21 @@ bool retro_load_game_special(unsigned game_type, const struct retro_game_info* i
 
 void retro_unload_game(void)
 {
+	if (option_perf_overlay)
+	{
+		wxString serialName(DiscSerial);
+		if (serialName.IsEmpty())
+			serialName = L"BIOS";
+		wxString perf_path = (g_Conf->Folders.Savestates +
+			pxsFmt(L"%s (%08X).perf.json", WX_STR(serialName), ElfCRC)).GetFullPath();
+		if (PerfStats::ExportJson(perf_path))
+			log_cb(RETRO_LOG_INFO, "Performance report written to %s\n", (const char*)perf_path.ToUTF8());
+	}
+	PerfStats::TraceStop();
+	perf_trace_running = false;
+	PerfStats::Reset();
+	IpuPipeline::Shutdown();
+
 	//	GetMTGS().FinishTaskInThread();
 	//		GetMTGS().CloseGS();
 	GetMTGS().FinishTaskInThread();
@@ -873,6 +917,109 @@ void retro_unload_game(void)
 }
 
 
+// --------------------------------------------------------------------------------------
+//  Adaptive frame pacing
+// --------------------------------------------------------------------------------------
+// The frontend owns real-time pacing in libretro, so the core can't stretch vsync
+// timing itself; what it *can* do is trade rendered frames for audio continuity when a
+// transient EE spike puts the frontend's audio buffer at risk.  The frontend reports
+// buffer occupancy right before every retro_run via the audio-buffer-status callback;
+// a short moving average of that occupancy drives a hysteresis switch on the existing
+// gsFrameSkip machinery.  While catching up, emulation still runs every frame (SPU2
+// keeps producing samples), only GS draws are dropped, alternating 1-on/1-off so the
+// picture stays alive.
+
+static bool pacing_cb_registered = false;
+static bool pacing_status_valid = false;
+static unsigned pacing_occupancy = 100;
+static bool pacing_underrun_likely = false;
+static float pacing_occupancy_avg = 100.0f;
+static bool pacing_skip_active = false;
+
+// The user-configured frameskip settings, so they can be restored when the
+// buffer has refilled (including a manual frameskip setup, which the catch-up
+// mode temporarily overrides).
+static bool pacing_user_valid = false;
+static bool pacing_user_skip_enable = false;
+static int pacing_user_frames_to_draw = 1;
+static int pacing_user_frames_to_skip = 1;
+
+static void pacing_note_user_frameskip(void)
+{
+	pacing_user_skip_enable    = EmuConfig.GS.FrameSkipEnable;
+	pacing_user_frames_to_draw = EmuConfig.GS.FramesToDraw;
+	pacing_user_frames_to_skip = EmuConfig.GS.FramesToSkip;
+	pacing_user_valid = true;
+}
+
+static void audio_buffer_status_cb(bool active, unsigned occupancy, bool underrun_likely)
+{
+	pacing_status_valid = active;
+	pacing_occupancy = occupancy;
+	pacing_underrun_likely = underrun_likely;
+}
+
+static void update_audio_buffer_status_cb(void)
+{
+	if (option_auto_frameskip == pacing_cb_registered)
+		return;
+
+	retro_audio_buffer_status_callback cb = {audio_buffer_status_cb};
+	if (environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK,
+			option_auto_frameskip ? &cb : NULL))
+		pacing_cb_registered = option_auto_frameskip;
+
+	if (!option_auto_frameskip)
+	{
+		pacing_status_valid = false;
+		pacing_occupancy_avg = 100.0f;
+
+		if (pacing_skip_active && pacing_user_valid)
+		{
+			EmuConfig.GS.FrameSkipEnable = pacing_user_skip_enable;
+			EmuConfig.GS.FramesToDraw    = pacing_user_frames_to_draw;
+			EmuConfig.GS.FramesToSkip    = pacing_user_frames_to_skip;
+		}
+		pacing_skip_active = false;
+	}
+}
+
+static void apply_adaptive_pacing(void)
+{
+	if (!option_auto_frameskip || !pacing_status_valid)
+		return;
+
+	if (!pacing_user_valid)
+		pacing_note_user_frameskip();
+
+	// Short moving average: reacts to a spike within a few frames but ignores
+	// the per-frame jitter of the frontend's resampler.
+	pacing_occupancy_avg += 0.2f * ((float)pacing_occupancy - pacing_occupancy_avg);
+
+	// Hysteresis: start dropping draws when the buffer falls under a third,
+	// keep dropping until it has refilled past two thirds.  The frontend's
+	// own underrun prediction short-circuits the average on a sharp spike.
+	if (!pacing_skip_active)
+	{
+		if (pacing_underrun_likely || pacing_occupancy_avg < 33.0f)
+			pacing_skip_active = true;
+	}
+	else if (!pacing_underrun_likely && pacing_occupancy_avg > 66.0f)
+	{
+		pacing_skip_active = false;
+		EmuConfig.GS.FrameSkipEnable = pacing_user_skip_enable;
+		EmuConfig.GS.FramesToDraw    = pacing_user_frames_to_draw;
+		EmuConfig.GS.FramesToSkip    = pacing_user_frames_to_skip;
+	}
+
+	if (pacing_skip_active)
+	{
+		EmuConfig.GS.FrameSkipEnable = true;
+		EmuConfig.GS.FramesToDraw = 1;
+		EmuConfig.GS.FramesToSkip = 1;
+	}
+}
+
 void retro_run(void)
 {
 	bool updated = false;
@@ -882,17 +1029,53 @@ void retro_run(void)
 		EmuConfig.GS.FrameSkipEnable = option_value(BOOL_PCSX2_OPT_FRAMESKIP, KeyOptionBool::return_type);
 		EmuConfig.GS.FramesToDraw = option_value(INT_PCSX2_OPT_FRAMES_TO_DRAW, KeyOptionInt::return_type);
 		EmuConfig.GS.FramesToSkip = option_value(INT_PCSX2_OPT_FRAMES_TO_SKIP, KeyOptionInt::return_type);
+		pacing_note_user_frameskip();
+		option_auto_frameskip = option_value(BOOL_PCSX2_OPT_AUTO_FRAMESKIP, KeyOptionBool::return_type);
 		EmuConfig.GS.VsyncQueueSize = option_value(INT_PCSX2_OPT_VSYNC_MTGS_QUEUE, KeyOptionInt::return_type);
 		//GSUpdateOptions();
 		Input::RumbleEnabled(
 			option_value(BOOL_PCSX2_OPT_GAMEPAD_RUMBLE_ENABLE, KeyOptionBool::return_type),
 			option_value(INT_PCSX2_OPT_GAMEPAD_RUMBLE_FORCE, KeyOptionInt::return_type)
 		);
+		Input::LateSamplingEnabled(option_value(BOOL_PCSX2_OPT_GAMEPAD_LATE_POLL, KeyOptionBool::return_type));
 		option_pad_left_deadzone = option_value(INT_PCSX2_OPT_GAMEPAD_L_DEADZONE, KeyOptionInt::return_type);
 		option_pad_right_deadzone = option_value(INT_PCSX2_OPT_GAMEPAD_R_DEADZONE, KeyOptionInt::return_type);
+		{
+			// Runtime internal-resolution switching; the HW renderer picks the
+			// new value up at the next vsync. Only downwards from the load-time
+			// multiplier, since the frontend framebuffer cannot grow.
+			int upscale = option_value(INT_PCSX2_OPT_UPSCALE_MULTIPLIER, KeyOptionInt::return_type);
+			if (upscale >= 1 && upscale <= option_upscale_mult_max)
+				option_upscale_mult = upscale;
+		}
+		option_perf_overlay = option_value(BOOL_PCSX2_OPT_PERF_OVERLAY, KeyOptionBool::return_type);
+		option_perf_trace = option_value(BOOL_PCSX2_OPT_PERF_TRACE, KeyOptionBool::return_type);
 
 	}
 
+	// The trace starts lazily here rather than at load time so the serial and
+	// CRC naming the file are valid, and so toggling the option mid-session
+	// works both ways.
+	if (option_perf_trace && !perf_trace_running)
+	{
+		wxString serialName(DiscSerial);
+		if (serialName.IsEmpty())
+			serialName = L"BIOS";
+		wxString trace_path = (g_Conf->Folders.Savestates +
+			pxsFmt(L"%s (%08X).perf.trace", WX_STR(serialName), ElfCRC)).GetFullPath();
+		if (PerfStats::TraceStart(trace_path))
+			log_cb(RETRO_LOG_INFO, "Performance trace started: %s\n", (const char*)trace_path.ToUTF8());
+		perf_trace_running = true;
+	}
+	else if (!option_perf_trace && perf_trace_running)
+	{
+		PerfStats::TraceStop();
+		perf_trace_running = false;
+	}
+
+	update_audio_buffer_status_cb();
+	apply_adaptive_pacing();
+
 	Input::Update();
 
 	RETRO_PERFORMANCE_INIT(pcsx2_run);
@@ -901,20 +1084,218 @@ void retro_run(void)
 	GetMTGS().ExecuteTaskInThread();
 
 	RETRO_PERFORMANCE_STOP(pcsx2_run);
+
+	PerfStats::FrameEnd();
+	if (option_perf_overlay)
+	{
+		static u32 perf_overlay_frames = 0;
+		if (++perf_overlay_frames >= 120)
+		{
+			perf_overlay_frames = 0;
+			char overlay[192];
+			PerfStats::FormatOverlay(overlay, sizeof(overlay));
+			RetroMessager::Notification(overlay, false);
+		}
+	}
+}
+
+static VmStateBuffer state_buffer(L"Libretro Savestate");
+static size_t state_size = 0;          // bytes actually used in state_buffer
+static size_t state_size_reported = 0; // padded size handed to the frontend
+
+// GSfreeze dereferences the renderer, so don't touch it unless the GS side is up.
+static s32 gs_freeze_section(int mode, freezeData* data)
+{
+	if (!GetMTGS().IsOpened())
+		return -1;
+	return GSfreeze(mode, data);
+}
+
+// FreezeAll() covers the VM core only; the legacy plugin freeze entry points
+// still own the GS, SPU2 and PAD side of the state, so those get appended as
+// explicitly sized sections.  A failed (or skipped) plugin saves a zero-length
+// section so the stream framing stays intact either way.
+static void freeze_section(SaveStateBase& state, s32 (*freezer)(int mode, freezeData* data))
+{
+	freezeData fd = {0, NULL};
+
+	if (state.IsSaving())
+	{
+		if (freezer(FREEZE_SIZE, &fd) < 0)
+			fd.size = 0;
+		state.Freeze(fd.size);
+	}
+	else
+		state.Freeze(fd.size);
+
+	if (fd.size <= 0)
+		return;
+
+	state.PrepBlock(fd.size);
+	fd.data = (s8*)state.GetBlockPtr();
+	freezer(state.IsSaving() ? FREEZE_SAVE : FREEZE_LOAD, &fd);
+	state.CommitBlock(fd.size);
+}
+
+// Brings the whole machine to a freezable point.  Drain first so an EE thread
+// sleeping on ring backpressure or the vsync queue wakes up and can acknowledge
+// the pause, then drain again so the GIF paths are idle when gifFreeze runs
+// (gifPathFreeze expects no in-flight GS packets).  The drains run here because
+// in the libretro build the frontend thread doubles as the fake MTGS thread.
+static void quiesce_for_freeze()
+{
+	GetMTGS().DrainTaskInThread();
+	GetCoreThread().Pause();
+	GetMTGS().DrainTaskInThread();
+}
+
+static bool freeze_to_buffer()
+{
+	if (!GetCoreThread().HasActiveMachine())
+		return false;
+
+	quiesce_for_freeze();
+
+	memSavingState saveme(state_buffer);
+	u32 version = g_SaveVersion;
+	saveme.Freeze(version);
+	saveme.FreezeAll();
+	freeze_section(saveme, SPU2freeze);
+	freeze_section(saveme, PADfreeze);
+	freeze_section(saveme, gs_freeze_section);
+	state_size = saveme.GetCurrentPos();
+
+	GetCoreThread().Resume();
+	return true;
+}
+
+// Loads the state sitting in state_buffer back into the VM.
+static bool unfreeze_from_buffer()
+{
+	if (!GetCoreThread().HasActiveMachine())
+		return false;
+
+	memLoadingState loadme(state_buffer);
+	u32 version = 0;
+	loadme.Freeze(version);
+	if (version != g_SaveVersion)
+	{
+		log_cb(RETRO_LOG_ERROR, "Savestate version mismatch (got %08x, expected %08x)\n", version, g_SaveVersion);
+		return false;
+	}
+
+	quiesce_for_freeze();
+
+	loadme.FreezeAll();
+	freeze_section(loadme, SPU2freeze);
+	freeze_section(loadme, PADfreeze);
+	freeze_section(loadme, gs_freeze_section);
+
+	GetCoreThread().Resume();
+	return true;
+}
+
+// When the delta rewind option is on, the frontend only ever sees a small
+// token per state; the actual snapshot lives in the StateRewind ring, delta
+// compressed against its neighbour.  That shrinks the memory the frontend
+// allocates for its rewind history from gigabytes down to the ring budget,
+// at the cost of such states only being loadable within the same session.
+struct RewindToken
+{
+	u32 magic;
+	u32 session;
+	u32 seq;
+	u32 size; // uncompressed snapshot size, sanity-checked on load
+};
+static const u32 RewindTokenMagic = 0x30445352; // "RSD0"
+static bool state_rewind_tokens = false;
+static bool state_rewind_checked = false;
+
+static void init_rewind_mode()
+{
+	if (state_rewind_checked)
+		return;
+	state_rewind_checked = true;
+
+	if (option_value(BOOL_PCSX2_OPT_REWIND_DELTA, KeyOptionBool::return_type))
+	{
+		int budget_mb = option_value(INT_PCSX2_OPT_REWIND_BUFFER_SIZE, KeyOptionInt::return_type);
+		StateRewind::Init((size_t)budget_mb);
+		state_rewind_tokens = true;
+		log_cb(RETRO_LOG_INFO, "Delta rewind states enabled, ring budget %d MB\n", budget_mb);
+	}
 }
 
 size_t retro_serialize_size(void)
 {
-	return 0;
+	init_rewind_mode();
+
+	if (state_rewind_tokens)
+		return GetCoreThread().HasActiveMachine() ? sizeof(RewindToken) : 0;
+
+	// The frontend wants a stable figure it can size rewind/netplay buffers
+	// with.  The PS2 side of the state is fixed, but the plugin payloads can
+	// vary a little between calls, so measure once with a real capture, pad to
+	// the next megabyte, and keep reporting that for the rest of the session.
+	if (!state_size_reported)
+	{
+		if (!freeze_to_buffer())
+			return 0;
+		state_size_reported = (state_size + _1mb) & ~(size_t)(_1mb - 1);
+	}
+	return state_size_reported;
 }
 
 bool retro_serialize(void* data, size_t size)
 {
-	return false;
+	init_rewind_mode();
+
+	if (state_rewind_tokens)
+	{
+		if (size < sizeof(RewindToken) || !freeze_to_buffer())
+			return false;
+
+		RewindToken token;
+		token.magic   = RewindTokenMagic;
+		token.session = StateRewind::SessionId();
+		token.size    = (u32)state_size;
+		token.seq     = StateRewind::Push(state_buffer.GetPtr(), state_size);
+		memcpy(data, &token, sizeof(token));
+		return true;
+	}
+
+	if (!freeze_to_buffer() || state_size > size)
+		return false;
+
+	memcpy(data, state_buffer.GetPtr(), state_size);
+	return true;
 }
+
 bool retro_unserialize(const void* data, size_t size)
 {
-	return false;
+	if (size >= sizeof(RewindToken) && ((const RewindToken*)data)->magic == RewindTokenMagic)
+	{
+		RewindToken token;
+		memcpy(&token, data, sizeof(token));
+
+		if (!StateRewind::Enabled() || token.session != StateRewind::SessionId())
+		{
+			log_cb(RETRO_LOG_ERROR, "Delta rewind state is from another session and cannot be loaded\n");
+			return false;
+		}
+
+		state_buffer.MakeRoomFor((int)token.size);
+		if (!StateRewind::Fetch(token.seq, state_buffer.GetPtr(), token.size))
+		{
+			log_cb(RETRO_LOG_ERROR, "Delta rewind state %u has been evicted from the ring\n", token.seq);
+			return false;
+		}
+		return unfreeze_from_buffer();
+	}
+
+	state_buffer.MakeRoomFor((int)size);
+	memcpy(state_buffer.GetPtr(), data, size);
+	return unfreeze_from_buffer();
 }
 
 unsigned retro_get_region(void)
@@ -946,9 +1327,11 @@ void retro_cheat_set(unsigned index, bool enabled, const char* code)
 }
 
 retro_audio_sample_t sample_cb;
+retro_audio_sample_batch_t batch_cb;
 
 void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb)
 {
+	batch_cb = cb;
 }
 
 void retro_set_audio_sample(retro_audio_sample_t cb)
@@ -6,18 +6,30 @@
 #define BOOL_PCSX2_OPT_ENABLE_WIDESCREEN_PATCHES              "pcsx2_enable_widescreen_patches"
 #define BOOL_PCSX2_OPT_ENABLE_60FPS_PATCHES                   "pcsx2_enable_60fps_patches"
 #define BOOL_PCSX2_OPT_FRAMESKIP                              "pcsx2_frameskip"
+#define BOOL_PCSX2_OPT_AUTO_FRAMESKIP                         "pcsx2_auto_frameskip"
 #define BOOL_PCSX2_OPT_USERHACK_ALIGN_SPRITE                  "pcsx2_userhack_align_sprite"
 #define BOOL_PCSX2_OPT_USERHACK_MERGE_SPRITE                  "pcsx2_userhack_merge_sprite"
 #define BOOL_PCSX2_OPT_USERHACK_WILDARMS_OFFSET               "pcsx2_userhack_wildarms_offset"
 #define BOOL_PCSX2_OPT_USERHACK_FB_CONVERSION                 "pcsx2_userhack_fb_conversion"
 #define BOOL_PCSX2_OPT_USERHACK_FAST_INVALIDATION             "pcsx2_fast_invalidation"
+#define BOOL_PCSX2_OPT_USERHACK_OVERDRAW_SKIP                 "pcsx2_userhack_overdraw_skip"
 #define BOOL_PCSX2_OPT_GAMEPAD_RUMBLE_ENABLE                  "pcsx2_rumble_enable"
+#define BOOL_PCSX2_OPT_GAMEPAD_LATE_POLL                      "pcsx2_late_pad_poll"
 #define BOOL_PCSX2_OPT_BOOT_TO_BIOS                           "pcsx2_boot_bios"
 #define BOOL_PCSX2_OPT_ENABLE_CHEATS                          "pcsx2_enable_cheats"
 #define BOOL_PCSX2_OPT_USERHACK_AUTO_FLUSH                    "pcsx2_userhack_auto_flush"
 #define BOOL_PCSX2_OPT_CONSERVATIVE_BUFFER                    "pcsx2_conservative_buffer"
 #define BOOL_PCSX2_OPT_ACCURATE_DATE                          "pcsx2_accurate_date"
 #define BOOL_PCSX2_OPT_PALETTE_CONVERSION                     "pcsx2_palette_conversion"
+#define BOOL_PCSX2_OPT_REWIND_DELTA                           "pcsx2_rewind_delta_states"
+#define BOOL_PCSX2_OPT_PERF_OVERLAY                           "pcsx2_perf_overlay"
+#define BOOL_PCSX2_OPT_PERF_TRACE                             "pcsx2_perf_trace"
+#define BOOL_PCSX2_OPT_DETERMINISTIC                          "pcsx2_deterministic_mode"
+#define INT_PCSX2_OPT_CDVD_CACHE_SIZE                         "pcsx2_cdvd_cache_size"
+#define INT_PCSX2_OPT_NUMA_NODE                               "pcsx2_numa_node"
+#define BOOL_PCSX2_OPT_EE_CACHE                               "pcsx2_ee_cache"
+#define BOOL_PCSX2_OPT_KERNEL_BOOT_SNAPSHOT                   "pcsx2_kernel_boot_snapshot"
+#define BOOL_PCSX2_OPT_IPU_PIPELINE                           "pcsx2_ipu_pipeline"
 
 #define STRING_PCSX2_OPT_BIOS                                 "pcsx2_bios"
 #define STRING_PCSX2_OPT_RENDERER                             "pcsx2_renderer"
@@ -49,6 +61,7 @@
 #define INT_PCSX2_OPT_DITHERING                               "pcsx2_dithering"
 #define INT_PCSX2_OPT_GAMEPAD_L_DEADZONE                      "pcsx2_gamepad_l_deadzone"
 #define INT_PCSX2_OPT_GAMEPAD_R_DEADZONE                      "pcsx2_gamepad_r_deadzone"
+#define INT_PCSX2_OPT_REWIND_BUFFER_SIZE                      "pcsx2_rewind_buffer_size"
 
 #define INT_PCSX2_OPT_USERHACK_TEXTURE_OFFSET_X_HUNDREDS      "pcsx2_userhack_texture_offset_x_hundreds"
 #define INT_PCSX2_OPT_USERHACK_TEXTURE_OFFSET_X_TENS          "pcsx2_userhack_texture_offset_x_tens"
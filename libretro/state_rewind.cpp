@@ -0,0 +1,259 @@
+#include "state_rewind.h"
+#include "libretro.h"
+
+#include "Utilities/Crc32.h"
+
+#include <deque>
+#include <vector>
+#include <cstring>
+#include <ctime>
+
+extern retro_log_printf_t log_cb;
+
+namespace StateRewind {
+
+	// A new keyframe every this many deltas bounds both reconstruction cost
+	// and how much history one eviction throws away.
+	static const u32 KeyframeInterval = 60;
+
+	struct Record
+	{
+		u32 seq;
+		bool keyframe;
+		u32 crc;    // CRC-32C of the padded snapshot, checked on reconstruction
+		std::vector<u8> blob;
+	};
+
+	static std::deque<Record> records;
+	static std::vector<u32> prev_snap;    // last pushed snapshot, padded to words
+	static std::vector<u32> work_snap;    // scratch for encode/reconstruct
+	static size_t snap_bytes = 0;
+	static size_t snap_words = 0;
+	static size_t used_bytes = 0;
+	static size_t budget_bytes = 0;
+	static u32 next_seq = 0;
+	static u32 deltas_since_key = 0;
+	static u32 keyframe_count = 0;
+	static u32 session_id = 0;
+	static bool enabled = false;
+
+	static void ClearRing()
+	{
+		records.clear();
+		used_bytes = 0;
+		deltas_since_key = 0;
+		keyframe_count = 0;
+	}
+
+	void Init(size_t budget_mb)
+	{
+		ClearRing();
+		budget_bytes = budget_mb << 20;
+		session_id = (u32)time(NULL);
+		enabled = budget_bytes != 0;
+	}
+
+	void Shutdown()
+	{
+		ClearRing();
+		prev_snap.clear();
+		work_snap.clear();
+		snap_bytes = snap_words = 0;
+		enabled = false;
+	}
+
+	bool Enabled()
+	{
+		return enabled;
+	}
+
+	u32 SessionId()
+	{
+		return session_id;
+	}
+
+	static void BlobPut(std::vector<u8>& out, u32 val)
+	{
+		const u8* p = (const u8*)&val;
+		out.insert(out.end(), p, p + sizeof(val));
+	}
+
+	// Zero-run RLE over 32-bit words: a stream of [zero run][literal run]
+	// [literal words...] counts. Encoding the XOR against the previous
+	// snapshot turns untouched memory into huge zero runs, which is where
+	// all the compression comes from; keyframes are encoded the same way
+	// against an all-zero base, which still folds empty RAM down nicely.
+	static void RleEncode(std::vector<u8>& out, const u32* cur, const u32* base, size_t words)
+	{
+		size_t i = 0;
+		while (i < words)
+		{
+			size_t zero_start = i;
+			while (i < words && (base ? (cur[i] ^ base[i]) : cur[i]) == 0)
+				i++;
+
+			size_t lit_start = i;
+			size_t zrun = 0;
+			while (i < words)
+			{
+				if ((base ? (cur[i] ^ base[i]) : cur[i]) == 0)
+				{
+					// Only break the literal for zero runs long enough to pay
+					// for a new count pair.
+					if (++zrun >= 8)
+					{
+						i -= zrun - 1;
+						break;
+					}
+				}
+				else
+					zrun = 0;
+				i++;
+			}
+			size_t lit_end = (i == words && zrun) ? i - zrun : i;
+
+			BlobPut(out, (u32)(lit_start - zero_start));
+			BlobPut(out, (u32)(lit_end - lit_start));
+			for (size_t k = lit_start; k < lit_end; k++)
+				BlobPut(out, base ? (cur[k] ^ base[k]) : cur[k]);
+
+			if (i == words && zrun)
+			{
+				// Flush the trailing zero run so decode consumes every word.
+				BlobPut(out, (u32)zrun);
+				BlobPut(out, 0);
+			}
+		}
+	}
+
+	// xor_apply: patch dst in place (zero runs leave it untouched).
+	// Otherwise dst is fully rewritten, zero runs included.
+	static bool RleApply(const std::vector<u8>& blob, u32* dst, size_t words, bool xor_apply)
+	{
+		const u32* in = (const u32*)blob.data();
+		size_t in_words = blob.size() / sizeof(u32);
+		size_t ip = 0;
+		size_t op = 0;
+
+		while (op < words)
+		{
+			if (ip + 2 > in_words)
+				return false;
+			size_t zeros = in[ip++];
+			size_t lits = in[ip++];
+			if (op + zeros + lits > words || ip + lits > in_words)
+				return false;
+
+			if (!xor_apply && zeros)
+				memset(&dst[op], 0, zeros * sizeof(u32));
+			op += zeros;
+
+			if (xor_apply)
+				for (size_t k = 0; k < lits; k++)
+					dst[op + k] ^= in[ip + k];
+			else
+				memcpy(&dst[op], &in[ip], lits * sizeof(u32));
+			ip += lits;
+			op += lits;
+		}
+		return ip == in_words;
+	}
+
+	static void Evict()
+	{
+		// The chain must always start on a keyframe, so eviction drops the
+		// oldest keyframe *group* (the keyframe plus its dependent deltas),
+		// and never the group still being written to.
+		while (used_bytes > budget_bytes && keyframe_count > 1)
+		{
+			do
+			{
+				if (records.front().keyframe)
+					keyframe_count--;
+				used_bytes -= records.front().blob.size();
+				records.pop_front();
+			} while (!records.empty() && !records.front().keyframe);
+		}
+	}
+
+	u32 Push(const u8* data, size_t size)
+	{
+		if (size != snap_bytes)
+		{
+			// First push, or the state layout changed: restart the chain.
+			ClearRing();
+			snap_bytes = size;
+			snap_words = (size + sizeof(u32) - 1) / sizeof(u32);
+			prev_snap.assign(snap_words, 0);
+			work_snap.assign(snap_words, 0);
+		}
+
+		work_snap.back() = 0; // keep padding deterministic for partial tail
+		memcpy(work_snap.data(), data, size);
+
+		Record rec;
+		rec.seq = next_seq++;
+		rec.keyframe = records.empty() || deltas_since_key >= KeyframeInterval;
+		rec.crc = crc32c_update(0, work_snap.data(), snap_words * sizeof(u32));
+		RleEncode(rec.blob, work_snap.data(), rec.keyframe ? NULL : prev_snap.data(), snap_words);
+
+		if (rec.keyframe)
+		{
+			keyframe_count++;
+			deltas_since_key = 0;
+		}
+		else
+			deltas_since_key++;
+
+		used_bytes += rec.blob.size();
+		records.push_back(std::move(rec));
+		prev_snap.swap(work_snap);
+
+		Evict();
+		return records.back().seq;
+	}
+
+	bool Fetch(u32 seq, u8* data, size_t size)
+	{
+		if (!enabled || size != snap_bytes || records.empty())
+			return false;
+		if (seq < records.front().seq || seq > records.back().seq)
+			return false;
+
+		size_t idx = seq - records.front().seq;
+		size_t key = idx;
+		while (!records[key].keyframe)
+			key--;
+
+		if (!RleApply(records[key].blob, work_snap.data(), snap_words, false))
+			return false;
+		for (size_t i = key + 1; i <= idx; i++)
+			if (!RleApply(records[i].blob, work_snap.data(), snap_words, true))
+				return false;
+
+		// A delta chain quietly reassembling the wrong bytes would hand the
+		// core a corrupt state; refuse instead and let the frontend keep the
+		// current one.
+		if (crc32c_update(0, work_snap.data(), snap_words * sizeof(u32)) != records[idx].crc)
+		{
+			log_cb(RETRO_LOG_ERROR, "StateRewind: crc mismatch reconstructing state %u, dropping history\n", seq);
+			ClearRing();
+			return false;
+		}
+
+		memcpy(data, work_snap.data(), size);
+
+		// Roll back: everything newer than seq is now an abandoned timeline,
+		// and the next push has to delta against what we just restored.
+		while (records.back().seq > seq)
+		{
+			if (records.back().keyframe)
+				keyframe_count--;
+			used_bytes -= records.back().blob.size();
+			records.pop_back();
+		}
+		deltas_since_key = (u32)(idx - key);
+		prev_snap.swap(work_snap);
+		return true;
+	}
+}
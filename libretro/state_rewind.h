@@ -0,0 +1,25 @@
+/*
+* Delta-compressed savestate ring for rewind.
+* Keeps a keyframe plus XOR/RLE deltas of each snapshot against the previous
+* one in a fixed memory budget, so a long rewind history of full PS2 states
+* fits in a few hundred MB instead of several GB. Snapshots are addressed by
+* a sequence id; fetching an id rolls the ring back to it, so the next push
+* deltas against the state the emulator actually resumed from.
+*/
+
+#include <stddef.h>
+#include "Pcsx2Types.h"
+
+namespace StateRewind {
+	void Init(size_t budget_mb);
+	void Shutdown();
+	bool Enabled();
+	u32 SessionId();
+
+	// Stores a snapshot and returns the sequence id it can be fetched with.
+	u32 Push(const u8* data, size_t size);
+
+	// Reconstructs the snapshot stored under seq and rolls the ring back to
+	// it. Fails if the id was evicted or never existed.
+	bool Fetch(u32 seq, u8* data, size_t size);
+}
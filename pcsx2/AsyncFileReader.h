@@ -24,6 +24,7 @@
 #	include <aio.h>
 #endif
 #include <memory>
+#include <unordered_map>
 
 class AsyncFileReader
 {
@@ -53,6 +54,10 @@ public:
 	virtual void SetBlockSize(uint bytes) {}
 	virtual void SetDataOffset(int bytes) {}
 
+	// Advisory: the given sectors are likely to be read soon.  Readers with a
+	// cache behind them can start pulling the data in; the default is a no-op.
+	virtual void PrefetchHint(uint sector, uint count) {}
+
 	uint GetBlockSize() const { return m_blocksize; }
 
 	const wxString& GetFilename() const
@@ -156,6 +161,9 @@ class BlockdumpFileReader : public AsyncFileReader
 	std::unique_ptr<u32[]> m_dtable;
 	int m_dtablesize;
 
+	// LSN -> m_dtable index, built once at Open so reads don't scan the table
+	std::unordered_map<u32, u32> m_lsn_map;
+
 	int m_lresult;
 
 public:
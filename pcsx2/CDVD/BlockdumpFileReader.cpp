@@ -114,6 +114,14 @@ bool BlockdumpFileReader::Open(const wxString& fileName)
 
 	} while (has == bs);
 
+	// Dumps only hold the sectors the game actually touched, in capture
+	// order, so reads can't compute a record position from the LSN - map it.
+	m_lsn_map.clear();
+	m_lsn_map.reserve(m_dtablesize);
+
+	for (int j = 0; j < m_dtablesize; ++j)
+		m_lsn_map.emplace(m_dtable[j], (u32)j);
+
 	return true;
 }
 
@@ -124,14 +132,14 @@ int BlockdumpFileReader::ReadSync(void* pBuffer, uint lsn, uint count)
 
 	while (count > 0)
 	{
-		bool ok = false;
-		for (int i = 0; i < m_dtablesize; ++i)
+		auto it = m_lsn_map.find(lsn);
+
+		if (it != m_lsn_map.end())
 		{
-			if (m_dtable[i] != lsn)
-				continue;
+			u32 i = it->second;
 
-				// We store the LSN (u32) along with each block inside of blockdumps, so the
-				// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
+			// We store the LSN (u32) along with each block inside of blockdumps, so the
+			// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
 
 #ifdef PCSX2_DEBUG
 			u32 check_lsn;
@@ -143,12 +151,8 @@ int BlockdumpFileReader::ReadSync(void* pBuffer, uint lsn, uint count)
 #endif
 
 			m_file->Read(dst, m_blocksize);
-
-			ok = true;
-			break;
 		}
-
-		if (!ok)
+		else
 		{
 #ifndef NDEBUG
 			log_cb(RETRO_LOG_ERROR, "Block %u not found in dump\n", lsn);
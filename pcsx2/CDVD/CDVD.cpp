@@ -25,12 +25,17 @@
 
 #include "CdRom.h"
 #include "CDVD.h"
+#include "../../libretro/input_trace.h"
 #include "CDVD_internal.h"
 #include "CDVDisoReader.h"
 
 #include "GS.h" // for gsVideoMode
 #include "Elfheader.h"
 #include "ps2/BiosTools.h"
+#include "options_tools.h"
+
+#include <sys/stat.h>
+#include <map>
 
 // This typically reflects the Sony-assigned serial code for the Disc, if one exists.
 //  (examples:  SLUS-2113, etc).
@@ -329,6 +334,140 @@ s32 cdvdWriteConfig(const u8* config)
 
 static MutexRecursive Mutex_NewDiskCB;
 
+// --------------------------------------------------------------------------------------
+//  Persistent disc identification cache
+// --------------------------------------------------------------------------------------
+// Identifying a disc means walking the ISOFS for SYSTEM.CNF and then loading and
+// CRC-ing the whole boot ELF, which for compressed images decompresses every chunk
+// the ELF spans.  The result depends only on the image file, so recognized PS2 discs
+// are remembered across sessions in a small text file under the frontend system
+// directory, keyed by a hash of the image's path, size and modification time.  A
+// disc swap or a later boot of a known image then skips the extraction entirely;
+// unknown or non-file sources (plugin/device discs) take the normal path.
+
+struct DiscIdEntry
+{
+	u32 crc;
+	u32 entry;
+	u32 text_start;
+	u32 text_size;
+	wxString serial;
+	wxString elfpath;
+};
+
+static std::map<u64, DiscIdEntry> s_disc_id_cache;
+static std::string s_disc_id_path;
+static bool s_disc_id_loaded = false;
+
+static u64 DiscIdHash(u64 h, const void* data, size_t size)
+{
+	const u8* p = (const u8*)data;
+
+	for (size_t i = 0; i < size; i++)
+		h = (h ^ p[i]) * 0x100000001b3ull;
+
+	return h;
+}
+
+static u64 DiscIdKey()
+{
+	if (CDVDsys_GetSourceType() != CDVD_SourceType::Iso)
+		return 0;
+
+	const wxString& path = CDVDsys_GetFile(CDVD_SourceType::Iso);
+	if (path.IsEmpty())
+		return 0;
+
+	const wxScopedCharBuffer utf8(path.ToUTF8());
+
+#ifdef _WIN32
+	struct _stat64 st;
+	if (_wstat64(path.wc_str(), &st) != 0)
+		return 0;
+#else
+	struct stat st;
+	if (stat(utf8.data(), &st) != 0)
+		return 0;
+#endif
+
+	const s64 size = (s64)st.st_size;
+	const s64 mtime = (s64)st.st_mtime;
+
+	u64 h = 0xcbf29ce484222325ull;
+	h = DiscIdHash(h, utf8.data(), utf8.length());
+	h = DiscIdHash(h, &size, sizeof(size));
+	h = DiscIdHash(h, &mtime, sizeof(mtime));
+
+	return h ? h : 1;
+}
+
+static void DiscIdCacheLoad()
+{
+	s_disc_id_loaded = true;
+
+	if (retroarch_system_path.empty())
+		return;
+
+	s_disc_id_path = retroarch_system_path + "/pcsx2/disc_id.cache";
+
+	FILE* fp = fopen(s_disc_id_path.c_str(), "r");
+	if (!fp)
+		return;
+
+	char line[1024];
+	while (fgets(line, sizeof(line), fp))
+	{
+		unsigned long long key;
+		unsigned int crc, entry, text_start, text_size;
+		int pos = 0;
+
+		if (sscanf(line, "%llx %x %x %x %x %n", &key, &crc, &entry, &text_start, &text_size, &pos) != 5 || pos == 0)
+			continue;
+
+		char* serial = line + pos;
+		char* sep = strchr(serial, '|');
+		if (!sep)
+			continue;
+		*sep = 0;
+
+		char* elf = sep + 1;
+		if (char* nl = strchr(elf, '\n'))
+			*nl = 0;
+
+		DiscIdEntry& e = s_disc_id_cache[(u64)key];
+		e.crc = crc;
+		e.entry = entry;
+		e.text_start = text_start;
+		e.text_size = text_size;
+		e.serial = wxString::FromUTF8(serial);
+		e.elfpath = wxString::FromUTF8(elf);
+	}
+
+	fclose(fp);
+}
+
+static void DiscIdCacheStore(u64 key)
+{
+	DiscIdEntry& e = s_disc_id_cache[key];
+	e.crc = ElfCRC;
+	e.entry = ElfEntry;
+	e.text_start = ElfTextRange.first;
+	e.text_size = ElfTextRange.second;
+	e.serial = DiscSerial;
+	e.elfpath = LastELF;
+
+	if (s_disc_id_path.empty())
+		return;
+
+	if (FILE* fp = fopen(s_disc_id_path.c_str(), "a"))
+	{
+		fprintf(fp, "%llx %x %x %x %x %s|%s\n",
+			(unsigned long long)key, e.crc, e.entry, e.text_start, e.text_size,
+			(const char*)e.serial.ToUTF8(), (const char*)e.elfpath.ToUTF8());
+		fclose(fp);
+	}
+}
+
 // Sets ElfCRC to the CRC of the game bound to the CDVD source.
 static __fi ElfObject* loadElf(const wxString filename)
 {
@@ -406,6 +545,32 @@ void cdvdReloadElfInfo(wxString elfoverride)
 			return;
 		}
 
+		if (!s_disc_id_loaded)
+			DiscIdCacheLoad();
+
+		const u64 idkey = DiscIdKey();
+
+		if (idkey)
+		{
+			auto it = s_disc_id_cache.find(idkey);
+			if (it != s_disc_id_cache.end())
+			{
+				ScopedLock locker(Mutex_NewDiskCB);
+
+				const DiscIdEntry& e = it->second;
+
+				LastELF = e.elfpath;
+				DiscSerial = e.serial;
+				ElfCRC = e.crc;
+				ElfEntry = e.entry;
+				ElfTextRange = std::make_pair(e.text_start, e.text_size);
+
+				log_cb(RETRO_LOG_INFO, "ELF (%s) Game CRC = 0x%08X, EntryPoint = 0x%08X (cached identity)\n",
+					(const char*)e.elfpath.ToUTF8(), ElfCRC, ElfEntry);
+				return;
+			}
+		}
+
 		wxString elfpath;
 		u32 discType = GetPS2ElfName(elfpath);
 
@@ -426,6 +591,9 @@ void cdvdReloadElfInfo(wxString elfoverride)
 
 		// Recognized and PS2 (BOOT2).  Good job, user.
 		_reloadElfInfo(elfpath);
+
+		if (idkey)
+			DiscIdCacheStore(idkey);
 	}
 	catch (Exception::FileNotFound& e)
 	{
@@ -645,13 +813,39 @@ void cdvdReset()
 
 	// CDVD internally uses GMT+9.  If you think the time's wrong, you're wrong.
 	// Set up your time zone and winter/summer in the BIOS.  No PS2 BIOS I know of features automatic DST.
-	wxDateTime curtime(wxDateTime::GetTimeNow());
-	cdvd.RTC.second = (u8)curtime.GetSecond();
-	cdvd.RTC.minute = (u8)curtime.GetMinute();
-	cdvd.RTC.hour = (u8)curtime.GetHour(wxDateTime::GMT9);
-	cdvd.RTC.day = (u8)curtime.GetDay(wxDateTime::GMT9);
-	cdvd.RTC.month = (u8)curtime.GetMonth(wxDateTime::GMT9) + 1; // WX returns Jan as "0"
-	cdvd.RTC.year = (u8)(curtime.GetYear(wxDateTime::GMT9) - 2000);
+	u8 rtc[6];
+	if (g_DeterministicMode)
+	{
+		// Lockstep peers must agree on every input, and the RTC seed is
+		// otherwise the host wall clock; pin it to 2000-01-01 00:00:00.
+		rtc[0] = 0;
+		rtc[1] = 0;
+		rtc[2] = 0;
+		rtc[3] = 1;
+		rtc[4] = 1;
+		rtc[5] = 0;
+	}
+	else
+	{
+		wxDateTime curtime(wxDateTime::GetTimeNow());
+		rtc[0] = (u8)curtime.GetSecond();
+		rtc[1] = (u8)curtime.GetMinute();
+		rtc[2] = (u8)curtime.GetHour(wxDateTime::GMT9);
+		rtc[3] = (u8)curtime.GetDay(wxDateTime::GMT9);
+		rtc[4] = (u8)(curtime.GetMonth(wxDateTime::GMT9) + 1); // WX returns Jan as "0"
+		rtc[5] = (u8)(curtime.GetYear(wxDateTime::GMT9) - 2000);
+	}
+
+	// Wall clock is the one nondeterministic input here; an input trace
+	// records it and substitutes the recorded values on replay.
+	InputTrace::CaptureRTC(rtc);
+
+	cdvd.RTC.second = rtc[0];
+	cdvd.RTC.minute = rtc[1];
+	cdvd.RTC.hour = rtc[2];
+	cdvd.RTC.day = rtc[3];
+	cdvd.RTC.month = rtc[4];
+	cdvd.RTC.year = rtc[5];
 }
 
 struct Freeze_v10Compat
@@ -704,13 +898,12 @@ static void mechaDecryptBytes(u32 madr, int size)
 	}
 }
 
-int cdvdReadSector()
+// DMA gate shared by cdvdReadInterrupt and cdvdReadSector: the sector payload
+// is fetched straight into IOP memory these days, so the read interrupt has to
+// know there is somewhere to put it before consuming the block from the source.
+static int cdvdSectorReady()
 {
-	s32 bcr;
-
-	CDVD_LOG("SECTOR %d (BCR %x;%x)", cdvd.Sector, HW_DMA3_BCR_H16, HW_DMA3_BCR_L16);
-
-	bcr = (HW_DMA3_BCR_H16 * HW_DMA3_BCR_L16) * 4;
+	s32 bcr = (HW_DMA3_BCR_H16 * HW_DMA3_BCR_L16) * 4;
 	if (bcr < cdvd.BlockSize)
 	{
 		CDVD_LOG("READBLOCK:  bcr < cdvd.BlockSize; %x < %x", bcr, cdvd.BlockSize);
@@ -722,6 +915,16 @@ int cdvdReadSector()
 		return -1;
 	}
 
+	return 0;
+}
+
+int cdvdReadSector()
+{
+	CDVD_LOG("SECTOR %d (BCR %x;%x)", cdvd.Sector, HW_DMA3_BCR_H16, HW_DMA3_BCR_L16);
+
+	if (cdvdSectorReady() == -1)
+		return -1;
+
 	//if( (HW_DMA3_CHCR & 0x01000000) == 0 ) {
 	//	// DMA3 problem?
 	//	log_cb(RETRO_LOG_WARN, "CDVD READ - DMA3 transfer off (try again)\n" );
@@ -730,7 +933,9 @@ int cdvdReadSector()
 	// DMAs use physical addresses (air)
 	u8* mdest = iopPhysMem(HW_DMA3_MADR);
 
-	// if raw dvd sector 'fill in the blanks'
+	// The 2048 (or raw CD sized) payload was already placed at its final
+	// position by the read interrupt; if raw dvd sector 'fill in the blanks'
+	// around it.
 	if (cdvd.BlockSize == 2064)
 	{
 		// get info on dvd type and layer1 start
@@ -778,8 +983,7 @@ int cdvdReadSector()
 		mdest[10] = 0;
 		mdest[11] = 0;
 
-		// normal 2048 bytes of sector data
-		memcpy(&mdest[12], cdr.Transfer, 2048);
+		// normal 2048 bytes of sector data are already at &mdest[12]
 
 		// 4 bytes of edc (not calculated at present)
 		mdest[2060] = 0;
@@ -787,10 +991,6 @@ int cdvdReadSector()
 		mdest[2062] = 0;
 		mdest[2063] = 0;
 	}
-	else
-	{
-		memcpy(mdest, cdr.Transfer, cdvd.BlockSize);
-	}
 
 	// decrypt sector's bytes
 	if (cdvd.decSet)
@@ -883,9 +1083,31 @@ __fi void cdvdReadInterrupt()
 	}
 	else
 	{
+		// Check the DMA gate before consuming the block from the source: the
+		// payload is copied once, straight to its final place in IOP memory,
+		// so there has to be room for it first.  This also skips the buffer
+		// wait entirely while the game is still programming the DMA.
+		if (cdvd.nSectors > 0 && cdvdSectorReady() == -1)
+		{
+			pxAssert((int)cdvd.ReadTime > 0);
+			CDVDREAD_INT(cdvd.ReadTime / 4);
+			return;
+		}
+
 		if (cdvd.RErr == 0)
 		{
-			while ((cdvd.RErr = DoCDVDgetBuffer(cdr.Transfer)), cdvd.RErr == -2)
+			u8* pdest = cdr.Transfer;
+
+			if (cdvd.nSectors > 0)
+			{
+				pdest = iopPhysMem(HW_DMA3_MADR);
+
+				// raw dvd sectors are assembled around the payload in cdvdReadSector
+				if (cdvd.BlockSize == 2064)
+					pdest += 12;
+			}
+
+			while ((cdvd.RErr = DoCDVDgetBuffer(pdest)), cdvd.RErr == -2)
 			{
 				// not finished yet ... block on the read until it finishes.
 				Threading::Sleep(0);
@@ -1016,6 +1238,10 @@ static uint cdvdStartSeek(uint newsector, CDVD_MODE_TYPE mode)
 		}
 	}
 
+	// The emulated seek delay tells us exactly when the destination sectors
+	// will be wanted; give the reader's cache a head start on pulling them in.
+	DoCDVDprefetchHint(cdvd.SeekToSector, cdvd.nSectors ? cdvd.nSectors : 32);
+
 	return seektime;
 }
 
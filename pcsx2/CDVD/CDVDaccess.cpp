@@ -35,6 +35,8 @@
 
 #include "DebugTools/SymbolMap.h"
 #include "AppConfig.h"
+#include "PerfStats.h"
+#include "Elfheader.h"
 
 CDVD_API* CDVD = NULL;
 
@@ -387,12 +389,14 @@ void DoCDVDclose()
 s32 DoCDVDreadSector(u8* buffer, u32 lsn, int mode)
 {
 	CheckNullCDVD();
+	PerfStats::Scope scope(Subsys_CDVD);
 	return CDVD->readSector(buffer, lsn, mode);
 }
 
 s32 DoCDVDreadTrack(u32 lsn, int mode)
 {
 	CheckNullCDVD();
+	PerfStats::Scope scope(Subsys_CDVD);
 
 	// TEMP: until all the plugins use the new CDVDgetBuffer style
 	// TODO: The CDVD api only uses the new getBuffer style. Why is this temp?
@@ -418,6 +422,14 @@ s32 DoCDVDreadTrack(u32 lsn, int mode)
 	return CDVD->readTrack(lsn, mode);
 }
 
+void DoCDVDprefetchHint(u32 lsn, u32 count)
+{
+	// Only the iso source has a block cache behind it; physical drives do
+	// their own readahead in the keepalive thread.
+	if (m_CurrentSourceType == CDVD_SourceType::Iso)
+		ISOprefetchHint(lsn, count);
+}
+
 s32 DoCDVDgetBuffer(u8* buffer)
 {
 	CheckNullCDVD();
@@ -435,6 +447,7 @@ s32 DoCDVDdetectDiskType()
 void DoCDVDresetDiskTypeCache()
 {
 	diskTypeCached = -1;
+	ResetPS2ElfNameCache();
 }
 
 ////////////////////////////////////////////////////////
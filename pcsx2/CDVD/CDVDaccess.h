@@ -165,5 +165,6 @@ extern void DoCDVDclose();
 extern s32 DoCDVDreadSector(u8* buffer, u32 lsn, int mode);
 extern s32 DoCDVDreadTrack(u32 lsn, int mode);
 extern s32 DoCDVDgetBuffer(u8* buffer);
+extern void DoCDVDprefetchHint(u32 lsn, u32 count);
 extern s32 DoCDVDdetectDiskType();
 extern void DoCDVDresetDiskTypeCache();
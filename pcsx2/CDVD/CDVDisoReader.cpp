@@ -384,6 +384,14 @@ s32 CALLBACK ISOgetBuffer(u8* buffer)
 //	return pbuffer;
 //}
 
+// Not part of the CDVD plugin API; forwards seek prefetch hints from the
+// CDVD emulation to the block cache behind the iso reader.
+void ISOprefetchHint(u32 lsn, u32 count)
+{
+	if (iso.IsOpened())
+		iso.Prefetch(lsn, count);
+}
+
 s32 CALLBACK ISOgetTrayStatus()
 {
 	return CDVD_TRAY_CLOSE;
@@ -21,4 +21,6 @@
 #include "IopCommon.h"
 #include "IsoFileFormats.h"
 
+extern void ISOprefetchHint(u32 lsn, u32 count);
+
 #endif
@@ -0,0 +1,365 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2014  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "CachedFileReader.h"
+
+#include <algorithm>
+
+uint CachedFileReader::m_cache_size_mb = CACHEDREADER_CACHE_SIZE_MB;
+
+AsyncFileReader* CachedFileReader::Wrap(AsyncFileReader* reader)
+{
+	if (m_cache_size_mb == 0)
+		return reader;
+
+	return new CachedFileReader(reader);
+}
+
+CachedFileReader::CachedFileReader(AsyncFileReader* source)
+	: m_source(source)
+	, m_cache_bytes(0)
+	, m_cache_limit((size_t)m_cache_size_mb * 1024 * 1024)
+	, m_tick(0)
+	, m_last_end_lsn(0)
+	, m_seq_streak(0)
+	, m_pending_cached(true)
+	, m_pending_bytes(0)
+	, m_pending_lsn(0)
+	, m_pending_count(0)
+	, m_prefetchRunning(true)
+{
+	m_filename = source->GetFilename();
+	m_blocksize = source->GetBlockSize();
+
+	m_prefetchThread = std::thread(&CachedFileReader::PrefetchThreadProc, this);
+}
+
+CachedFileReader::~CachedFileReader(void)
+{
+	Close();
+	delete m_source;
+}
+
+bool CachedFileReader::Open(const wxString& fileName)
+{
+	// Cannot open a CachedFileReader directly; use Wrap on an opened reader.
+	return false;
+}
+
+// Returns the cache entry covering the given chunk index, reading it from the
+// backend on a miss, or NULL if the chunk is out of range or the read failed.
+// Prefetched chunks are inserted untouched (touch=false) so they are the
+// first to go if the game never actually reads them.
+CachedFileReader::CacheChunk* CachedFileReader::FetchChunk(u32 chunk, bool touch)
+{
+	std::unordered_map<u32, CacheChunk>::iterator it = m_chunks.find(chunk);
+
+	if (it == m_chunks.end())
+	{
+		uint base = chunk * CACHEDREADER_CHUNK_SECTORS;
+		uint blocks = m_source->GetBlockCount();
+		if (base >= blocks || m_blocksize == 0)
+			return NULL;
+
+		uint sectors = std::min(CACHEDREADER_CHUNK_SECTORS, blocks - base);
+
+		CacheChunk entry;
+		entry.data.resize((size_t)sectors * m_blocksize);
+		entry.hits = 0;
+		entry.tick = ++m_tick;
+
+		if (m_source->ReadSync(entry.data.data(), base, sectors) < 0)
+			return NULL;
+
+		m_cache_bytes += entry.data.size();
+		it = m_chunks.emplace(chunk, std::move(entry)).first;
+		EvictOverLimit(chunk);
+	}
+
+	if (touch)
+	{
+		it->second.hits++;
+		it->second.tick = ++m_tick;
+	}
+
+	return &it->second;
+}
+
+// Evicts the least valuable chunks (fewest hits, oldest on a tie) until the
+// cache is back under budget.  The map is small enough (a couple thousand
+// entries at the default budget) that a linear scan per eviction is fine.
+void CachedFileReader::EvictOverLimit(u32 keepChunk)
+{
+	while (m_cache_bytes > m_cache_limit && m_chunks.size() > 1)
+	{
+		std::unordered_map<u32, CacheChunk>::iterator victim = m_chunks.end();
+
+		for (std::unordered_map<u32, CacheChunk>::iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+		{
+			if (it->first == keepChunk)
+				continue;
+			if (victim == m_chunks.end() ||
+				it->second.hits < victim->second.hits ||
+				(it->second.hits == victim->second.hits && it->second.tick < victim->second.tick))
+			{
+				victim = it;
+			}
+		}
+
+		if (victim == m_chunks.end())
+			break;
+
+		m_cache_bytes -= victim->second.data.size();
+		m_chunks.erase(victim);
+	}
+}
+
+// Copies a sector range out of the cache.  All covering chunks must already
+// be resident.  Returns the number of bytes copied.
+int CachedFileReader::CopyFromCache(void* pBuffer, uint sector, uint count)
+{
+	u8* dst = (u8*)pBuffer;
+	int total = 0;
+
+	while (count > 0)
+	{
+		u32 chunk = sector / CACHEDREADER_CHUNK_SECTORS;
+		uint base = chunk * CACHEDREADER_CHUNK_SECTORS;
+
+		CacheChunk* entry = FetchChunk(chunk, true);
+		if (!entry)
+			break;
+
+		uint avail = (uint)(entry->data.size() / m_blocksize) - (sector - base);
+		uint sectors = std::min(count, avail);
+		if (sectors == 0)
+			break;
+
+		memcpy(dst, entry->data.data() + (size_t)(sector - base) * m_blocksize, (size_t)sectors * m_blocksize);
+
+		dst += (size_t)sectors * m_blocksize;
+		total += sectors * m_blocksize;
+		sector += sectors;
+		count -= sectors;
+	}
+
+	return total;
+}
+
+// Tracks whether the access stream is sequential and queues readahead for the
+// worker: one chunk on random access, growing to CACHEDREADER_MAX_READAHEAD
+// chunks while the stream keeps extending the previous request (FMVs hit the
+// ceiling within a few reads).
+void CachedFileReader::UpdatePattern(uint sector, uint count)
+{
+	if (sector == m_last_end_lsn)
+		m_seq_streak++;
+	else
+		m_seq_streak = 0;
+
+	m_last_end_lsn = sector + count;
+
+	u32 window = std::min(CACHEDREADER_MAX_READAHEAD, 1u << std::min(m_seq_streak, 4u));
+	u32 lastChunk = (sector + count - 1) / CACHEDREADER_CHUNK_SECTORS;
+
+	QueuePrefetch(lastChunk + 1, window);
+}
+
+// Must be called with m_lock held.
+void CachedFileReader::QueuePrefetch(u32 firstChunk, u32 numChunks)
+{
+	bool queued = false;
+
+	for (u32 chunk = firstChunk; chunk < firstChunk + numChunks; chunk++)
+	{
+		if (chunk * CACHEDREADER_CHUNK_SECTORS >= m_source->GetBlockCount())
+			break;
+		if (m_chunks.find(chunk) != m_chunks.end())
+			continue;
+		if (std::find(m_prefetchQueue.begin(), m_prefetchQueue.end(), chunk) != m_prefetchQueue.end())
+			continue;
+
+		m_prefetchQueue.push_back(chunk);
+		queued = true;
+	}
+
+	if (queued)
+		m_prefetchCond.notify_one();
+}
+
+void CachedFileReader::PrefetchThreadProc()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	for (;;)
+	{
+		m_prefetchCond.wait(lock, [&] { return !m_prefetchQueue.empty() || !m_prefetchRunning; });
+
+		if (!m_prefetchRunning)
+			break;
+
+		u32 chunk = m_prefetchQueue.front();
+		m_prefetchQueue.pop_front();
+
+		FetchChunk(chunk, false);
+	}
+}
+
+void CachedFileReader::StopPrefetchThread()
+{
+	if (!m_prefetchThread.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> guard(m_lock);
+		m_prefetchRunning = false;
+		m_prefetchQueue.clear();
+	}
+	m_prefetchCond.notify_one();
+	m_prefetchThread.join();
+}
+
+int CachedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+
+	if (m_blocksize == 0)
+		return m_source->ReadSync(pBuffer, sector, count);
+
+	int total = CopyFromCache(pBuffer, sector, count);
+	UpdatePattern(sector, count);
+
+	if (total < (int)(count * m_blocksize))
+		return total > 0 ? total : -1;
+
+	return total;
+}
+
+void CachedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
+{
+	m_lock.lock();
+
+	bool resident = m_blocksize != 0;
+	u32 lastChunk = (sector + count - 1) / CACHEDREADER_CHUNK_SECTORS;
+	for (u32 chunk = sector / CACHEDREADER_CHUNK_SECTORS; resident && chunk <= lastChunk; chunk++)
+		resident = m_chunks.find(chunk) != m_chunks.end();
+
+	if (resident)
+	{
+		m_pending_bytes = CopyFromCache(pBuffer, sector, count);
+		m_pending_cached = true;
+		UpdatePattern(sector, count);
+		m_lock.unlock();
+		return;
+	}
+
+	// Miss: hand the request to the backend and keep m_lock held until
+	// FinishRead/CancelRead so the worker stays off the source meanwhile.
+	m_pending_cached = false;
+	m_pending_lsn = sector;
+	m_pending_count = count;
+	m_source->BeginRead(pBuffer, sector, count);
+}
+
+int CachedFileReader::FinishRead(void)
+{
+	if (m_pending_cached)
+		return m_pending_bytes;
+
+	int ret = m_source->FinishRead();
+
+	// The EE thread already has its data; let the worker pull the covering
+	// chunks (plus readahead) into the cache in the background.
+	UpdatePattern(m_pending_lsn, m_pending_count);
+	QueuePrefetch(m_pending_lsn / CACHEDREADER_CHUNK_SECTORS,
+				  (m_pending_count + CACHEDREADER_CHUNK_SECTORS - 1) / CACHEDREADER_CHUNK_SECTORS + 1);
+
+	m_pending_cached = true;
+	m_pending_bytes = ret;
+	m_lock.unlock();
+
+	return ret;
+}
+
+void CachedFileReader::CancelRead(void)
+{
+	if (m_pending_cached)
+		return;
+
+	m_source->CancelRead();
+	m_pending_cached = true;
+	m_lock.unlock();
+}
+
+void CachedFileReader::PrefetchHint(uint sector, uint count)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+
+	if (m_blocksize == 0 || count == 0)
+		return;
+
+	u32 firstChunk = sector / CACHEDREADER_CHUNK_SECTORS;
+	u32 lastChunk = (sector + count - 1) / CACHEDREADER_CHUNK_SECTORS;
+
+	QueuePrefetch(firstChunk, lastChunk - firstChunk + 1);
+}
+
+void CachedFileReader::Close(void)
+{
+	// An async read may still be in flight (and holding m_lock) if the
+	// image is closed mid-read; resolve it before joining the worker.
+	if (!m_pending_cached)
+		CancelRead();
+
+	StopPrefetchThread();
+
+	m_chunks.clear();
+	m_cache_bytes = 0;
+
+	m_source->Close();
+}
+
+uint CachedFileReader::GetBlockCount(void) const
+{
+	return m_source->GetBlockCount();
+}
+
+void CachedFileReader::SetBlockSize(uint bytes)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+
+	m_source->SetBlockSize(bytes);
+	m_blocksize = bytes;
+
+	// Chunks are addressed in sectors of the old size; drop them.
+	m_chunks.clear();
+	m_cache_bytes = 0;
+	m_prefetchQueue.clear();
+	m_seq_streak = 0;
+}
+
+void CachedFileReader::SetDataOffset(int bytes)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+
+	m_source->SetDataOffset(bytes);
+	m_dataoffset = bytes;
+
+	m_chunks.clear();
+	m_cache_bytes = 0;
+	m_prefetchQueue.clear();
+	m_seq_streak = 0;
+}
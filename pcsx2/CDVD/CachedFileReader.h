@@ -0,0 +1,111 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2014  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "AsyncFileReader.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define CACHEDREADER_CACHE_SIZE_MB 256 /* default budget for cached sector data (in MB) */
+#define CACHEDREADER_CHUNK_SECTORS 64u /* sectors per cache chunk: 128KB at DVD block size */
+#define CACHEDREADER_MAX_READAHEAD 16u /* readahead ceiling while streaming, in chunks */
+
+// Decorates any AsyncFileReader with a block cache and an adaptive readahead
+// worker, so every backend (flat, multi-part, blockdump, compressed) shares
+// the same caching behavior.  Sequential access (FMV streaming, file copies)
+// widens the readahead window; random access shrinks it back to one chunk.
+// Eviction favours frequently re-read chunks, which keeps hot filesystem
+// metadata resident even on network-mounted images where every miss costs a
+// round trip.  The CDVD seek emulation feeds PrefetchHint() so the worker can
+// pull the destination sectors in while the game waits out the seek delay.
+class CachedFileReader : public AsyncFileReader
+{
+	DeclareNoncopyableObject(CachedFileReader);
+
+	struct CacheChunk
+	{
+		std::vector<u8> data;
+		u32 hits;
+		u64 tick;
+	};
+
+	AsyncFileReader* m_source;
+
+	// Guards the chunk map, the pattern state, the prefetch queue, and every
+	// call into m_source (the underlying readers are not thread-safe).
+	std::mutex m_lock;
+	std::unordered_map<u32, CacheChunk> m_chunks;
+	size_t m_cache_bytes;
+	size_t m_cache_limit;
+	u64 m_tick;
+
+	// Access pattern detection
+	uint m_last_end_lsn;
+	uint m_seq_streak;
+
+	// In-flight async read state.  On a cache miss BeginRead keeps m_lock
+	// held until FinishRead/CancelRead so the worker stays off the source.
+	bool m_pending_cached;
+	int m_pending_bytes;
+	uint m_pending_lsn;
+	uint m_pending_count;
+
+	std::deque<u32> m_prefetchQueue;
+	std::condition_variable m_prefetchCond;
+	std::thread m_prefetchThread;
+	bool m_prefetchRunning;
+
+	static uint m_cache_size_mb;
+
+public:
+	CachedFileReader(AsyncFileReader* source);
+	virtual ~CachedFileReader(void);
+
+	virtual bool Open(const wxString& fileName);
+
+	virtual int ReadSync(void* pBuffer, uint sector, uint count);
+
+	virtual void BeginRead(void* pBuffer, uint sector, uint count);
+	virtual int FinishRead(void);
+	virtual void CancelRead(void);
+
+	virtual void Close(void);
+
+	virtual uint GetBlockCount(void) const;
+
+	virtual void SetBlockSize(uint bytes);
+	virtual void SetDataOffset(int bytes);
+
+	virtual void PrefetchHint(uint sector, uint count);
+
+	// Returns the reader unchanged when caching is disabled.
+	static AsyncFileReader* Wrap(AsyncFileReader* reader);
+	static void SetCacheSize(uint megabytes) { m_cache_size_mb = megabytes; }
+
+protected:
+	CacheChunk* FetchChunk(u32 chunk, bool touch);
+	int CopyFromCache(void* pBuffer, uint sector, uint count);
+	void UpdatePattern(uint sector, uint count);
+	void QueuePrefetch(u32 firstChunk, u32 numChunks);
+	void EvictOverLimit(u32 keepChunk);
+	void StopPrefetchThread();
+	void PrefetchThreadProc();
+};
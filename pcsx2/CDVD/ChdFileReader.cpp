@@ -5,6 +5,12 @@
 
 #include <wx/dir.h>
 
+// Hunks decompressed ahead of the last demand read.  At the typical 256KB
+// DVD hunk size this keeps a couple of MB decoded in advance, enough to stay
+// ahead of FMV streaming without burning memory on idle discs.
+static const uint CHD_READAHEAD_HUNKS = 8;
+static const uint CHD_CHUNKCACHE_SIZE_MB = 16;
+
 
 bool ChdFileReader::CanHandle(const wxString &fileName)
 {
@@ -95,27 +101,138 @@ bool ChdFileReader::Open(const wxString &fileName)
     sector_size = header->unitbytes;
     sector_count = header->unitcount;
     sectors_per_hunk = header->hunkbytes / sector_size;
+    hunk_bytes = header->hunkbytes;
+    hunk_count = (sector_count + sectors_per_hunk - 1) / sectors_per_hunk;
     hunk_buffer = new u8[header->hunkbytes];
     current_hunk = -1;
 
+    m_shutdown = false;
+    m_request_pending = false;
+    m_readahead_base = 0;
+    m_readahead_thread = std::thread(&ChdFileReader::ReadaheadThreadProc, this);
+
     delete header;
     return true;
 }
 
+bool ChdFileReader::DecompressHunk(u32 hunk, u8 *dst)
+{
+    std::lock_guard<std::mutex> guard(m_chd_mutex);
+    chd_error error = chd_read(ChdFile, hunk, dst);
+    if (error != CHDERR_NONE) {
+      log_cb(RETRO_LOG_ERROR, "chd_read return error: %s\n", chd_error_string(error));
+      return false;
+    }
+    return true;
+}
+
+void ChdFileReader::QueueReadahead(u32 base_hunk)
+{
+    {
+      std::lock_guard<std::mutex> guard(m_notify_mutex);
+      m_readahead_base = base_hunk;
+      m_request_pending = true;
+    }
+    m_notify_cv.notify_one();
+}
+
+bool ChdFileReader::FetchHunk(u32 hunk, u8 *dst)
+{
+    PX_off_t offset = (PX_off_t)hunk * hunk_bytes;
+    {
+      std::lock_guard<std::mutex> guard(m_cache_mutex);
+      if (m_cache.Read(dst, offset, hunk_bytes) == (int)hunk_bytes) {
+        QueueReadahead(hunk);
+        return true;
+      }
+    }
+
+    if (!DecompressHunk(hunk, dst))
+      return false;
+
+    void *cached = malloc(hunk_bytes);
+    memcpy(cached, dst, hunk_bytes);
+    {
+      std::lock_guard<std::mutex> guard(m_cache_mutex);
+      m_cache.Take(cached, offset, hunk_bytes, hunk_bytes);
+    }
+    QueueReadahead(hunk);
+    return true;
+}
+
+void ChdFileReader::ReadaheadThreadProc()
+{
+    // Tracks the window already decoded so a stream of requests walking
+    // forward through it only costs the new hunks at its far end.
+    u32 window_base = 0;
+    u32 window_end = 0;
+    bool window_valid = false;
+
+    std::unique_lock<std::mutex> lock(m_notify_mutex);
+    while (!m_shutdown.load()) {
+      if (!m_request_pending) {
+        m_notify_cv.wait(lock);
+        continue;
+      }
+      m_request_pending = false;
+      u32 base = m_readahead_base;
+      lock.unlock();
+
+      u32 start = base + 1;
+      if (window_valid && base >= window_base && base <= window_end && window_end >= start)
+        start = window_end + 1;
+      u32 end = base + CHD_READAHEAD_HUNKS;
+      if (end >= hunk_count)
+        end = hunk_count ? hunk_count - 1 : 0;
+
+      for (u32 h = start; h <= end && !m_shutdown.load(); h++) {
+        u8 *buffer = (u8 *)malloc(hunk_bytes);
+        PX_off_t offset = (PX_off_t)h * hunk_bytes;
+        {
+          // A demand miss may have decoded this hunk while we got here.
+          std::lock_guard<std::mutex> guard(m_cache_mutex);
+          if (m_cache.Read(buffer, offset, hunk_bytes) == (int)hunk_bytes) {
+            free(buffer);
+            continue;
+          }
+        }
+        if (!DecompressHunk(h, buffer)) {
+          free(buffer);
+          break;
+        }
+        std::lock_guard<std::mutex> guard(m_cache_mutex);
+        m_cache.Take(buffer, offset, hunk_bytes, hunk_bytes);
+      }
+
+      window_base = base;
+      window_end = end;
+      window_valid = true;
+      lock.lock();
+    }
+}
+
+void ChdFileReader::StopReadaheadThread()
+{
+    if (!m_readahead_thread.joinable())
+      return;
+    {
+      std::lock_guard<std::mutex> guard(m_notify_mutex);
+      m_shutdown = true;
+    }
+    m_notify_cv.notify_one();
+    m_readahead_thread.join();
+    m_shutdown = false;
+}
+
 int ChdFileReader::ReadSync(void *pBuffer, uint sector, uint count)
 {
     u8 *dst = (u8 *) pBuffer;
     u32 hunk = sector / sectors_per_hunk;
     u32 sector_in_hunk = sector % sectors_per_hunk;
-    chd_error error;
 
     for (uint i = 0; i < count; i++) {
       if (current_hunk != hunk) {
-        error = chd_read(ChdFile, hunk, hunk_buffer);
-        if (error != CHDERR_NONE) {
-            log_cb(RETRO_LOG_ERROR, "chd_read return error: %s\n", chd_error_string(error));
-            // return i * m_blocksize;
-        }
+        FetchHunk(hunk, hunk_buffer);
         current_hunk = hunk;
       }
       memcpy(dst + i * m_blocksize, hunk_buffer + sector_in_hunk * sector_size, m_blocksize);
@@ -141,6 +258,11 @@ int ChdFileReader::FinishRead()
 
 void ChdFileReader::Close()
 {
+    StopReadaheadThread();
+    {
+      std::lock_guard<std::mutex> guard(m_cache_mutex);
+      m_cache.Clear();
+    }
     if (hunk_buffer != NULL) {
       //free(hunk_buffer);
       delete[] hunk_buffer;
@@ -167,7 +289,11 @@ u32 ChdFileReader::GetBlockCount() const
     return sector_count;
 }
 ChdFileReader::ChdFileReader(void)
+    : m_cache(CHD_CHUNKCACHE_SIZE_MB)
 {
   ChdFile = NULL;
   hunk_buffer = NULL;
+  m_shutdown = false;
+  m_request_pending = false;
+  m_readahead_base = 0;
 };
@@ -1,7 +1,13 @@
 #pragma once
 #include "AsyncFileReader.h"
+#include "ChunksCache.h"
 #include "libchdr/chd.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 class ChdFileReader : public AsyncFileReader
 {
     DeclareNoncopyableObject(ChdFileReader);
@@ -24,11 +30,35 @@ public:
     ChdFileReader(void);
 
 private:
+    // Fills dst with the given hunk, from the cache when possible, and kicks
+    // the readahead worker at the hunks following it.
+    bool FetchHunk(u32 hunk, u8 *dst);
+    // Runs chd_read under m_chd_mutex; chd_file is not safe for concurrent reads.
+    bool DecompressHunk(u32 hunk, u8 *dst);
+    void QueueReadahead(u32 base_hunk);
+    void StopReadaheadThread();
+    void ReadaheadThreadProc();
+
     chd_file *ChdFile;
     u8 *hunk_buffer;
     u32 sector_size;
     u32 sector_count;
     u32 sectors_per_hunk;
+    u32 hunk_bytes;
+    u32 hunk_count;
     u32 current_hunk;
     u32 async_read;
-};
\ No newline at end of file
+
+    // Readahead pipeline: a worker thread decompresses the hunks following
+    // the last demand read into the cache, so sequential access (FMV/audio
+    // streaming) finds them already decoded instead of stalling in chd_read.
+    ChunksCache m_cache;
+    std::thread m_readahead_thread;
+    std::mutex m_chd_mutex;
+    std::mutex m_cache_mutex; // ChunksCache itself is not thread-safe
+    std::mutex m_notify_mutex;
+    std::condition_variable m_notify_cv;
+    std::atomic<bool> m_shutdown;
+    bool m_request_pending;
+    u32 m_readahead_base;
+};
@@ -19,6 +19,7 @@
 #include "ChdFileReader.h"
 #include "CsoFileReader.h"
 #include "GzippedFileReader.h"
+#include "XzFileReader.h"
 
 // CompressedFileReader factory.
 AsyncFileReader* CompressedFileReader::GetNewReader(const wxString& fileName)
@@ -35,6 +36,10 @@ AsyncFileReader* CompressedFileReader::GetNewReader(const wxString& fileName)
 	{
 		return new CsoFileReader();
 	}
+	if (XzFileReader::CanHandle(fileName))
+	{
+		return new XzFileReader();
+	}
 	// This is the one which will fail on open.
 	return NULL;
 }
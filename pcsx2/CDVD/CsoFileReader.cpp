@@ -246,13 +246,6 @@ int CsoFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 				// We hit EOF.
 				break;
 			}
-
-#if CSO_USE_CHUNKSCACHE
-			// Add the bytes into the cache.  We need to allocate a buffer for it.
-			void* cached = malloc(readBytes);
-			memcpy(cached, dest + bytes, readBytes);
-			m_cache.Take(cached, pos + bytes, readBytes, readBytes);
-#endif
 		}
 
 		bytes += readBytes;
@@ -311,6 +304,19 @@ int CsoFileReader::ReadFromFrame(u8* dest, u64 pos, int maxBytes)
 			{
 				return 0;
 			}
+
+#if CSO_USE_CHUNKSCACHE
+			// Cache the whole frame rather than the bytes this read wants;
+			// the other sectors of the frame then hit the cache without
+			// another inflate.  Uncompressed frames aren't cached, a plain
+			// read is no slower than the cache copy.
+			void* cached = malloc(m_frameSize);
+			if (cached)
+			{
+				memcpy(cached, m_zlibBuffer, m_frameSize);
+				m_cache.Take(cached, (PX_off_t)frame << m_frameShift, m_frameSize, m_frameSize);
+			}
+#endif
 		}
 
 		// Now we just copy the offset data from the cache.
@@ -15,14 +15,14 @@
 
 #pragma once
 
-// Based on testing, the overhead of using this cache is high.
-//
-// The test was done with CSO files using a block size of 16KB.
-// Cache hit rates were observed in the range of 25%.
-// Cache overhead added 35% to the overall read time.
-//
-// For this reason, it's currently disabled.
-#define CSO_USE_CHUNKSCACHE 0
+// Decompressed frames are cached whole.  An earlier version cached the
+// 2KB slices handed back to the caller instead; with 16KB frames that
+// only saw ~25% hit rates while the per-sector bookkeeping added ~35%
+// to read time, so it shipped disabled.  Inserting at frame granularity
+// amortizes one cache entry over every sector of the frame, and any
+// revisit of a recently-inflated frame becomes a memcpy instead of
+// another seek+inflate.
+#define CSO_USE_CHUNKSCACHE 1
 
 #include "AsyncFileReader.h"
 #include "ChunksCache.h"
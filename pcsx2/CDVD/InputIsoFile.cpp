@@ -17,6 +17,7 @@
 #include "PrecompiledHeader.h"
 #include "IopCommon.h"
 #include "IsoFileFormats.h"
+#include "CachedFileReader.h"
 
 #include <errno.h>
 
@@ -39,6 +40,16 @@ static const char* nameFromType(int type)
 	}
 }
 
+// Hint from the CDVD seek emulation: the seek latency it is about to impose
+// tells us the data at the destination sector will be wanted shortly.
+void InputIsoFile::Prefetch(uint lsn, uint count)
+{
+	if (!m_reader || lsn >= m_blocks)
+		return;
+
+	m_reader->PrefetchHint(lsn, std::min(count, m_blocks - lsn));
+}
+
 int InputIsoFile::ReadSync(u8* dst, uint lsn)
 {
 	if (lsn >= m_blocks)
@@ -268,6 +279,10 @@ bool InputIsoFile::Open(const wxString& srcfile, bool testOnly)
 			delete m_reader_old;
 	}
 
+	// Wrap the final reader in the shared block cache.  This covers flat,
+	// multi-part, blockdump and compressed backends alike.
+	m_reader = CachedFileReader::Wrap(m_reader);
+
 	m_blocks = m_reader->GetBlockCount();
 
 	log_cb(RETRO_LOG_INFO, "isoFile open ok: %s\n", WX_STR(m_filename));
@@ -0,0 +1,334 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2014  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "XzFileReader.h"
+#include "CDVD/CompressedFileReaderUtils.h"
+
+#include <vector>
+
+// Uncompressed bytes the worker keeps decoded ahead of the last demand read.
+static const PX_off_t XZ_READAHEAD_BYTES = 16 * 1024 * 1024;
+static const uint XZ_CHUNKCACHE_SIZE_MB = 64;
+
+XzFileReader::XzFileReader(void)
+	: m_src(NULL)
+	, m_index(NULL)
+	, m_check(LZMA_CHECK_NONE)
+	, m_uncompressed_size(0)
+	, m_cache(XZ_CHUNKCACHE_SIZE_MB)
+	, m_shutdown(false)
+	, m_request_pending(false)
+	, m_readahead_pos(0)
+	, m_bytesRead(-1)
+{
+	m_blocksize = 2048;
+}
+
+bool XzFileReader::CanHandle(const wxString& fileName)
+{
+	return wxFileName::FileExists(fileName) && fileName.Lower().EndsWith(L".xz");
+}
+
+bool XzFileReader::Open(const wxString& fileName)
+{
+	m_filename = fileName;
+
+	if (!(m_src = PX_fopen_rb(m_filename)))
+		return false;
+
+	PX_fseeko(m_src, 0, SEEK_END);
+	PX_off_t file_size = ftello(m_src);
+	if (file_size < 2 * LZMA_STREAM_HEADER_SIZE)
+	{
+		log_cb(RETRO_LOG_ERROR, "Xz: file is too short to be an xz stream: %s\n", (const char*)m_filename.To8BitData());
+		Close();
+		return false;
+	}
+
+	// The block index sits right before the 12 byte stream footer, which
+	// records its size.  This is what makes xz seekable with nothing stored
+	// outside the file.
+	u8 footer[LZMA_STREAM_HEADER_SIZE];
+	PX_fseeko(m_src, file_size - LZMA_STREAM_HEADER_SIZE, SEEK_SET);
+	if (fread(footer, 1, sizeof(footer), m_src) != sizeof(footer))
+	{
+		Close();
+		return false;
+	}
+
+	lzma_stream_flags footer_flags;
+	if (lzma_stream_footer_decode(&footer_flags, footer) != LZMA_OK)
+	{
+		log_cb(RETRO_LOG_ERROR, "Xz: invalid stream footer: %s\n", (const char*)m_filename.To8BitData());
+		Close();
+		return false;
+	}
+
+	std::vector<u8> index_buf(footer_flags.backward_size);
+	PX_fseeko(m_src, file_size - LZMA_STREAM_HEADER_SIZE - footer_flags.backward_size, SEEK_SET);
+	if (fread(index_buf.data(), 1, index_buf.size(), m_src) != index_buf.size())
+	{
+		Close();
+		return false;
+	}
+
+	u64 memlimit = UINT64_MAX;
+	size_t in_pos = 0;
+	if (lzma_index_buffer_decode(&m_index, &memlimit, NULL, index_buf.data(), &in_pos, index_buf.size()) != LZMA_OK)
+	{
+		log_cb(RETRO_LOG_ERROR, "Xz: failed to decode the block index: %s\n", (const char*)m_filename.To8BitData());
+		m_index = NULL;
+		Close();
+		return false;
+	}
+
+	// Block offsets from the index assume a single stream starting at file
+	// offset 0; concatenated/padded files would need the full backward walk.
+	if ((PX_off_t)lzma_index_file_size(m_index) != file_size)
+	{
+		log_cb(RETRO_LOG_ERROR, "Xz: concatenated xz streams are not supported: %s\n", (const char*)m_filename.To8BitData());
+		Close();
+		return false;
+	}
+
+	m_check = footer_flags.check;
+	m_uncompressed_size = (PX_off_t)lzma_index_uncompressed_size(m_index);
+
+	if (lzma_index_block_count(m_index) <= 1 && m_uncompressed_size > (PX_off_t)64 * 1024 * 1024)
+		log_cb(RETRO_LOG_WARN, "Xz: %s was compressed as a single block; random access will be very slow. Recompress with e.g. `xz --block-size=4MiB`.\n",
+			   (const char*)m_filename.To8BitData());
+
+	m_shutdown = false;
+	m_request_pending = false;
+	m_readahead_pos = 0;
+	m_readahead_thread = std::thread(&XzFileReader::ReadaheadThreadProc, this);
+	return true;
+}
+
+bool XzFileReader::LocateBlock(PX_off_t offset, BlockInfo& info) const
+{
+	if (offset < 0 || offset >= m_uncompressed_size)
+		return false;
+
+	lzma_index_iter iter;
+	lzma_index_iter_init(&iter, m_index);
+	if (lzma_index_iter_locate(&iter, (lzma_vli)offset))
+		return false;
+
+	info.comp_offset = (PX_off_t)iter.block.compressed_file_offset;
+	info.comp_size = (PX_off_t)iter.block.total_size;
+	info.out_offset = (PX_off_t)iter.block.uncompressed_file_offset;
+	info.out_size = (PX_off_t)iter.block.uncompressed_size;
+	return true;
+}
+
+bool XzFileReader::DecodeBlock(const BlockInfo& info, u8* dst)
+{
+	std::vector<u8> comp(info.comp_size);
+	{
+		std::lock_guard<std::mutex> guard(m_file_mutex);
+		PX_fseeko(m_src, info.comp_offset, SEEK_SET);
+		if (fread(comp.data(), 1, comp.size(), m_src) != comp.size())
+			return false;
+	}
+
+	lzma_filter filters[LZMA_FILTERS_MAX + 1];
+	lzma_block block;
+	memset(&block, 0, sizeof(block));
+	block.version = 1;
+	block.check = m_check;
+	block.filters = filters;
+	block.header_size = lzma_block_header_size_decode(comp[0]);
+	if (block.header_size > comp.size() || lzma_block_header_decode(&block, NULL, comp.data()) != LZMA_OK)
+	{
+		log_cb(RETRO_LOG_ERROR, "Xz: bad block header at offset %lld\n", (long long)info.comp_offset);
+		return false;
+	}
+
+	size_t in_pos = 0;
+	size_t out_pos = 0;
+	lzma_ret ret = lzma_block_buffer_decode(&block, NULL,
+											comp.data() + block.header_size, &in_pos, comp.size() - block.header_size,
+											dst, &out_pos, (size_t)info.out_size);
+	for (int i = 0; filters[i].id != LZMA_VLI_UNKNOWN; i++)
+		free(filters[i].options);
+
+	if (ret != LZMA_OK || out_pos != (size_t)info.out_size)
+	{
+		log_cb(RETRO_LOG_ERROR, "Xz: block decode failed at offset %lld (%d)\n", (long long)info.comp_offset, (int)ret);
+		return false;
+	}
+	return true;
+}
+
+void XzFileReader::QueueReadahead(PX_off_t offset)
+{
+	{
+		std::lock_guard<std::mutex> guard(m_notify_mutex);
+		m_readahead_pos = offset;
+		m_request_pending = true;
+	}
+	m_notify_cv.notify_one();
+}
+
+int XzFileReader::_ReadSync(void* pBuffer, PX_off_t offset, uint bytesToRead)
+{
+	u8* dst = (u8*)pBuffer;
+	int done = 0;
+
+	while (bytesToRead > 0)
+	{
+		BlockInfo info;
+		if (!LocateBlock(offset, info))
+			break; // EOF
+
+		int take = std::min((PX_off_t)bytesToRead, info.out_offset + info.out_size - offset);
+		{
+			std::lock_guard<std::mutex> guard(m_cache_mutex);
+			if (m_cache.Read(dst, offset, take) == take)
+			{
+				QueueReadahead(info.out_offset + info.out_size);
+				dst += take;
+				offset += take;
+				done += take;
+				bytesToRead -= take;
+				continue;
+			}
+		}
+
+		u8* decoded = (u8*)malloc(info.out_size);
+		if (!DecodeBlock(info, decoded))
+		{
+			free(decoded);
+			return done ? done : -1;
+		}
+		memcpy(dst, decoded + (offset - info.out_offset), take);
+		{
+			std::lock_guard<std::mutex> guard(m_cache_mutex);
+			m_cache.Take(decoded, info.out_offset, info.out_size, info.out_size);
+		}
+		QueueReadahead(info.out_offset + info.out_size);
+
+		dst += take;
+		offset += take;
+		done += take;
+		bytesToRead -= take;
+	}
+	return done;
+}
+
+void XzFileReader::ReadaheadThreadProc()
+{
+	std::unique_lock<std::mutex> lock(m_notify_mutex);
+	while (!m_shutdown.load())
+	{
+		if (!m_request_pending)
+		{
+			m_notify_cv.wait(lock);
+			continue;
+		}
+		m_request_pending = false;
+		PX_off_t pos = m_readahead_pos;
+		lock.unlock();
+
+		PX_off_t limit = pos + XZ_READAHEAD_BYTES;
+		while (pos < limit && !m_shutdown.load())
+		{
+			BlockInfo info;
+			if (!LocateBlock(pos, info))
+				break;
+
+			u8* decoded = (u8*)malloc(info.out_size);
+			{
+				// The demand path may have beaten us to this block.
+				std::lock_guard<std::mutex> guard(m_cache_mutex);
+				if (m_cache.Read(decoded, info.out_offset, (int)info.out_size) == (int)info.out_size)
+				{
+					free(decoded);
+					pos = info.out_offset + info.out_size;
+					continue;
+				}
+			}
+			if (!DecodeBlock(info, decoded))
+			{
+				free(decoded);
+				break;
+			}
+			{
+				std::lock_guard<std::mutex> guard(m_cache_mutex);
+				m_cache.Take(decoded, info.out_offset, info.out_size, info.out_size);
+			}
+			pos = info.out_offset + info.out_size;
+		}
+
+		lock.lock();
+	}
+}
+
+void XzFileReader::StopReadaheadThread()
+{
+	if (!m_readahead_thread.joinable())
+		return;
+	{
+		std::lock_guard<std::mutex> guard(m_notify_mutex);
+		m_shutdown = true;
+	}
+	m_notify_cv.notify_one();
+	m_readahead_thread.join();
+	m_shutdown = false;
+}
+
+int XzFileReader::ReadSync(void* pBuffer, uint sector, uint count)
+{
+	PX_off_t offset = (s64)sector * m_blocksize + m_dataoffset;
+	return _ReadSync(pBuffer, offset, count * m_blocksize);
+}
+
+void XzFileReader::BeginRead(void* pBuffer, uint sector, uint count)
+{
+	m_bytesRead = ReadSync(pBuffer, sector, count);
+}
+
+int XzFileReader::FinishRead(void)
+{
+	int res = m_bytesRead;
+	m_bytesRead = -1;
+	return res;
+}
+
+void XzFileReader::Close(void)
+{
+	StopReadaheadThread();
+	{
+		std::lock_guard<std::mutex> guard(m_cache_mutex);
+		m_cache.Clear();
+	}
+	if (m_index)
+	{
+		lzma_index_end(m_index, NULL);
+		m_index = NULL;
+	}
+	if (m_src)
+	{
+		fclose(m_src);
+		m_src = NULL;
+	}
+}
+
+uint XzFileReader::GetBlockCount(void) const
+{
+	return (uint)((m_uncompressed_size - m_dataoffset) / m_blocksize);
+}
@@ -17,6 +17,7 @@
 #include "PrecompiledHeader.h"
 #include "Common.h"
 #include "COP0.h"
+#include "Cache.h"
 
 u32 s_iLastCOP0Cycle = 0;
 u32 s_iLastPERFCycle[2] = { 0, 0 };
@@ -138,6 +139,7 @@ void MapTLB(int i)
 
 	if (tlb[i].VPN2 == 0x70000000) return; //uh uhh right ...
 	if (tlb[i].EntryLo0 & 0x2) {
+		const bool cached = ((tlb[i].EntryLo0 >> 3) & 0x7) == 0x3;
 		mask  = ((~tlb[i].Mask) << 1) & 0xfffff;
 		saddr = tlb[i].VPN2 >> 12;
 		eaddr = saddr + tlb[i].Mask + 1;
@@ -145,12 +147,14 @@ void MapTLB(int i)
 		for (addr=saddr; addr<eaddr; addr++) {
 			if ((addr & mask) == ((tlb[i].VPN2 >> 12) & mask)) { //match
 				memSetPageAddr(addr << 12, tlb[i].PFN0 + ((addr - saddr) << 12));
+				cacheSetPageState(addr << 12, cached);
 				Cpu->Clear(addr << 12, 0x400);
 			}
 		}
 	}
 
 	if (tlb[i].EntryLo1 & 0x2) {
+		const bool cached = ((tlb[i].EntryLo1 >> 3) & 0x7) == 0x3;
 		mask  = ((~tlb[i].Mask) << 1) & 0xfffff;
 		saddr = (tlb[i].VPN2 >> 12) + tlb[i].Mask + 1;
 		eaddr = saddr + tlb[i].Mask + 1;
@@ -158,6 +162,7 @@ void MapTLB(int i)
 		for (addr=saddr; addr<eaddr; addr++) {
 			if ((addr & mask) == ((tlb[i].VPN2 >> 12) & mask)) { //match
 				memSetPageAddr(addr << 12, tlb[i].PFN1 + ((addr - saddr) << 12));
+				cacheSetPageState(addr << 12, cached);
 				Cpu->Clear(addr << 12, 0x400);
 			}
 		}
@@ -185,6 +190,7 @@ void UnmapTLB(int i)
 		for (addr=saddr; addr<eaddr; addr++) {
 			if ((addr & mask) == ((tlb[i].VPN2 >> 12) & mask)) { //match
 				memClearPageAddr(addr << 12);
+				cacheSetPageState(addr << 12, false);
 				Cpu->Clear(addr << 12, 0x400);
 			}
 		}
@@ -198,6 +204,7 @@ void UnmapTLB(int i)
 		for (addr=saddr; addr<eaddr; addr++) {
 			if ((addr & mask) == ((tlb[i].VPN2 >> 12) & mask)) { //match
 				memClearPageAddr(addr << 12);
+				cacheSetPageState(addr << 12, false);
 				Cpu->Clear(addr << 12, 0x400);
 			}
 		}
@@ -163,29 +163,71 @@ namespace
 
 	static Cache cache;
 
+	// Last line accessed: repeated hits to the same line (the overwhelmingly
+	// common pattern) skip the vmap translation and tag compare entirely.
+	// Updated on every lookup, so it can never name an evicted way; CACHE
+	// index/hit ops and resetCache invalidate it.
+	static u32 s_lastLine = ~0u;
+	static int s_lastIdx = 0;
+	static int s_lastWay = 0;
+
+}
+
+bool g_eeCacheEnable = false;
+u32 g_cachedPageBitmap[(1 << 20) / 32];
+u32 g_cachedPageCount = 0;
+
+void cacheSetPageState(u32 vaddr, bool cached)
+{
+	const u32 page = vaddr >> 12;
+	u32& word = g_cachedPageBitmap[page >> 5];
+	const u32 bit = 1u << (page & 31);
+
+	// Remaps can change where a cached vaddr points; drop the line memo.
+	s_lastLine = ~0u;
+
+	if (cached && g_eeCacheEnable)
+	{
+		if (!(word & bit))
+		{
+			word |= bit;
+			g_cachedPageCount++;
+		}
+	}
+	else if (word & bit)
+	{
+		word &= ~bit;
+		g_cachedPageCount--;
+	}
 }
 
 void resetCache()
 {
 	memzero(cache);
+	memzero(g_cachedPageBitmap);
+	g_cachedPageCount = 0;
+	s_lastLine = ~0u;
 }
 
 static bool findInCache(const CacheSet& set, uptr ppf, int* way)
 {
-	auto check = [&](int checkWay) -> bool
-	{
-		if (!set.tags[checkWay].matches(ppf))
-			return false;
+	// Both ways are checked branch-free; the EE dcache is 2-way.
+	const bool m0 = set.tags[0].matches(ppf);
+	const bool m1 = set.tags[1].matches(ppf);
 
-		*way = checkWay;
-		return true;
-	};
+	*way = m1;
 
-	return check(0) || check(1);
+	return m0 | m1;
 }
 
 static int getFreeCache(u32 mem, int* way)
 {
+	if ((mem & ~0x3fu) == s_lastLine)
+	{
+		*way = s_lastWay;
+		return s_lastIdx;
+	}
+
 	const int setIdx = cache.setIdxFor(mem);
 	CacheSet& set = cache.sets[setIdx];
 	VTLBVirtual vmv = vtlbdata.vmap[mem >> VTLB_PAGE_BITS];
@@ -215,6 +257,10 @@ static int getFreeCache(u32 mem, int* way)
 		line.tag.toggleLRF();
 	}
 
+	s_lastLine = mem & ~0x3fu;
+	s_lastIdx = setIdx;
+	s_lastWay = *way;
+
 	return setIdx;
 }
 
@@ -303,6 +349,16 @@ u64 readCache64(u32 mem)
 	return readCache<u64>(mem);
 }
 
+void readCache128(u32 mem, mem128_t* out)
+{
+	int way = 0;
+	const int idx = getFreeCache(mem, &way);
+
+	CacheLine line = cache.lineAt(idx, way);
+	u32 aligned = mem & ~0xF;
+	CopyQWC(out, &line.data.bytes[aligned & 0x3f]);
+}
+
 template <typename Op>
 void doCacheHitOp(u32 addr, const char* name, Op op)
 {
@@ -339,6 +395,9 @@ void CACHE()
 	u32 addr = cpuRegs.GPR.r[_Rs_].UL[0] + _Imm_;
 	// CACHE_LOG("cpuRegs.GPR.r[_Rs_].UL[0] = %x, IMM = %x RT = %x", cpuRegs.GPR.r[_Rs_].UL[0], _Imm_, _Rt_);
 
+	// Any of these ops may invalidate or reload the memoized line.
+	s_lastLine = ~0u;
+
 	switch (_Rt_) 
 	{
 		case 0x1a: //DHIN (Data Cache Hit Invalidate)
@@ -28,5 +28,26 @@ u8 readCache8(u32 mem);
 u16 readCache16(u32 mem);
 u32 readCache32(u32 mem);
 u64 readCache64(u32 mem);
+void readCache128(u32 mem, mem128_t* out);
+
+// Optional EE data cache emulation, built around the vtlb: MapTLB marks pages
+// mapped with cache mode 3 in a per-page bitmap, and only accesses to those
+// pages pay the tag check in the vtlb memory ops.  Off by default; most
+// useful together with the EE interpreter for the handful of titles that
+// depend on cache behavior.
+extern bool g_eeCacheEnable;
+extern u32 g_cachedPageBitmap[(1 << 20) / 32];
+extern u32 g_cachedPageCount;
+
+void cacheSetPageState(u32 vaddr, bool cached);
+
+// Hot check inlined into the vtlb memory ops: skipped entirely while no
+// cached pages are mapped, one load and a bit test otherwise.
+#define CHECK_CACHE (g_cachedPageCount != 0)
+
+static __fi bool CacheCheckPage(u32 addr)
+{
+	return (g_cachedPageBitmap[addr >> 17] >> ((addr >> 12) & 31)) & 1;
+}
 
 #endif /* __CACHE_H__ */
@@ -313,6 +313,12 @@ struct Pcsx2Config
 
 extern Pcsx2Config EmuConfig;
 
+// Deterministic execution mode (netplay / lockstep): forces off the host-
+// scheduling-dependent paths (MTVU), pins the RTC seed, and hashes the
+// architectural state once per frame so diverging peers can be diffed to
+// the frame.  Set from the frontend before the VM boots.
+extern bool g_DeterministicMode;
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // Helper Macros for Reading Emu Configurations.
 //
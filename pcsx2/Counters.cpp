@@ -27,7 +27,9 @@
 #include "IopCounters.h"
 
 #include "GS.h"
+#include "PerfStats.h"
 #include "VUmicro.h"
+#include "Utilities/Crc32.h"
 
 #include "ps2/HwInternal.h"
 
@@ -364,6 +366,10 @@ void UpdateVSyncRate()
 	{
 		vSyncInfo.VideoMode = gsVideoMode;
 		vSyncInfoCalc( &vSyncInfo, framerate, scanlines );
+
+		// One host frame per field, so the telemetry's expected frame period
+		// is the field rate (framerate counts full frames).
+		PerfStats::SetVSyncRate(framerate.ToFloat() * 2);
 		
 		hsyncCounter.CycleT = vSyncInfo.hRender;	// Amount of cycles before the counter will be updated
 		vsyncCounter.CycleT = vSyncInfo.Render;		// Amount of cycles before the counter will be updated
@@ -392,8 +398,36 @@ void UpdateVSyncRate()
 #endif
 }
 
+// Deterministic mode: fold the architectural state into a running hash once
+// per frame and log it periodically, so two peers (or a recording and its
+// replay) can be diffed down to a 60-frame window around the first diverging
+// frame.  Register files and scratchpad cover the state games touch every
+// frame without paying for a hash of all of main memory; pointers inside the
+// VU structs are host addresses and deliberately excluded.
+static void DeterministicStateHash()
+{
+	static u32 s_hash = 0xffffffffu;
+	static u32 s_frame = 0;
+
+	u32 h = s_hash;
+	h = crc32c_update(h, &cpuRegs, sizeof(cpuRegs));
+	h = crc32c_update(h, &VU0.VF, sizeof(VU0.VF));
+	h = crc32c_update(h, &VU0.VI, sizeof(VU0.VI));
+	h = crc32c_update(h, &VU1.VF, sizeof(VU1.VF));
+	h = crc32c_update(h, &VU1.VI, sizeof(VU1.VI));
+	h = crc32c_update(h, eeMem->Scratch, sizeof(eeMem->Scratch));
+	s_hash = h;
+
+	if (++s_frame % 60 == 0)
+		log_cb(RETRO_LOG_INFO, "State hash @ frame %u: %08X\n", s_frame, s_hash);
+}
+
 static __fi void VSyncStart(u32 sCycle)
 {
+	PerfStats::FrameBoundaryEE();
+
+	if (g_DeterministicMode)
+		DeterministicStateHash();
 	GetCoreThread().VsyncInThread();
 	Cpu->CheckExecutionState();
 
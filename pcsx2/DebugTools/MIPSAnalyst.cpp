@@ -21,6 +21,11 @@
 #include "DebugInterface.h"
 #include "../R5900.h"
 #include "../R5900OpcodeTables.h"
+#include "../Elfheader.h"
+#include "../PathDefs.h"
+#include "../CDVD/CDVD.h"
+
+#include <wx/ffile.h>
 
 static std::vector<MIPSAnalyst::AnalyzedFunction> functions;
 
@@ -322,6 +327,71 @@ namespace MIPSAnalyst
 		}
 	}
 
+	// --------------------------------------------------------------------------------------
+	//  Function scan cache
+	// --------------------------------------------------------------------------------------
+	// The boundary scan is pure analysis of the ELF text segment, so its result depends
+	// only on the code bytes.  Persist it keyed the same way as the savestates and the
+	// EE block cache ("<serial> (<crc>)"); later sessions of the same ELF skip the walk
+	// entirely and just replay the function list into the symbol map.
+
+	static const u32 FNSCANCACHE_MAGIC   = 0x53594545; // 'EESY'
+	static const u32 FNSCANCACHE_VERSION = 1;
+
+	static wxString FunctionScanCacheFilename() {
+		wxString serialName( DiscSerial );
+		if (serialName.IsEmpty()) serialName = L"BIOS";
+
+		return Path::Combine(PathDefs::GetSavestates().ToString(), pxsFmt(L"%s (%08X).eesyms", WX_STR(serialName), ElfCRC));
+	}
+
+	void SaveFunctionScanCache(u32 startAddr, u32 endAddr) {
+		wxFFile file(FunctionScanCacheFilename(), L"wb");
+		if (!file.IsOpened())
+			return;
+
+		const u32 count = (u32)functions.size();
+		file.Write(&FNSCANCACHE_MAGIC, sizeof(u32));
+		file.Write(&FNSCANCACHE_VERSION, sizeof(u32));
+		file.Write(&ElfCRC, sizeof(u32));
+		file.Write(&startAddr, sizeof(u32));
+		file.Write(&endAddr, sizeof(u32));
+		file.Write(&count, sizeof(u32));
+		if (count)
+			file.Write(functions.data(), count * sizeof(AnalyzedFunction));
+	}
+
+	bool LoadFunctionScanCache(u32 startAddr, u32 endAddr, bool insertSymbols) {
+		wxFFile file(FunctionScanCacheFilename(), L"rb");
+		if (!file.IsOpened())
+			return false;
+
+		u32 header[6] = {0};
+		if (file.Read(header, sizeof(header)) != sizeof(header))
+			return false;
+		if (header[0] != FNSCANCACHE_MAGIC || header[1] != FNSCANCACHE_VERSION)
+			return false;
+		// ElfCRC already keys the filename, but verify it (and the scanned range)
+		// so a stale or truncated file can never inject bogus boundaries.
+		if (header[2] != ElfCRC || header[3] != startAddr || header[4] != endAddr)
+			return false;
+
+		const u32 count = header[5];
+		std::vector<AnalyzedFunction> cached(count);
+		if (count && file.Read(cached.data(), count * sizeof(AnalyzedFunction)) != count * sizeof(AnalyzedFunction))
+			return false;
+
+		functions = std::move(cached);
+
+		if (insertSymbols) {
+			for (auto iter = functions.begin(); iter != functions.end(); iter++) {
+				char temp[256];
+				symbolMap.AddFunction(DefaultFunctionName(temp, iter->start), iter->start, iter->size);
+			}
+		}
+		return true;
+	}
+
 	MipsOpcodeInfo GetOpcodeInfo(DebugInterface* cpu, u32 address) {
 		MipsOpcodeInfo info;
 		memset(&info, 0, sizeof(info));
@@ -41,6 +41,12 @@ namespace MIPSAnalyst
 
 	void ScanForFunctions(u32 startAddr, u32 endAddr, bool insertSymbols);
 
+	// Persistent cache of a previous ScanForFunctions result, keyed on the
+	// loaded ELF (serial + CRC + scanned range).  Load returns false when no
+	// valid cache exists, in which case run the scan and save it.
+	bool LoadFunctionScanCache(u32 startAddr, u32 endAddr, bool insertSymbols);
+	void SaveFunctionScanCache(u32 startAddr, u32 endAddr);
+
 	enum LoadStoreLRType { LOADSTORE_NORMAL, LOADSTORE_LEFT, LOADSTORE_RIGHT };
 
 	typedef struct {
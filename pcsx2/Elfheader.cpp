@@ -304,6 +304,20 @@ void ElfObject::loadHeaders()
 	loadSectionHeaders();
 }
 
+// GetPS2ElfName gets hit several times per boot (disc detection, BIOS key
+// decryption, savestate headers), and every call re-reads the PVD, the root
+// directory and SYSTEM.CNF through the CDVD layer.  The answer only changes
+// with the disc, so memoize recognized results; the cache is reset from the
+// same place as the disk type cache when the media changes.
+static wxString s_elfNameCached;
+static int s_elfTypeCached = -1;
+
+void ResetPS2ElfNameCache()
+{
+	s_elfTypeCached = -1;
+	s_elfNameCached.Clear();
+}
+
 // return value:
 //   0 - Invalid or unknown disc.
 //   1 - PS1 CD
@@ -312,6 +326,12 @@ int GetPS2ElfName( wxString& name )
 {
 	int retype = 0;
 
+	if (s_elfTypeCached >= 0)
+	{
+		name = s_elfNameCached;
+		return s_elfTypeCached;
+	}
+
 	try {
 		IsoFSCDVD isofs;
 		IsoFile file( isofs, L"SYSTEM.CNF;1");
@@ -370,5 +390,10 @@ int GetPS2ElfName( wxString& name )
 		return 0;		// ISO error
 	}
 
+	// Only recognized discs are cached; failures may be transient (tray
+	// transitions, stream errors) and are cheap to re-detect anyway.
+	s_elfNameCached = name;
+	s_elfTypeCached = retype;
+
 	return retype;
 }
@@ -162,6 +162,7 @@ class ElfObject
 //-------------------
 extern void loadElfFile(const wxString& filename);
 extern int  GetPS2ElfName( wxString& dest );
+extern void ResetPS2ElfNameCache();
 
 
 extern u32 ElfCRC;
@@ -39,6 +39,31 @@
 // 0x6000 - 0x7000 : GS    (all registers map to 0x6000)
 // 0x7000 - 0x8000 : IPU   (registers map to 0x7000 and 0x7010, respectively)
 
+// --------------------------------------------------------------------------------------
+//  GS download read-ahead staging
+// --------------------------------------------------------------------------------------
+// Games that poll a GS download out through the VIF1 FIFO used to pay two full MTGS
+// round trips (ring drain + read packet) per qword.  Instead, the first read of a
+// burst pulls a whole FIFO's worth (up to 16 qwords, matching FQC) through the same
+// bulk path the DMA download uses, and the following reads are served locally.  The
+// DMA download path drains this staging first so mixed FIFO/DMA downloads keep
+// consuming one contiguous stream, and the buffer is frozen with VIF1 state since
+// its content has already advanced the GS-side transfer position.
+__aligned16 u128 g_vif1ReadStaging[16];
+u32 g_vif1ReadStagingCount = 0;
+u32 g_vif1ReadStagingPos = 0;
+
+u32 vif1ReadStagingDrain(u128* dst, u32 max)
+{
+	const u32 n = std::min(max, g_vif1ReadStagingCount - g_vif1ReadStagingPos);
+
+	if (n) {
+		memcpy(dst, &g_vif1ReadStaging[g_vif1ReadStagingPos], n * 16);
+		g_vif1ReadStagingPos += n;
+	}
+	return n;
+}
+
 void __fastcall ReadFIFO_VIF1(mem128_t* out)
 {
 #ifndef NDEBUG
@@ -55,10 +80,17 @@ void __fastcall ReadFIFO_VIF1(mem128_t* out)
 		}
 #endif
 		if (vif1Regs.stat.FQC > 0) {
-			GetMTGS().WaitGS();
-			GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO1, 0, out);
-			GetMTGS().WaitGS(false); // wait without reg sync
-			GSreadFIFO((u64*)out);
+			if (g_vif1ReadStagingPos == g_vif1ReadStagingCount) {
+				const u32 fill = std::min(vif1.GSLastDownloadSize, (u32)16);
+				if (fill == 0) return;
+				GetMTGS().WaitGS();
+				GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO2, fill, g_vif1ReadStaging);
+				GetMTGS().WaitGS(false); // wait without reg sync
+				GSreadFIFO2((u8*)g_vif1ReadStaging, fill);
+				g_vif1ReadStagingCount = fill;
+				g_vif1ReadStagingPos = 0;
+			}
+			CopyQWC(out, &g_vif1ReadStaging[g_vif1ReadStagingPos++]);
 			vif1.GSLastDownloadSize--;
 			GUNIT_LOG("ReadFIFO_VIF1");
 			if (vif1.GSLastDownloadSize <= 16)
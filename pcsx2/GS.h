@@ -316,10 +316,19 @@ class SysMtgsThread : public SysThreadBase
 public:
 	// note: when m_ReadPos == m_WritePos, the fifo is empty
 	// Threading info: m_ReadPos is updated by the MTGS thread. m_WritePos is updated by the EE thread
-	std::atomic<unsigned int> m_ReadPos;  // cur pos gs is reading from
-	std::atomic<unsigned int> m_WritePos; // cur pos ee thread is writing to
-
-	std::atomic<bool>	m_RingBufferIsBusy;
+	// Each position gets its own cache line: the MTGS thread hammers m_ReadPos while
+	// the EE thread hammers m_WritePos, and having them share a line turns every
+	// position update into a coherency miss for the other thread.
+	__aligned(64) std::atomic<unsigned int> m_ReadPos;  // cur pos gs is reading from
+	__aligned(64) std::atomic<unsigned int> m_WritePos; // cur pos ee thread is writing to
+
+	// EE-thread-local copy of m_ReadPos. The reader only ever advances it, so free
+	// room computed from a stale copy is an underestimate and always safe; the
+	// acquire load (and the cache miss that comes with it) is only paid when the
+	// cached value no longer shows enough room.
+	uint m_CachedReadPos;
+
+	__aligned(64) std::atomic<bool>	m_RingBufferIsBusy;
 	std::atomic<bool>	m_SignalRingEnable;
 	std::atomic<int>	m_SignalRingPosition;
 
@@ -340,6 +349,13 @@ public:
 	// has more than one command in it when the thread is kicked.
 	int				m_CopyDataTally;
 
+#ifdef __LIBRETRO__
+	// When set, ExecuteTaskInThread() consumes whatever is already queued and
+	// returns as soon as the ring runs dry, instead of stopping at a vsync or
+	// waiting for more work.  Only ever set by DrainTaskInThread().
+	bool			m_Draining;
+#endif
+
 	Semaphore			m_sem_OpenDone;
 	std::atomic<bool>	m_Opened;
 
@@ -377,6 +393,9 @@ public:
 
 	void ExecuteTaskInThread();
 	void FinishTaskInThread();
+#ifdef __LIBRETRO__
+	void DrainTaskInThread();
+#endif
 	void OpenGS();
 	void CloseGS();
 
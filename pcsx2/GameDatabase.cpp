@@ -152,6 +152,22 @@ GameDatabaseSchema::GameEntry YamlGameDatabaseImpl::entryFromYaml(const std::str
 			}
 		}
 
+		// Validate execution policies, invalid ones will be dropped!
+		for (std::string& policy : node["execPolicies"].as<std::vector<std::string>>(std::vector<std::string>()))
+		{
+			unsigned int start = 0, end = 0;
+			if (sscanf(policy.c_str(), "interpret=%x-%x", &start, &end) == 2 ||
+				sscanf(policy.c_str(), "syncrec=%x-%x", &start, &end) == 2)
+			{
+				if (start < end)
+				{
+					gameEntry.execPolicies.push_back(policy);
+					continue;
+				}
+			}
+			log_cb(RETRO_LOG_ERROR, "[GameDB] Invalid execPolicy: '%s', specified for serial: '%s'. Dropping!\n", policy.c_str(), serial.c_str());
+		}
+
 		gameEntry.memcardFilters = node["memcardFilters"].as<std::vector<std::string>>(std::vector<std::string>());
 
 		if (YAML::Node patches = node["patches"])
@@ -195,6 +211,27 @@ GameDatabaseSchema::GameEntry YamlGameDatabaseImpl::findGame(const std::string s
 		return gameDb[serialLower];
 	}
 
+	// Lazy database: parse just this entry's slice of the source on demand.
+	auto indexed = entryIndex.find(serialLower);
+	if (indexed != entryIndex.end())
+	{
+		log_cb(RETRO_LOG_INFO, "[GameDB] Found '%s' in GameDB\n", serialLower.c_str());
+		try
+		{
+			YAML::Node node = YAML::Load(rawDb.substr(indexed->second.first, indexed->second.second));
+			if (node.IsMap() && node.size() == 1)
+			{
+				GameDatabaseSchema::GameEntry entry = entryFromYaml(serialLower, node.begin()->second);
+				gameDb[serialLower] = entry;
+				return entry;
+			}
+			log_cb(RETRO_LOG_ERROR, "[GameDB] Invalid GameDB syntax detected on serial: '%s'\n", serialLower.c_str());
+		} catch (const std::exception& e)
+		{
+			log_cb(RETRO_LOG_ERROR, "[GameDB] Error occured when reading serial '%s': %s\n", serialLower.c_str(), e.what());
+		}
+	}
+
 	log_cb(RETRO_LOG_ERROR, "[GameDB] Could not find '%s' in GameDB\n", serialLower.c_str());
 	GameDatabaseSchema::GameEntry entry;
 	entry.isValid = false;
@@ -203,7 +240,57 @@ GameDatabaseSchema::GameEntry YamlGameDatabaseImpl::findGame(const std::string s
 
 int YamlGameDatabaseImpl::numGames()
 {
-	return gameDb.size();
+	return entryIndex.empty() ? gameDb.size() : entryIndex.size();
+}
+
+bool YamlGameDatabaseImpl::initDatabaseLazy(std::string dbText)
+{
+	rawDb = std::move(dbText);
+	entryIndex.clear();
+
+	// Top-level entries start in column 0 ("SLUS-12345:"); everything else is
+	// a comment, a blank line, or indented content belonging to the previous
+	// entry.  Record the byte range of each entry so findGame can parse the
+	// one it needs and leave the rest as plain text.
+	const size_t size = rawDb.size();
+
+	std::string current; // serial of the entry currently being scanned
+	size_t start = 0;
+	size_t pos = 0;
+
+	while (pos < size)
+	{
+		size_t eol = rawDb.find('\n', pos);
+		if (eol == std::string::npos)
+			eol = size;
+
+		const char c = rawDb[pos];
+		if (c != ' ' && c != '\t' && c != '#' && c != '\n' && c != '\r')
+		{
+			const size_t colon = rawDb.find(':', pos);
+			if (colon != std::string::npos && colon < eol)
+			{
+				if (!current.empty() && !entryIndex.emplace(current, std::make_pair(start, pos - start)).second)
+					log_cb(RETRO_LOG_ERROR, "[GameDB] Duplicate serial '%s' found in GameDB. Skipping, Serials are case-insensitive!\n", current.c_str());
+
+				current = strToLower(rawDb.substr(pos, colon - pos));
+				start = pos;
+			}
+		}
+
+		pos = eol + 1;
+	}
+
+	if (!current.empty() && !entryIndex.emplace(current, std::make_pair(start, size - start)).second)
+		log_cb(RETRO_LOG_ERROR, "[GameDB] Duplicate serial '%s' found in GameDB. Skipping, Serials are case-insensitive!\n", current.c_str());
+
+	if (entryIndex.empty())
+	{
+		log_cb(RETRO_LOG_ERROR, "[GameDB] No entries found in GameDB file.\n");
+		return false;
+	}
+
+	return true;
 }
 
 bool YamlGameDatabaseImpl::initDatabase(std::istream& stream)
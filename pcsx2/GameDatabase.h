@@ -74,6 +74,9 @@ public:
 		ClampMode vuClampMode = ClampMode::Undefined;
 		std::vector<std::string> gameFixes;
 		std::unordered_map<std::string, int> speedHacks;
+		// Per-range execution policies, e.g. "interpret=0x00123440-0x00123600";
+		// valid policies are interpret and syncrec.  See EEExecPolicy.
+		std::vector<std::string> execPolicies;
 		std::vector<std::string> memcardFilters;
 		std::unordered_map<std::string, Patch> patches;
 
@@ -95,11 +98,21 @@ class YamlGameDatabaseImpl : public IGameDatabase
 {
 public:
 	bool initDatabase(std::istream& stream) override;
+	// Indexes the raw yaml text without parsing it; each entry is parsed on
+	// first lookup instead.  Startup then only pays for a line scan of the
+	// database rather than a full YAML parse of 10k+ entries.
+	bool initDatabaseLazy(std::string dbText);
 	GameDatabaseSchema::GameEntry findGame(const std::string serial) override;
 	int numGames() override;
 
 private:
 	std::unordered_map<std::string, GameDatabaseSchema::GameEntry> gameDb;
+
+	// Lazy mode: the raw yaml source plus the byte range of each top-level
+	// entry keyed by lower-cased serial.  gameDb doubles as the cache of
+	// already-parsed entries.
+	std::string rawDb;
+	std::unordered_map<std::string, std::pair<size_t, size_t>> entryIndex;
 	GameDatabaseSchema::GameEntry entryFromYaml(const std::string serial, const YAML::Node& node);
 
 	std::vector<std::string> convertMultiLineStringToVector(const std::string multiLineString);
@@ -62,6 +62,11 @@ bool Gif_HandlerAD(u8* pMem)
 			// qwords, rounded down; any extra bits are lost
 			// games must take care to ensure transfer rectangles are exact multiples of a qword
 			vif1.GSLastDownloadSize = vif1.TRXREG.RRW * vif1.TRXREG.RRH * bpp >> 7;
+
+			// A new local->host transfer was armed; unread read-ahead staging
+			// from a previous download is stale now.
+			g_vif1ReadStagingCount = 0;
+			g_vif1ReadStagingPos = 0;
 		}
 	}
 	else if (reg == 0x60)
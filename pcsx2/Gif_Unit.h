@@ -194,6 +194,9 @@ struct Gif_Path
 	u32 curSize;                 // Used buffer in bytes
 	u32 curOffset;               // Offset of current gifTag
 	u32 dmaRewind;               // Used by path3 when only part of a DMA chain is used
+	u32 highWater;               // Most bytes ever buffered (telemetry, survives soft resets)
+	u32 realignCount;            // Packet realignments since last hard reset (telemetry)
+	u32 realignBytes;            // Bytes moved by those realignments (telemetry)
 	Gif_Tag gifTag;              // Current GS Primitive tag
 	GS_Packet gsPack;            // Current GS Packet info
 	GIF_PATH idx;                // Gif Path Index
@@ -228,6 +231,9 @@ struct Gif_Path
 		curSize = 0;
 		curOffset = 0;
 		readAmount = 0;
+		highWater = 0;
+		realignCount = 0;
+		realignBytes = 0;
 		gifTag.Reset();
 		gsPack.Reset();
 	}
@@ -267,6 +273,8 @@ struct Gif_Path
 				Gif_AddBlankGSPacket(buffLimit - offset, idx);
 		}
 		//log_cb(RETRO_LOG_DEBUG, "Realign Packet [%d]\n", curSize - offset);
+		realignCount++;
+		realignBytes += curSize - offset;
 		if (intersect)
 			memmove(buffer, &buffer[offset], curSize - offset);
 		else
@@ -296,6 +304,8 @@ struct Gif_Path
 		pxAssertDev(curSize + size <= buffSize, "Gif Path Buffer Overflow!");
 		memcpy(&buffer[curSize], pMem, size);
 		curSize += size;
+		if (curSize > highWater)
+			highWater = curSize;
 	}
 
 	// If completed a GS packet (with EOP) then set done to true
@@ -502,6 +512,19 @@ struct Gif_Unit
 	void Reset(bool softReset = false)
 	{
 		GUNIT_WARN(Color_Red, "Gif Unit Reset!!! [soft=%d]", softReset);
+		if (!softReset)
+		{
+			// Buffer sizing telemetry: per-path high-water mark and realign
+			// traffic since the last hard reset.  The paths allocate 9mb each,
+			// so this is what says whether a title actually needs that.
+			for (int i = 0; i < 3; i++)
+			{
+				Gif_Path& p = gifPath[i];
+				if (p.highWater)
+					log_cb(RETRO_LOG_INFO, "gifUnit: path %d high-water %u/%u bytes, %u realigns (%u bytes moved)\n",
+						i + 1, p.highWater, p.buffSize, p.realignCount, p.realignBytes);
+			}
+		}
 		ResetRegs();
 		gsSIGNAL.Reset();
 		gsFINISH.Reset();
@@ -18,6 +18,7 @@
 
 #include "IPU.h"
 #include "IPUdma.h"
+#include "IPU_Pipeline.h"
 #include "yuv2rgb.h"
 #include "mpeg2lib/Mpeg.h"
 
@@ -63,6 +64,7 @@ __fi void IPUProcessInterrupt()
 
 void ipuReset()
 {
+	IpuPipeline::Drain();
 	memzero(ipuRegs);
 	memzero(g_BP);
 	memzero(decoder);
@@ -71,11 +73,14 @@ void ipuReset()
 
 	ipu_fifo.init();
 	ipu_cmd.clear();
+	yuv2rgb_init();
 }
 
 void SaveStateBase::ipuFreeze()
 {
 	// Get a report of the status of the ipu variables when saving and loading savestates.
+	// Outstanding worker IDCTs write into decoder.mb8/mb16, so settle them first.
+	IpuPipeline::Drain();
 	FreezeTag("IPU");
 	Freeze(ipu_fifo);
 
@@ -0,0 +1,140 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2020  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+
+#include "Common.h"
+#include "IPU.h"
+#include "IPU_Pipeline.h"
+#include "mpeg2lib/Mpeg.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace IpuPipeline
+{
+	bool Enable = false;
+
+	// A macroblock is at most 6 blocks, so a small power-of-two ring is
+	// plenty; if the worker falls behind the submitter just waits.
+	static const u32 QueueSize = 16;
+
+	struct IdctJob
+	{
+		__aligned16 s16 coeffs[64];
+		void* dest;
+		int stride;
+		int last;
+		bool add;
+	};
+
+	static IdctJob s_jobs[QueueSize];
+	static u32 s_write = 0; // next free slot, guarded by s_mutex
+	static u32 s_read = 0;  // next job to run, guarded by s_mutex
+
+	static std::thread s_thread;
+	static std::mutex s_mutex;
+	static std::condition_variable s_cv_work;
+	static std::condition_variable s_cv_done;
+	static bool s_running = false;
+	static bool s_shutdown = false;
+
+	static void WorkerProc()
+	{
+		std::unique_lock<std::mutex> lock(s_mutex);
+		for (;;)
+		{
+			while (s_read == s_write && !s_shutdown)
+				s_cv_work.wait(lock);
+			if (s_read == s_write)
+				return; // shutdown with an empty ring
+
+			IdctJob& job = s_jobs[s_read % QueueSize];
+			lock.unlock();
+
+			if (job.add)
+				mpeg2_idct_add(job.last, job.coeffs, (s16*)job.dest, job.stride);
+			else
+				mpeg2_idct_copy(job.coeffs, (u8*)job.dest, job.stride);
+
+			lock.lock();
+			s_read++;
+			s_cv_done.notify_one();
+		}
+	}
+
+	// Reserves a ring slot, starting the worker on first use.  Returns with
+	// s_mutex held; the caller fills the job and publishes it.
+	static IdctJob& LockFreeSlot(std::unique_lock<std::mutex>& lock)
+	{
+		if (!s_running)
+		{
+			s_shutdown = false;
+			s_thread = std::thread(WorkerProc);
+			s_running = true;
+		}
+		while (s_write - s_read >= QueueSize)
+			s_cv_done.wait(lock);
+		return s_jobs[s_write % QueueSize];
+	}
+
+	void SubmitCopy(const s16* coeffs, u8* dest, int stride)
+	{
+		std::unique_lock<std::mutex> lock(s_mutex);
+		IdctJob& job = LockFreeSlot(lock);
+		memcpy(job.coeffs, coeffs, sizeof(job.coeffs));
+		job.dest = dest;
+		job.stride = stride;
+		job.add = false;
+		s_write++;
+		s_cv_work.notify_one();
+	}
+
+	void SubmitAdd(const s16* coeffs, int last, s16* dest, int stride)
+	{
+		std::unique_lock<std::mutex> lock(s_mutex);
+		IdctJob& job = LockFreeSlot(lock);
+		memcpy(job.coeffs, coeffs, sizeof(job.coeffs));
+		job.dest = dest;
+		job.stride = stride;
+		job.last = last;
+		job.add = true;
+		s_write++;
+		s_cv_work.notify_one();
+	}
+
+	void Drain()
+	{
+		if (!s_running)
+			return;
+		std::unique_lock<std::mutex> lock(s_mutex);
+		while (s_read != s_write)
+			s_cv_done.wait(lock);
+	}
+
+	void Shutdown()
+	{
+		if (!s_running)
+			return;
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_shutdown = true;
+			s_cv_work.notify_one();
+		}
+		s_thread.join();
+		s_running = false;
+	}
+}
@@ -0,0 +1,43 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2020  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Pcsx2Types.h"
+
+// Optional worker thread for the MPEG2 slice decoder.  The entropy (VLC)
+// decode has to stay on the EE thread because it is interleaved with IPU FIFO
+// availability, but once a block's coefficients are complete its IDCT is pure
+// computation: the coefficients are copied into a small job ring and the
+// 8x8 inverse transform runs on the worker while the EE thread moves on to
+// the next block's VLC.  Drain() is the commit point -- it must be called
+// before anything reads the macroblock the jobs write into (CSC, the mb8 to
+// mb16 copy, or a savestate freeze).
+namespace IpuPipeline
+{
+	// Set once at startup by the frontend; checked by the slice decoder on
+	// every block, so don't flip it while a video is decoding.
+	extern bool Enable;
+
+	void SubmitCopy(const s16* coeffs, u8* dest, int stride);
+	void SubmitAdd(const s16* coeffs, int last, s16* dest, int stride);
+
+	// Blocks until every submitted IDCT has been written back.  Cheap no-op
+	// when the pipeline is disabled or idle.
+	void Drain();
+
+	// Drains and joins the worker; it restarts lazily on the next submit.
+	void Shutdown();
+}
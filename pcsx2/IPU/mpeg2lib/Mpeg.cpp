@@ -30,6 +30,7 @@
 
 #include "Common.h"
 #include "IPU/IPU.h"
+#include "IPU/IPU_Pipeline.h"
 #include "Mpeg.h"
 #include "Vlc.h"
 
@@ -638,7 +639,15 @@ static __fi bool slice_intra_DCT(const int cc, u8 * const dest, const int stride
 		return false;
 	}
 
-	mpeg2_idct_copy(decoder.DCTblock, dest, stride);
+	if (IpuPipeline::Enable)
+	{
+		IpuPipeline::SubmitCopy(decoder.DCTblock, dest, stride);
+		// the idct normally leaves the block zeroed behind for the next
+		// block's sparse coefficient writes; the worker only zeroes its copy.
+		memzero_sse_a(decoder.DCTblock);
+	}
+	else
+		mpeg2_idct_copy(decoder.DCTblock, dest, stride);
 
 	return true;
 }
@@ -657,7 +666,13 @@ static __fi bool slice_non_intra_DCT(s16 * const dest, const int stride, const b
 		return false;
 	}
 
-	mpeg2_idct_add(last, decoder.DCTblock, dest, stride);
+	if (IpuPipeline::Enable)
+	{
+		IpuPipeline::SubmitAdd(decoder.DCTblock, last, dest, stride);
+		memzero_sse_a(decoder.DCTblock);
+	}
+	else
+		mpeg2_idct_add(last, decoder.DCTblock, dest, stride);
 
 	return true;
 }
@@ -793,6 +808,7 @@ __fi bool mpeg2sliceIDEC()
 				}
 
 				// Send The MacroBlock via DmaIpuFrom
+				IpuPipeline::Drain();
 				ipu_csc(mb8, rgb32, decoder.sgn);
 
 				if (decoder.ofm == 0)
@@ -1038,6 +1054,8 @@ __fi bool mpeg2_slice()
 			jNO_DEFAULT;
 			}
 
+			IpuPipeline::Drain();
+
 			// Copy macroblock8 to macroblock16 - without sign extension.
 			// Manually inlined due to MSVC refusing to inline the SSE-optimized version.
 			{
@@ -1146,6 +1164,7 @@ __fi bool mpeg2_slice()
 		}
 
 		// Send The MacroBlock via DmaIpuFrom
+		IpuPipeline::Drain();
 		ipuRegs.ctrl.SCD = 0;
 		coded_block_pattern = decoder.coded_block_pattern;
 
@@ -15,4 +15,8 @@
 
 #pragma once
 
-extern void yuv2rgb();
+// Selects the widest conversion kernel the host supports; call once the
+// cpu capabilities are known (ipuReset does this).
+extern void yuv2rgb_init();
+
+extern void (*yuv2rgb)();
@@ -25,9 +25,12 @@
 
 #include "../DebugTools/Breakpoints.h"
 
+#include "Utilities/FastJmp.h"
+
 #include <float.h>
 
 using namespace R5900;		// for OPCODE and OpcodeImpl
+using namespace vtlb_private;	// for the direct instruction fetch fast path
 
 static u32 cpuBlockCycles = 0;		// 3 bit fixed point version of cycle count
 
@@ -112,6 +115,38 @@ void intCheckMemcheck()
 	}
 }
 
+// Per-instruction caches for the hot fetch/decode path of execI.
+//
+// The fetch cache remembers the host pointer of the last directly-mapped page
+// the pc landed on, saving the vtlb call for the common case of straight-line
+// or loop execution inside one page.  It is invalidated by intClear (the TLB
+// write handlers route through Cpu->Clear).
+//
+// The decode cache is a direct mapped table of the last opcode seen at each
+// pc slot.  An entry is only used when the raw opcode just fetched still
+// matches, so self-modifying code and TLB remaps are handled for free: a
+// changed instruction simply misses and is re-decoded through the normal
+// getsubclass table walk.
+static u32 s_fetch_page = ~0u;
+static uptr s_fetch_base = 0;
+
+struct DecodedInstruction
+{
+	u32 pc;
+	u32 code;
+	void (*interpret)();
+	u32 cycles;
+};
+
+static DecodedInstruction s_decode_cache[4096];
+
+static void intResetDecodeCache()
+{
+	s_fetch_page = ~0u;
+	for (size_t i = 0; i < ArraySize(s_decode_cache); i++)
+		s_decode_cache[i].pc = ~0u;
+}
+
 static void execI()
 {
 	u32 pc = cpuRegs.pc;
@@ -120,13 +155,41 @@ static void execI()
 	cpuRegs.pc += 4;
 
 	// interprete instruction
-	cpuRegs.code = memRead32( pc );
+	if ((pc & ~(u32)VTLB_PAGE_MASK) == s_fetch_page)
+		cpuRegs.code = *(const u32*)(s_fetch_base + (pc & VTLB_PAGE_MASK));
+	else
+	{
+		const VTLBVirtual vmv = vtlbdata.vmap[pc >> VTLB_PAGE_BITS];
+		if (!vmv.isHandler(pc))
+		{
+			const uptr ptr = vmv.assumePtr(pc);
+			s_fetch_page = pc & ~(u32)VTLB_PAGE_MASK;
+			s_fetch_base = ptr - (pc & VTLB_PAGE_MASK);
+			cpuRegs.code = *(const u32*)ptr;
+		}
+		else
+		{
+			// Handler-backed page: take the full read so TLB misses and the
+			// like are raised as usual.
+			cpuRegs.code = memRead32( pc );
+		}
+	}
 
-	const OPCODE& opcode = GetCurrentInstruction();
+	DecodedInstruction& slot = s_decode_cache[(pc >> 2) & (ArraySize(s_decode_cache) - 1)];
 
-	cpuBlockCycles += opcode.cycles;
+	if (slot.pc != pc || slot.code != cpuRegs.code)
+	{
+		const OPCODE& opcode = GetCurrentInstruction();
 
-	opcode.interpret();
+		slot.pc = pc;
+		slot.code = cpuRegs.code;
+		slot.interpret = opcode.interpret;
+		slot.cycles = opcode.cycles;
+	}
+
+	cpuBlockCycles += slot.cycles;
+
+	slot.interpret();
 }
 
 static __fi void _doBranch_shared(u32 tar)
@@ -436,6 +499,7 @@ static void intAlloc()
 static void intReset()
 {
 	cpuRegs.branch = 0;
+	intResetDecodeCache();
 }
 
 static void intEventTest()
@@ -444,17 +508,41 @@ static void intEventTest()
 	_cpuEventTest_Shared();
 }
 
+// Resume point for cancelled instructions.  Games that TLB-miss by design
+// (mapped scratchpad patterns) fault often enough that unwinding a C++
+// exception per miss is measurable; vtlb_Miss jumps straight back to the
+// main loop instead, the same way the recompiler uses FastJmp for its
+// state-check exits.  The throw remains as the fallback for execI callers
+// that never arm the buffer (intStep, intExecuteRange).
+static fastjmp_buf s_cancelResume;
+static bool s_cancelResumeArmed = false;
+
+void intCancelInstruction()
+{
+	if (s_cancelResumeArmed)
+		fastjmp_jmp(&s_cancelResume, 1);
+
+	throw Exception::CancelInstruction();
+}
+
 static void intExecute()
 {
-	bool instruction_was_cancelled;
+	// volatile: both live across the fastjmp_set below and are modified
+	// between arming it and a potential jump back.
+	volatile bool instruction_was_cancelled;
 	enum ExecuteState {
 		RESET,
 		GAME_LOADING,
 		GAME_RUNNING
 	};
-	ExecuteState state = RESET;
+	volatile ExecuteState state = RESET;
 	do {
 		instruction_was_cancelled = false;
+		// A cancelled instruction resumes here with the pc already pointed
+		// at the guest exception handler; the switch below re-enters the
+		// phase we were in.
+		fastjmp_set(&s_cancelResume);
+		s_cancelResumeArmed = true;
 		try {
 			// The execution was splited in three parts so it is easier to
 			// resume it after a cancelled instruction.
@@ -512,10 +600,15 @@ static void intExecute()
 		}
 		catch( Exception::ExitCpuExecute& ) { }
 		catch( Exception::CancelInstruction& ) { instruction_was_cancelled = true; }
+		catch( ... ) { s_cancelResumeArmed = false; throw; }
 
 		// For example a tlb miss will throw an exception. Cpu must be resumed
 		// to execute the handler
 	} while (instruction_was_cancelled);
+
+	// The buffer's frame dies with this call; anything cancelling after this
+	// point (single-stepping) takes the exception fallback.
+	s_cancelResumeArmed = false;
 }
 
 static void intCheckExecutionState()
@@ -529,8 +622,21 @@ static void intStep()
 	execI();
 }
 
+// Interprets from the current pc until control leaves [start, end); the
+// recompiler's stub blocks for interpreted policy ranges call this and then
+// return through the dispatcher.  Branches (and their delay slots) resolve
+// atomically inside execI, so the loop always exits with a settled pc.
+void intExecuteRange(u32 start, u32 end)
+{
+	while (cpuRegs.pc >= start && cpuRegs.pc < end)
+		execI();
+}
+
 static void intClear(u32 Addr, u32 Size)
 {
+	// A TLB write may have remapped the page the fetch cache points at.  The
+	// decode cache revalidates against the fetched opcode, so it can stay.
+	s_fetch_page = ~0u;
 }
 
 static void intShutdown() {
@@ -488,6 +488,72 @@ namespace sysmem {
 	}
 }
 
+namespace sysclib {
+	// Returns a host pointer when the byte range [addr, addr+len) lies entirely
+	// within IOP main ram (in any of its KUSEG/KSEG0/KSEG1 guises), or NULL when
+	// it touches hardware registers, mirrors the 2mb boundary, or wraps.  The
+	// HLE fast paths below only fire for plain ram-to-ram work; anything else
+	// falls back to running the module's own code.
+	static u8* hle_ram_range(u32 addr, u32 len)
+	{
+		const u32 phys = addr & 0x1fffffff;
+
+		if (phys >= Ps2MemSize::IopRam || len > Ps2MemSize::IopRam - phys)
+			return NULL;
+
+		return iopPhysMem(phys);
+	}
+
+	int memcpy_HLE()
+	{
+		u8* dst = hle_ram_range(a0, a2);
+		const u8* src = hle_ram_range(a1, a2);
+
+		// The module's memcpy is a simple ascending copy; overlapping ranges
+		// have observable (if degenerate) behavior, so leave those to it.
+		if (!dst || !src || (dst < src + a2 && src < dst + a2 && dst != src))
+			return 0;
+
+		memcpy(dst, src, a2);
+		psxCpu->Clear(a0, (a2 + 3) / 4);
+
+		v0 = a0;
+		pc = ra;
+		return 1;
+	}
+
+	int memmove_HLE()
+	{
+		u8* dst = hle_ram_range(a0, a2);
+		const u8* src = hle_ram_range(a1, a2);
+
+		if (!dst || !src)
+			return 0;
+
+		memmove(dst, src, a2);
+		psxCpu->Clear(a0, (a2 + 3) / 4);
+
+		v0 = a0;
+		pc = ra;
+		return 1;
+	}
+
+	int memset_HLE()
+	{
+		u8* dst = hle_ram_range(a0, a2);
+
+		if (!dst)
+			return 0;
+
+		memset(dst, a1, a2);
+		psxCpu->Clear(a0, (a2 + 3) / 4);
+
+		v0 = a0;
+		pc = ra;
+		return 1;
+	}
+}
+
 namespace loadcore {
 	void RegisterLibraryEntries_DEBUG()
 	{
@@ -572,6 +638,14 @@ irxHLE irxImportHLE(const std::string &libname, u16 index)
 		EXPORT_H( 14, Kprintf)
 	END_MODULE
 
+	// Pure-compute fast paths: these run host-side when the whole transfer
+	// stays inside IOP ram, and return 0 (run the real module code) otherwise.
+	MODULE(sysclib)
+		EXPORT_H( 12, memcpy)
+		EXPORT_H( 13, memmove)
+		EXPORT_H( 14, memset)
+	END_MODULE
+
 	MODULE(ioman)
 		EXPORT_H(  4, open)
 		EXPORT_H(  5, close)
@@ -621,11 +695,18 @@ int irxImportExec(u32 import_table, u16 index)
 		return 0;
 
 	std::string libname = iopMemReadString(import_table + 12, 8);
-	const char *funcname = irxImportFuncname(libname, index);
 	irxHLE hle = irxImportHLE(libname, index);
+#ifdef PCSX2_DEVBUILD
+	// Walking the generated IopModuleNames table is a long string-compare
+	// chain and the name only feeds PSXBIOS_LOG, so skip it in release builds
+	// the same way psxRecompileIrxImport does.
+	const char *funcname = irxImportFuncname(libname, index);
 	irxDEBUG debug = irxImportDebug(libname, index);
 
 	irxImportLog(libname, index, funcname);
+#else
+	irxDEBUG debug = 0;
+#endif
 
 	if (debug)
 		debug();
@@ -64,6 +64,16 @@ u8 psxvblankgate = 0;
 // which ensures they stay 100% in sync with the EE's hblank counters.
 #define PSXHBLANK 0x2001
 
+// Cached absolute service deadline per counter, in psxRegs.cycle terms.  Not
+// frozen in savestates - rebuilt from the counter state on load.  Deadlines
+// are only recalculated when the counter itself changes (mode/target/count
+// writes, gates, or being serviced), so psxRcntUpdate can skip the divide and
+// target/overflow tests for every counter whose event is still in the future.
+static u32 s_rcntDeadline[NUM_COUNTERS];
+
+// Far enough ahead to never fire, close enough to survive cycle wrap compares.
+#define IOPCNT_DEADLINE_HORIZON 0x40000000
+
 static void psxRcntReset(int index)
 {
 	psxCounters[index].count = 0;
@@ -71,48 +81,60 @@ static void psxRcntReset(int index)
 	psxCounters[index].sCycleT = psxRegs.cycle;
 }
 
-static void _rcntSet(int cntidx)
+// Recalculate the absolute deadline of one counter from its current state.
+// The count/sCycleT pair is used as-is, so it works equally on normalized and
+// lazily-represented counts.
+static void _rcntSetDeadline(int cntidx)
 {
 	u64 overflowCap = (cntidx >= 3) ? 0x100000000ULL : 0x10000;
-	u64 c;
+	u64 c, dist = IOPCNT_DEADLINE_HORIZON;
 
 	const psxCounter& counter = psxCounters[cntidx];
 
-	// psxNextCounter is relative to the psxRegs.cycle when rcntUpdate() was last called.
-	// However, the current _rcntSet could be called at any cycle count, so we need to take
-	// that into account.  Adding the difference from that cycle count to the current one
-	// will do the trick!
-
 	if (counter.mode & IOPCNT_STOPPED || counter.rate == PSXHBLANK)
+	{
+		s_rcntDeadline[cntidx] = psxRegs.cycle + IOPCNT_DEADLINE_HORIZON;
 		return;
+	}
 
 	// check for special cases where the overflow or target has just passed
 	// (we probably missed it because we're doing/checking other things)
 	if (counter.count > overflowCap || counter.count > counter.target)
 	{
-		psxNextCounter = 4;
+		s_rcntDeadline[cntidx] = psxRegs.cycle + 4;
 		return;
 	}
 
 	c = (u64)((overflowCap - counter.count) * counter.rate) - (psxRegs.cycle - counter.sCycleT);
-	c += psxRegs.cycle - psxNextsCounter; // adjust for time passed since last rcntUpdate();
 
-	if (c < (u64)psxNextCounter)
+	if (c < dist)
+		dist = c;
+
+	//if((counter.mode & 0x10) == 0 || psxCounters[i].target > 0xffff) continue;
+	if (!(counter.target & IOPCNT_FUTURE_TARGET))
 	{
-		psxNextCounter = (u32)c;
-		psxSetNextBranch(psxNextsCounter, psxNextCounter); //Need to update on counter resets/target changes
+		c = (u64)((s64)((counter.target - counter.count) * counter.rate) - (psxRegs.cycle - counter.sCycleT));
+
+		if (c < dist)
+			dist = c;
 	}
 
-	//if((counter.mode & 0x10) == 0 || psxCounters[i].target > 0xffff) continue;
-	if (counter.target & IOPCNT_FUTURE_TARGET)
-		return;
+	s_rcntDeadline[cntidx] = psxRegs.cycle + (u32)dist;
+}
 
-	c = (s64)((counter.target - counter.count) * counter.rate) - (psxRegs.cycle - counter.sCycleT);
-	c += psxRegs.cycle - psxNextsCounter; // adjust for time passed since last rcntUpdate();
+static void _rcntSet(int cntidx)
+{
+	_rcntSetDeadline(cntidx);
 
-	if (c < (u64)psxNextCounter)
+	// psxNextCounter is relative to the psxRegs.cycle when rcntUpdate() was last called.
+	// However, the current _rcntSet could be called at any cycle count, so we need to take
+	// that into account.
+
+	const u32 c = s_rcntDeadline[cntidx] - psxNextsCounter;
+
+	if (c < (u32)psxNextCounter)
 	{
-		psxNextCounter = (u32)c;
+		psxNextCounter = (s32)c;
 		psxSetNextBranch(psxNextsCounter, psxNextCounter); //Need to update on counter resets/target changes
 	}
 }
@@ -159,12 +181,24 @@ void psxRcntInit()
 	for (i = 0; i < 8; i++)
 		psxCounters[i].sCycleT = psxRegs.cycle;
 
+	for (i = 0; i < 6; i++)
+		_rcntSetDeadline(i);
+	s_rcntDeadline[6] = psxCounters[6].sCycleT + psxCounters[6].CycleT;
+	s_rcntDeadline[7] = psxCounters[7].sCycleT + psxCounters[7].CycleT;
+
 	// Tell the IOP to branch ASAP, so that timers can get
 	// configured properly.
 	psxNextCounter = 1;
 	psxNextsCounter = psxRegs.cycle;
 }
 
+// Keeps the cached deadline in step when code outside this module reprograms
+// a counter's CycleT/sCycleT pair directly (the SPU2 DMA kickoff does).
+void psxRcntReschedule(int index)
+{
+	s_rcntDeadline[index] = psxCounters[index].sCycleT + psxCounters[index].CycleT;
+}
+
 static bool __fastcall _rcntFireInterrupt(int i, bool isOverflow)
 {
 	bool ret;
@@ -311,6 +345,7 @@ static void _psxCheckStartGate(int i)
 									   psxRcntRcount16(i) :
 									   psxRcntRcount32(i);
 			psxCounters[i].mode |= IOPCNT_STOPPED;
+			_rcntSetDeadline(i); // push the deadline out while stopped
 			return;
 
 		case 0x1: //GATE_ON_ClearStart - count normally with resets after every end gate
@@ -349,6 +384,7 @@ static void _psxCheckEndGate(int i)
 									   psxRcntRcount16(i) :
 									   psxRcntRcount32(i);
 			psxCounters[i].mode |= IOPCNT_STOPPED;
+			_rcntSetDeadline(i); // push the deadline out while stopped
 			return; // do not set the counter
 
 		case 0x3: //GATE_ON_Start - start and count normally (no restarts or stops or clears)
@@ -441,17 +477,11 @@ void psxVBlankEnd()
 void psxRcntUpdate()
 {
 	int i;
-	//u32 change = 0;
 
 	g_iopNextEventCycle = psxRegs.cycle + 32;
 
-	psxNextCounter = 0x7fffffff;
-	psxNextsCounter = psxRegs.cycle;
-
 	for (i = 0; i <= 5; i++)
 	{
-		s32 change = psxRegs.cycle - psxCounters[i].sCycleT;
-
 		// don't count disabled or hblank counters...
 		// We can't check the ALTSOURCE flag because the PSXCLOCK source *should*
 		// be counted here.
@@ -467,31 +497,27 @@ void psxRcntUpdate()
 		if (psxCounters[i].rate == PSXHBLANK)
 			continue;
 
-		if (change <= 0)
+		// Deadline scheduling: counters whose next event is still in the
+		// future keep their count implicitly in sCycleT, the same lazy form
+		// the read paths use, and skip the divide and the target/overflow
+		// tests below.  Their deadline was computed when they last changed.
+
+		if ((s32)(psxRegs.cycle - s_rcntDeadline[i]) < 0)
 			continue;
 
-		psxCounters[i].count += change / psxCounters[i].rate;
-		if (psxCounters[i].rate != 1)
+		s32 change = psxRegs.cycle - psxCounters[i].sCycleT;
+
+		if (change > 0)
 		{
-			change -= (change / psxCounters[i].rate) * psxCounters[i].rate;
-			psxCounters[i].sCycleT = psxRegs.cycle - change;
+			psxCounters[i].count += change / psxCounters[i].rate;
+			if (psxCounters[i].rate != 1)
+			{
+				change -= (change / psxCounters[i].rate) * psxCounters[i].rate;
+				psxCounters[i].sCycleT = psxRegs.cycle - change;
+			}
+			else
+				psxCounters[i].sCycleT = psxRegs.cycle;
 		}
-		else
-			psxCounters[i].sCycleT = psxRegs.cycle;
-	}
-
-	// Do target/overflow testing
-	// Optimization Note: This approach is very sound.  Please do not try to unroll it
-	// as the size of the Test functions will cause code cache clutter and slowness.
-
-	for (i = 0; i < 6; i++)
-	{
-		// don't do target/oveflow checks for hblankers.  Those
-		// checks are done when the counters are updated.
-		if (psxCounters[i].rate == PSXHBLANK)
-			continue;
-		if (psxCounters[i].mode & IOPCNT_STOPPED)
-			continue;
 
 		_rcntTestTarget(i);
 		_rcntTestOverflow(i);
@@ -500,11 +526,11 @@ void psxRcntUpdate()
 		// already shot past our target if it was very near zero.
 
 		//if( psxCounters[i].count >= psxCounters[i].target ) _rcntTestTarget( i );
-	}
 
+		_rcntSetDeadline(i);
+	}
 
 	const s32 difference = psxRegs.cycle - psxCounters[6].sCycleT;
-	s32 c = psxCounters[6].CycleT;
 
 	if (difference >= psxCounters[6].CycleT)
 	{
@@ -512,13 +538,11 @@ void psxRcntUpdate()
 		psxCounters[6].sCycleT = psxRegs.cycle;
 		psxCounters[6].CycleT = psxCounters[6].rate;
 	}
-	else
-		c -= difference;
-	psxNextCounter = c;
+	s_rcntDeadline[6] = psxCounters[6].sCycleT + psxCounters[6].CycleT;
+
 	DEV9async(1);
 	{
 		const s32 difference = psxRegs.cycle - psxCounters[7].sCycleT;
-		s32 c = psxCounters[7].CycleT;
 
 		if (difference >= psxCounters[7].CycleT)
 		{
@@ -526,14 +550,22 @@ void psxRcntUpdate()
 			psxCounters[7].sCycleT = psxRegs.cycle;
 			psxCounters[7].CycleT = psxCounters[7].rate;
 		}
-		else
-			c -= difference;
-		if (c < psxNextCounter)
-			psxNextCounter = c;
+		s_rcntDeadline[7] = psxCounters[7].sCycleT + psxCounters[7].CycleT;
 	}
 
-	for (i = 0; i < 6; i++)
-		_rcntSet(i);
+	// Fold the per-counter deadlines into the single next-deadline pair the
+	// branch test compares against.
+
+	psxNextsCounter = psxRegs.cycle;
+	psxNextCounter = 0x7fffffff;
+
+	for (i = 0; i < NUM_COUNTERS; i++)
+	{
+		const s32 dist = (s32)(s_rcntDeadline[i] - psxRegs.cycle);
+
+		if (dist < psxNextCounter)
+			psxNextCounter = std::max<s32>(dist, 1);
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -886,5 +918,13 @@ void SaveStateBase::psxRcntFreeze()
 	Freeze(psxNextsCounter);
 
 	if (IsLoading())
+	{
 		psxRcntSetGates();
+
+		// The deadline cache isn't part of the state; rebuild it.
+		for (int i = 0; i < 6; i++)
+			_rcntSetDeadline(i);
+		s_rcntDeadline[6] = psxCounters[6].sCycleT + psxCounters[6].CycleT;
+		s_rcntDeadline[7] = psxCounters[7].sCycleT + psxCounters[7].CycleT;
+	}
 }
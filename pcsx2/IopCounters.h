@@ -30,6 +30,7 @@ extern psxCounter psxCounters[NUM_COUNTERS];
 
 extern void psxRcntInit();
 extern void psxRcntUpdate();
+extern void psxRcntReschedule(int index);
 extern void psxRcntWcount16(int index, u16 value);
 extern void psxRcntWcount32(int index, u32 value);
 extern void psxRcntWmode16(int index, u32 value);
@@ -21,6 +21,7 @@
 //#include "R3000A.h"
 #include "IopCommon.h"
 #include "Utilities/MathUtils.h"
+#include <emmintrin.h>
 #ifdef GTE_DUMP
 #define G_OP(name,delay) fprintf(gteLog, "* : %08X : %02d : %s\n", psxRegs.code, delay, name);
 #define G_SD(reg)  fprintf(gteLog, "+D%02d : %08X\n", reg, psxRegs.CP2D.r[reg]);
@@ -542,10 +543,36 @@ else gteIR3=(long)gteMAC3; \
 
 //********END OF LIMITATIONS**********************************/
 
+//********SIMD MATRIX-VECTOR CORE*****************************/
+
+//Every GTE matrix product below is a sum of three s16*s16 products evaluated
+//in plain 32-bit arithmetic, truncating on overflow.  PMADDWD has exactly
+//those semantics (signed 16-bit multiplies, wraparound 32-bit pairwise adds),
+//so the nine multiplies of a 3x3 matrix * vector collapse into two multiply
+//instructions while staying bit-exact with the scalar expressions - the
+//limiters and overflow flags still run on the very same 32-bit sums.
+//The rotation (R11..R33), light (L11..L33) and color (LR1..LB3) matrices each
+//occupy nine consecutive s16 slots in CP2C, so a pointer to the first element
+//describes the whole matrix.
+__inline void gteMatVec(const s16* m, s16 vx, s16 vy, s16 vz, s32 mac[3]) {
+	const __m128i vec = _mm_setr_epi16(vx, vy, vz, 0, vx, vy, vz, 0);
+	const __m128i r12 = _mm_setr_epi16(m[0], m[1], m[2], 0, m[3], m[4], m[5], 0);
+	const __m128i r3  = _mm_setr_epi16(m[6], m[7], m[8], 0, 0, 0, 0, 0);
+	const __m128i p12 = _mm_madd_epi16(r12, vec); //{r1a, r1b, r2a, r2b}
+	const __m128i p3  = _mm_madd_epi16(r3, vec);  //{r3a, r3b, 0, 0}
+	const __m128i s12 = _mm_add_epi32(p12, _mm_srli_epi64(p12, 32));
+	const __m128i s3  = _mm_add_epi32(p3, _mm_srli_epi64(p3, 32));
+	mac[0] = _mm_cvtsi128_si32(s12);
+	mac[1] = _mm_cvtsi128_si32(_mm_srli_si128(s12, 8));
+	mac[2] = _mm_cvtsi128_si32(s3);
+}
+
 #define GTE_RTPS1(vn) { \
-	gteMAC1 = FNC_OVERFLOW1(((signed long)(gteR11*gteVX##vn + gteR12*gteVY##vn + gteR13*gteVZ##vn)>>12) + gteTRX); \
-	gteMAC2 = FNC_OVERFLOW2(((signed long)(gteR21*gteVX##vn + gteR22*gteVY##vn + gteR23*gteVZ##vn)>>12) + gteTRY); \
-	gteMAC3 = FNC_OVERFLOW3(((signed long)(gteR31*gteVX##vn + gteR32*gteVY##vn + gteR33*gteVZ##vn)>>12) + gteTRZ); \
+	s32 _mac[3]; \
+	gteMatVec(&gteR11, gteVX##vn, gteVY##vn, gteVZ##vn, _mac); \
+	gteMAC1 = FNC_OVERFLOW1(((s64)_mac[0]>>12) + gteTRX); \
+	gteMAC2 = FNC_OVERFLOW2(((s64)_mac[1]>>12) + gteTRY); \
+	gteMAC3 = FNC_OVERFLOW3(((s64)_mac[2]>>12) + gteTRZ); \
 }
 
 /*	gteMAC1 = NC_OVERFLOW1(((signed long)(gteR11*gteVX0 + gteR12*gteVY0 + gteR13*gteVZ0)>>12) + gteTRX);
@@ -943,9 +970,11 @@ void gteRTPT() {
 #define gte_C33 gteLB3
 
 #define _MVMVA_FUNC(_v0, _v1, _v2, mx) { \
-	SSX = (_v0) * mx##11 + (_v1) * mx##12 + (_v2) * mx##13; \
-	SSY = (_v0) * mx##21 + (_v1) * mx##22 + (_v2) * mx##23; \
-	SSZ = (_v0) * mx##31 + (_v1) * mx##32 + (_v2) * mx##33; \
+	s32 _mac[3]; \
+	gteMatVec(&mx##11, (_v0), (_v1), (_v2), _mac); \
+	SSX = _mac[0]; \
+	SSY = _mac[1]; \
+	SSZ = _mac[2]; \
 }
 
 void gteMVMVA() {
@@ -1383,9 +1412,11 @@ gteMAC2 = (long)(gteG*gte_GGLT*16); \
 gteMAC3 = (long)(gteB*gte_BBLT*16); \
 */
 #define GTE_NCCS(vn) \
-	gte_LL1 = F12limA1U((gteL11*gteVX##vn + gteL12*gteVY##vn + gteL13*gteVZ##vn) >> 12); \
-	gte_LL2 = F12limA2U((gteL21*gteVX##vn + gteL22*gteVY##vn + gteL23*gteVZ##vn) >> 12); \
-	gte_LL3 = F12limA3U((gteL31*gteVX##vn + gteL32*gteVY##vn + gteL33*gteVZ##vn) >> 12); \
+	{ s32 _ll[3]; \
+	gteMatVec(&gteL11, gteVX##vn, gteVY##vn, gteVZ##vn, _ll); \
+	gte_LL1 = F12limA1U(_ll[0] >> 12); \
+	gte_LL2 = F12limA2U(_ll[1] >> 12); \
+	gte_LL3 = F12limA3U(_ll[2] >> 12); } \
 	gte_RRLT= F12limA1U(gteRBK + ((gteLR1*gte_LL1 + gteLR2*gte_LL2 + gteLR3*gte_LL3) >> 12)); \
 	gte_GGLT= F12limA2U(gteGBK + ((gteLG1*gte_LL1 + gteLG2*gte_LL2 + gteLG3*gte_LL3) >> 12)); \
 	gte_BBLT= F12limA3U(gteBBK + ((gteLB1*gte_LL1 + gteLB2*gte_LL2 + gteLB3*gte_LL3) >> 12)); \
@@ -1610,9 +1641,11 @@ gteMAC2 = (long)(gte_GG0 << 4); \
 gteMAC3 = (long)(gte_BB0 << 4);
 */
 #define GTE_NCDS(vn) \
-	gte_LL1 = F12limA1U((gteL11*gteVX##vn + gteL12*gteVY##vn + gteL13*gteVZ##vn) >> 12); \
-	gte_LL2 = F12limA2U((gteL21*gteVX##vn + gteL22*gteVY##vn + gteL23*gteVZ##vn) >> 12); \
-	gte_LL3 = F12limA3U((gteL31*gteVX##vn + gteL32*gteVY##vn + gteL33*gteVZ##vn) >> 12); \
+	{ s32 _ll[3]; \
+	gteMatVec(&gteL11, gteVX##vn, gteVY##vn, gteVZ##vn, _ll); \
+	gte_LL1 = F12limA1U(_ll[0] >> 12); \
+	gte_LL2 = F12limA2U(_ll[1] >> 12); \
+	gte_LL3 = F12limA3U(_ll[2] >> 12); } \
 	gte_RRLT= F12limA1U(gteRBK + ((gteLR1*gte_LL1 + gteLR2*gte_LL2 + gteLR3*gte_LL3) >> 12)); \
 	gte_GGLT= F12limA2U(gteGBK + ((gteLG1*gte_LL1 + gteLG2*gte_LL2 + gteLG3*gte_LL3) >> 12)); \
 	gte_BBLT= F12limA3U(gteBBK + ((gteLB1*gte_LL1 + gteLB2*gte_LL2 + gteLB3*gte_LL3) >> 12)); \
@@ -2645,9 +2678,11 @@ gteG2 = limB2(gteMAC2 / 16.0f); \
 gteB2 = limB3(gteMAC3 / 16.0f); gteCODE2 = gteCODE;*/
 
 #define	GTE_NCS(vn)  \
-	gte_LL1 = F12limA1U((gteL11*gteVX##vn + gteL12*gteVY##vn + gteL13*gteVZ##vn) >> 12); \
-	gte_LL2 = F12limA2U((gteL21*gteVX##vn + gteL22*gteVY##vn + gteL23*gteVZ##vn) >> 12); \
-	gte_LL3 = F12limA3U((gteL31*gteVX##vn + gteL32*gteVY##vn + gteL33*gteVZ##vn) >> 12); \
+	{ s32 _ll[3]; \
+	gteMatVec(&gteL11, gteVX##vn, gteVY##vn, gteVZ##vn, _ll); \
+	gte_LL1 = F12limA1U(_ll[0] >> 12); \
+	gte_LL2 = F12limA2U(_ll[1] >> 12); \
+	gte_LL3 = F12limA3U(_ll[2] >> 12); } \
 	gteMAC1 = F12limA1U(gteRBK + ((gteLR1*gte_LL1 + gteLR2*gte_LL2 + gteLR3*gte_LL3) >> 12)); \
 	gteMAC2 = F12limA2U(gteGBK + ((gteLG1*gte_LL1 + gteLG2*gte_LL2 + gteLG3*gte_LL3) >> 12)); \
 	gteMAC3 = F12limA3U(gteBBK + ((gteLB1*gte_LL1 + gteLB2*gte_LL2 + gteLB3*gte_LL3) >> 12));
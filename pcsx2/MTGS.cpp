@@ -21,6 +21,7 @@
 
 #include "GS.h"
 #include "Gif_Unit.h"
+#include "PerfStats.h"
 #include "MTVU.h"
 #include "Elfheader.h"
 
@@ -58,6 +59,7 @@ void SysMtgsThread::OnStart()
 
 	m_ReadPos			= 0;
 	m_WritePos			= 0;
+	m_CachedReadPos		= 0;
 	m_RingBufferIsBusy  = false;
 	m_packet_size		= 0;
 	m_packet_writepos	= 0;
@@ -69,6 +71,10 @@ void SysMtgsThread::OnStart()
 
 	m_CopyDataTally		= 0;
 
+#ifdef __LIBRETRO__
+	m_Draining			= false;
+#endif
+
 	_parent::OnStart();
 }
 
@@ -131,6 +137,10 @@ void SysMtgsThread::PostVsyncStart()
 
 	SendDataPacket();
 
+	// Pair the queued vsync with the pad poll it reflects, for the
+	// input-to-present latency readout.
+	PerfStats::VsyncQueued();
+
 	// Vsyncs should always start the GS thread, regardless of how little has actually be queued.
 	if (m_CopyDataTally != 0) SetEvent();
 
@@ -248,7 +258,15 @@ void SysMtgsThread::ExecuteTaskInThread()
 		while (wxTheApp->HasPendingEvents())
 			wxTheApp->ProcessPendingEvents();
 
-		while (!m_sem_event.WaitWithoutYield(wxTimeSpan::Millisecond()))
+		if (m_Draining)
+		{
+			// Drain mode: never sleep.  Either there's work already queued, in
+			// which case we fall through and process it, or the ring is empty
+			// and the drain is complete.
+			if (m_ReadPos.load(std::memory_order_relaxed) == m_WritePos.load(std::memory_order_acquire))
+				return;
+		}
+		else while (!m_sem_event.WaitWithoutYield(wxTimeSpan::Millisecond()))
 		{
 			while (wxTheApp->HasPendingEvents())
 				wxTheApp->ProcessPendingEvents();
@@ -285,7 +303,35 @@ void SysMtgsThread::ExecuteTaskInThread()
 					Gif_Path& path   = gifUnit.gifPath[tag.data[2]];
 					u32       offset = tag.data[0];
 					u32       size   = tag.data[1];
-					if (offset != ~0u) GSgifTransfer((u32*)&path.buffer[offset], size/16);
+
+					// Large image streams arrive as many DMA-chunk sized
+					// packets sitting back to back in the path buffer.
+					// Packets between ReadPos and WritePos are fully
+					// published and immutable, so contiguous ones for the
+					// same path can be folded into a single GSgifTransfer,
+					// saving the per-packet transfer overhead.
+					if (offset != ~0u) {
+						const u32 local_WritePos = m_WritePos.load(std::memory_order_acquire);
+
+						u32 peek = (local_ReadPos + 1) & RingBufferMask;
+
+						while (peek != local_WritePos)
+						{
+							const PacketTagType& next = (PacketTagType&)RingBuffer[peek];
+
+							if (next.command != GS_RINGTYPE_GSPACKET
+							 || next.data[2] != tag.data[2]
+							 || (u32)next.data[0] != offset + size)
+								break;
+
+							size += (u32)next.data[1];
+							ringposinc++;
+							peek = (peek + 1) & RingBufferMask;
+						}
+
+						PerfStats::Scope gs_scope(Subsys_GS);
+						GSgifTransfer((u32*)&path.buffer[offset], size/16);
+					}
 					path.readAmount.fetch_sub(size, std::memory_order_acq_rel);
 					break;
 				}
@@ -294,7 +340,12 @@ void SysMtgsThread::ExecuteTaskInThread()
 #if 0
 					MTVU_LOG("MTGS - Waiting on semaXGkick!");
 #endif
-					vu1Thread.KickStart(true);
+					Gif_Path& path = gifUnit.gifPath[GIF_PATH_1];
+					// The vu1 program often finished long ago; only prod the MTVU
+					// thread when its packet hasn't landed in the queue yet, so an
+					// idle MTVU isn't woken once per XGKICK just to go back to sleep.
+					if (!path.GetPendingGSPackets())
+						vu1Thread.KickStart(true);
 #ifndef __LIBRETRO__
 					busy.PartialRelease();
 #endif
@@ -303,9 +354,11 @@ void SysMtgsThread::ExecuteTaskInThread()
 #ifndef __LIBRETRO__
 					busy.PartialAcquire();
 #endif
-					Gif_Path& path   = gifUnit.gifPath[GIF_PATH_1];
 					GS_Packet gsPack = path.GetGSPacketMTVU(); // Get vu1 program's xgkick packet(s)
-					if (gsPack.size) GSgifTransfer((u32*)&path.buffer[gsPack.offset], gsPack.size/16);
+					if (gsPack.size) {
+						PerfStats::Scope gs_scope(Subsys_GS);
+						GSgifTransfer((u32*)&path.buffer[gsPack.offset], gsPack.size/16);
+					}
 					path.readAmount.fetch_sub(gsPack.size + gsPack.readAmount, std::memory_order_acq_rel);
 					path.PopGSPacketMTVU(); // Should be done last, for proper Gif_MTGS_Wait()
 					break;
@@ -336,6 +389,16 @@ void SysMtgsThread::ExecuteTaskInThread()
 
 							// CSR & 0x2000; is the pageflip id.
 							GSvsync(((u32&)RingBuffer.Regs[0x1000]) & 0x2000);
+
+							// The renderer refreshed its delayed GPU timer
+							// readback during the vsync above.
+							if (u32 gpu_us = GSgetGPUTimeUs())
+								PerfStats::AddMicroseconds(Subsys_GPU, gpu_us);
+
+							// The frame just went to the frontend; close its
+							// input-to-present latency sample.
+							PerfStats::VsyncPresented();
+
 							gsFrameSkip();
 
 #if 0
@@ -423,7 +486,7 @@ void SysMtgsThread::ExecuteTaskInThread()
 				}
 			}
 #ifdef __LIBRETRO__
-			if(tag.command == GS_RINGTYPE_VSYNC)
+			if(tag.command == GS_RINGTYPE_VSYNC && !m_Draining)
 			{
 #ifndef __LIBRETRO__
 				busy.Release();
@@ -461,6 +524,21 @@ void SysMtgsThread::ExecuteTaskInThread()
 	}
 }
 
+#ifdef __LIBRETRO__
+// Processes everything currently queued in the ring and returns once it runs
+// dry.  Unlike ExecuteTaskInThread() this doesn't stop at a vsync tag and never
+// sleeps waiting for more work.  The savestate path uses it to bring the GS to
+// a consistent point from the frontend thread (which doubles as the fake MTGS
+// thread in this build), and to unblock an EE thread that may be sleeping on
+// ring backpressure before we ask it to pause.
+void SysMtgsThread::DrainTaskInThread()
+{
+	m_Draining = true;
+	ExecuteTaskInThread();
+	m_Draining = false;
+}
+#endif
+
 void SysMtgsThread::FinishTaskInThread()
 {
 	if( m_SignalRingEnable.exchange(false) )
@@ -523,6 +601,8 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 	// we don't want to access the content of the queue
 
 	if (isMTVU || m_ReadPos.load(std::memory_order_relaxed) != m_WritePos.load(std::memory_order_relaxed)) {
+		PerfStats::Scope scope(Subsys_MTGS);
+
 		SetEvent();
 		RethrowException();
 		for(;;) {
@@ -605,7 +685,7 @@ void SysMtgsThread::GenericStall( uint size )
 	// But if not then we need to make sure the readpos is outside the scope of
 	// the block about to be written (writepos + size)
 
-	uint readpos = m_ReadPos.load(std::memory_order_acquire);
+	uint readpos = m_CachedReadPos;
 	uint freeroom;
 
 	if (writepos < readpos)
@@ -615,6 +695,21 @@ void SysMtgsThread::GenericStall( uint size )
 
 	if (freeroom <= size)
 	{
+		// The cached read position is stale by however much the MTGS thread has
+		// consumed since our last refresh; take the acquire load before concluding
+		// that we actually have to stall.
+		readpos = m_ReadPos.load(std::memory_order_acquire);
+
+		if (writepos < readpos)
+			freeroom = readpos - writepos;
+		else
+			freeroom = RingBufferSize - (writepos - readpos);
+	}
+
+	if (freeroom <= size)
+	{
+		PerfStats::Scope scope(Subsys_MTGS);
+
 		// writepos will overlap readpos if we commit the data, so we need to wait until
 		// readpos is out past the end of the future write pos, or until it wraps around
 		// (in which case writepos will be >= readpos).
@@ -671,6 +766,8 @@ void SysMtgsThread::GenericStall( uint size )
 			}
 		}
 	}
+
+	m_CachedReadPos = readpos;
 }
 
 void SysMtgsThread::PrepDataPacket( MTGS_RingCommand cmd, u32 size )
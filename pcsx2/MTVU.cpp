@@ -18,6 +18,7 @@
 #include "MTVU.h"
 #include "newVif.h"
 #include "Gif_Unit.h"
+#include "PerfStats.h"
 
 __aligned16 VU_Thread vu1Thread(CpuVU1, VU1);
 
@@ -113,6 +114,9 @@ void VU_Thread::Reset()
 	m_read_pos = 0;
 	memzero(vif);
 	memzero(vifRegs);
+	memzero(m_deps);
+	m_seq_written = 0;
+	m_seq_read = 0;
 	for (size_t i = 0; i < 4; ++i)
 		vu1Thread.vuCycles[i] = 0;
 	vu1Thread.gsInterrupts = 0;
@@ -193,6 +197,10 @@ void VU_Thread::ExecuteRingBuffer()
 			}
 
 			CommitReadPos();
+			// Release so the packet's memory writes are visible to an EE
+			// thread that sees the bumped count in WaitRange.
+			if (tag != MTVU_NULL_PACKET)
+				m_seq_read.fetch_add(1, std::memory_order_release);
 		}
 	}
 }
@@ -414,6 +422,8 @@ void VU_Thread::WaitVU()
 #if 0
 	MTVU_LOG("MTVU - WaitVU!");
 #endif
+	PerfStats::Scope scope(Subsys_MTVU);
+
 	for (;;)
 	{
 		if (IsDone())
@@ -428,6 +438,44 @@ void VU_Thread::WaitVU()
 	}
 }
 
+// Remembers what the packet being queued can touch; must be called once for
+// every packet written (the window ring is indexed by sequence number).
+__fi void VU_Thread::RecordDep(u8 space, u32 addr, u32 end)
+{
+	m_seq_written++;
+	DepEntry& dep = m_deps[m_seq_written % DepWindow];
+	dep.addr = addr;
+	dep.end = end;
+	dep.space = space;
+}
+
+void VU_Thread::WaitRange(int space, u32 addr, u32 size)
+{
+	u64 done = m_seq_read.load(std::memory_order_acquire);
+	if (done == m_seq_written)
+		return;
+
+	// Entries older than the window have been overwritten, so they have to
+	// be waited out unconditionally before the survivors can be scanned.
+	u64 target = done;
+	if (m_seq_written - done > DepWindow)
+		target = m_seq_written - DepWindow;
+
+	for (u64 seq = target + 1; seq <= m_seq_written; seq++)
+	{
+		const DepEntry& dep = m_deps[seq % DepWindow];
+		if (dep.space == DepSpace_Global ||
+			(dep.space == space && dep.addr < addr + size && addr < dep.end))
+			target = seq;
+	}
+
+	while (m_seq_read.load(std::memory_order_acquire) < target)
+	{
+		KickStart();
+		std::this_thread::yield();
+	}
+}
+
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
 {
 #if 0
@@ -439,6 +487,7 @@ void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
 	Write(vu_addr);
 	Write(vif_top);
 	Write(vif_itop);
+	RecordDep(DepSpace_Global, 0, 0); // a microprogram can store anywhere
 	CommitWritePos();
 	gifUnit.TransferGSPacketData(GIF_TRANS_MTVU, NULL, 0);
 	KickStart();
@@ -460,6 +509,18 @@ void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32
 	WriteRegs(&_vifRegs);
 	Write(size);
 	Write(data, size);
+	{
+		// Conservative span of data memory the unpack can write: in skipping
+		// mode (cl >= wl) every wl qwords written advance the address by cl.
+		u32 wl = _vifRegs.cycle.wl ? _vifRegs.cycle.wl : 256;
+		u32 num = _vifRegs.num ? _vifRegs.num : 256;
+		u32 span_qw = (_vifRegs.cycle.cl >= wl) ?
+			(num / wl) * _vifRegs.cycle.cl + (num % wl) : num;
+		u32 dep_addr = (_vif.tag.addr & 0x3fff);
+		u32 dep_end = dep_addr + span_qw * 16;
+		if (dep_end > 0x4000) { dep_addr = 0; dep_end = 0x4000; } // wraps
+		RecordDep(DepSpace_Data, dep_addr, dep_end);
+	}
 	CommitWritePos();
 	KickStart();
 }
@@ -474,6 +535,7 @@ void VU_Thread::WriteMicroMem(u32 vu_micro_addr, void* data, u32 size)
 	Write(vu_micro_addr);
 	Write(size);
 	Write(data, size);
+	RecordDep(DepSpace_Micro, vu_micro_addr, vu_micro_addr + size);
 	CommitWritePos();
 	KickStart();
 }
@@ -488,6 +550,7 @@ void VU_Thread::WriteDataMem(u32 vu_data_addr, void* data, u32 size)
 	Write(vu_data_addr);
 	Write(size);
 	Write(data, size);
+	RecordDep(DepSpace_Data, vu_data_addr, vu_data_addr + size);
 	CommitWritePos();
 	KickStart();
 }
@@ -500,6 +563,7 @@ void VU_Thread::WriteCol(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskCol)));
 	Write(MTVU_VIF_WRITE_COL);
 	Write(&_vif.MaskCol, sizeof(_vif.MaskCol));
+	RecordDep(DepSpace_None, 0, 0);
 	CommitWritePos();
 }
 
@@ -511,5 +575,6 @@ void VU_Thread::WriteRow(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskRow)));
 	Write(MTVU_VIF_WRITE_ROW);
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
+	RecordDep(DepSpace_None, 0, 0);
 	CommitWritePos();
 }
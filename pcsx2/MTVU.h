@@ -35,6 +35,20 @@ class VU_Thread : public pxThread {
 	__aligned(64) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
 	__aligned(64) int  m_read_pos; // temporary read pos (local to the VU thread)
 	int  m_write_pos; // temporary write pos (local to the EE thread)
+
+	// Per-packet dependency tracking for WaitRange.  Every packet gets a
+	// sequence number and an entry describing what it can touch; the entry
+	// ring is only ever accessed from the EE thread, the completed count is
+	// published by the VU thread.
+	static const u32 DepWindow = 64;
+	struct DepEntry {
+		u32 addr;  // first byte touched
+		u32 end;   // one past the last byte touched
+		u8  space; // DepSpace_*
+	};
+	DepEntry m_deps[DepWindow]; // indexed by seq % DepWindow (EE thread only)
+	u64 m_seq_written;          // packets queued (EE thread only)
+	__aligned(64) std::atomic<u64> m_seq_read; // packets completed (VU thread)
 	Mutex     mtxBusy;
 	Semaphore semaEvent;
 	BaseVUmicroCPU*& vuCPU;
@@ -53,6 +67,14 @@ public:
 		InterruptFlagLabel = 1 << 2,
 	};
 
+	// Memory space an in-flight packet can touch, for targeted waits.
+	enum DepSpace {
+		DepSpace_None,   // packet touches neither memory (col/row writes)
+		DepSpace_Data,   // known byte range of VU1 data memory
+		DepSpace_Micro,  // known byte range of VU1 micro memory
+		DepSpace_Global, // can touch anything (program execution)
+	};
+
 	std::atomic<u32> gsInterrupts; // Used for GS Signal, Finish etc
 	std::atomic<u64> gsLabel; // Used for GS Label command
 	std::atomic<u64> gsSignal; // Used for GS Signal command
@@ -71,6 +93,13 @@ public:
 	// Waits till MTVU is done processing
 	void WaitVU();
 
+	// Waits only until the newest in-flight packet that can touch the given
+	// byte range of the chosen memory space has been processed; returns
+	// immediately when nothing queued conflicts.  Falls back to the full
+	// drain semantics of WaitVU when an execute packet is in flight, since
+	// a microprogram can store anywhere.
+	void WaitRange(int space, u32 addr, u32 size);
+
 	void Get_GSChanges();
 
 	void ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop);
@@ -113,6 +142,8 @@ private:
 	void WriteRegs(VIFregisters* src);
 
 	u32 Get_vuCycles();
+
+	void RecordDep(u8 space, u32 addr, u32 end);
 };
 
 extern __aligned16 VU_Thread vu1Thread;
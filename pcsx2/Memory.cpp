@@ -38,6 +38,10 @@ BIOS
 
 #include "IopCommon.h"
 #include "GS.h"
+
+// Implemented in x86/ix86-32/iR5900-32.cpp: parks the page's blocks behind a
+// verification stub instead of clearing them outright.
+extern void recLazyClearPage(u32 paddr);
 #include "VUmicro.h"
 #include "MTVU.h"
 
@@ -425,34 +429,34 @@ template<int vunum> static mem8_t __fc vuMicroRead8(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Micro, addr, 1);
 	return vu->Micro[addr];
 }
 template<int vunum> static mem16_t __fc vuMicroRead16(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Micro, addr, 2);
 	return *(u16*)&vu->Micro[addr];
 }
 template<int vunum> static mem32_t __fc vuMicroRead32(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Micro, addr, 4);
 	return *(u32*)&vu->Micro[addr];
 }
 template<int vunum> static void __fc vuMicroRead64(u32 addr,mem64_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Micro, addr, 8);
 	*data=*(u64*)&vu->Micro[addr];
 }
 template<int vunum> static void __fc vuMicroRead128(u32 addr,mem128_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Micro, addr, 16);
 	
 	CopyQWC(data,&vu->Micro[addr]);
 }
@@ -530,31 +534,31 @@ template<int vunum> static void __fc vuMicroWrite128(u32 addr, const mem128_t* d
 template<int vunum> static mem8_t __fc vuDataRead8(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Data, addr, 1);
 	return vu->Mem[addr];
 }
 template<int vunum> static mem16_t __fc vuDataRead16(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Data, addr, 2);
 	return *(u16*)&vu->Mem[addr];
 }
 template<int vunum> static mem32_t __fc vuDataRead32(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Data, addr, 4);
 	return *(u32*)&vu->Mem[addr];
 }
 template<int vunum> static void __fc vuDataRead64(u32 addr, mem64_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Data, addr, 8);
 	*data=*(u64*)&vu->Mem[addr];
 }
 template<int vunum> static void __fc vuDataRead128(u32 addr, mem128_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitRange(VU_Thread::DepSpace_Data, addr, 16);
 	CopyQWC(data,&vu->Mem[addr]);
 }
 
@@ -936,7 +940,10 @@ static __fi void mmap_ClearCpuBlock( uint offset )
 
 	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
 	m_PageProtectInfo[rampage].Mode = ProtMode_Manual;
-	Cpu->Clear( m_PageProtectInfo[rampage].ReverseRamMap, 0x400 );
+
+	// Defers invalidation to each block's next entry, where the recompiler can tell
+	// modified code from untouched siblings on the same page (see iR5900-32.cpp).
+	recLazyClearPage( m_PageProtectInfo[rampage].ReverseRamMap );
 }
 
 void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& handled )
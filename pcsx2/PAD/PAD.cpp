@@ -25,13 +25,16 @@
 #include <stdarg.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include "../../libretro/libretro.h"
 #include "../../libretro/input.h"
+#include "../../libretro/input_trace.h"
 
 #include "PS2Edefs.h"
 #include "PAD.h"
+#include "PerfStats.h"
 
 #ifdef _WIN32
 #include <direct.h>
@@ -109,6 +112,17 @@ static struct retro_input_descriptor desc[] = {
 bool rumble_enabled   = true;
 uint16_t rumble_level = 0x0;
 
+// Late input sampling: instead of polling at the top of retro_run, the poll is
+// deferred to the first SIO pad query of the frame, which lands much closer to
+// the point where the game actually reads the buttons. The flag is armed on
+// the frontend thread and consumed on the EE thread, hence the atomic.
+static bool late_sampling = false;
+static std::atomic<bool> late_poll_armed(false);
+
+// Copies the frontend input state into s_button_state/s_axis_state once per
+// poll; everything downstream reads the snapshot.  Defined below keymap.
+static void pad_sample_state();
+
 namespace Input
 {
 
@@ -135,7 +149,22 @@ void Shutdown()
 
 void Update()
 {
-	poll_cb();
+	// An active input trace needs exactly one pad sample per retro_run to
+	// keep the record/replay streams in step, so it bypasses late sampling.
+	if (late_sampling && !InputTrace::IsRecording() && !InputTrace::IsReplaying())
+	{
+		// If the game never queried the pad last frame, the deferred poll was
+		// never consumed; run it here so the frontend still sees at least one
+		// poll per retro_run.
+		if (late_poll_armed.exchange(true))
+			poll_cb();
+	}
+	else
+	{
+		poll_cb();
+		pad_sample_state();
+		PerfStats::MarkInputPoll();
+	}
 	Pad::rumble_all();
 }
 
@@ -145,6 +174,11 @@ void RumbleEnabled(bool enabled, int percent)
 	setRumbleLevel(percent);
 }
 
+void LateSamplingEnabled(bool enabled)
+{
+	late_sampling = enabled;
+}
+
 void setRumbleLevel(int percent)
 {
 	if (percent > 100)
@@ -219,6 +253,31 @@ static int keymap[] =
 	RETRO_DEVICE_ID_JOYPAD_LEFT,   // PAD_LEFT
 };
 
+// Snapshot of the frontend input state, taken once per poll.  key_status_get
+// reads from here instead of calling input_cb per SIO byte, which gives the
+// input trace a single fixed-size record to capture or substitute per frame.
+// Axis order: LX, LY, RX, RY.  Buttons are indexed like keymap (PAD_* order)
+// and hold the raw analog-button pressure.
+static s16 s_button_state[2][16];
+static s16 s_axis_state[2][4];
+
+static void pad_sample_state()
+{
+	for (int pad = 0; pad < 2; pad++)
+	{
+		for (int k = 0; k < 16; k++)
+			s_button_state[pad][k] = input_cb(pad, RETRO_DEVICE_JOYPAD, RETRO_DEVICE_INDEX_ANALOG_BUTTON, keymap[k]);
+
+		s_axis_state[pad][0] = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X);
+		s_axis_state[pad][1] = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y);
+		s_axis_state[pad][2] = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X);
+		s_axis_state[pad][3] = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y);
+	}
+
+	// Deadzones are applied downstream, so the trace holds the raw values.
+	InputTrace::CaptureFrame(s_button_state, s_axis_state);
+}
+
 static int ApplyDeadZoneX(int val_x, int val_y, float deadzone_percent) 
 {
 	if (deadzone_percent == 0.0f) return val_x;
@@ -266,36 +325,36 @@ static u8 key_status_get(u32 pad, u32 index)
 	{
 		case PAD_R_LEFT:
 		case PAD_R_RIGHT:
-			x   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X);
-			y   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y);
+			x   = s_axis_state[pad][2];
+			y   = s_axis_state[pad][3];
 			val = ApplyDeadZoneX(x, y, option_pad_right_deadzone);
 			break;
 
 		case PAD_R_DOWN:
 		case PAD_R_UP:
-			x   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X);
-			y   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y);
+			x   = s_axis_state[pad][2];
+			y   = s_axis_state[pad][3];
 			val = ApplyDeadZoneY(x, y, option_pad_right_deadzone);
 			break;
 
 		case PAD_L_LEFT:
 		case PAD_L_RIGHT:
-			x   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X);
-			y   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y);
+			x   = s_axis_state[pad][0];
+			y   = s_axis_state[pad][1];
 			val = ApplyDeadZoneX(x, y, option_pad_left_deadzone);
 			break;
 
 		case PAD_L_DOWN:
 		case PAD_L_UP:
-			x   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X);
-			y   = input_cb(pad, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y);
+			x   = s_axis_state[pad][0];
+			y   = s_axis_state[pad][1];
 			val = ApplyDeadZoneY(x, y, option_pad_left_deadzone);
 			break;
 
 		default:
 			if (index < 16)
 			{
-				val = input_cb(pad, RETRO_DEVICE_JOYPAD, RETRO_DEVICE_INDEX_ANALOG_BUTTON, keymap[index]);
+				val = s_button_state[pad][index];
 				return 0xFF - (val >> 7);
 			}
 			break;
@@ -426,6 +485,16 @@ s32 PADfreeze(int mode, freezeData *data)
 
 u8 PADstartPoll(int pad)
 {
+    // First pad query of the frame consumes the deferred poll. Reading input
+    // from the EE thread matches what key_status_get already does with
+    // input_cb below.
+    if (late_sampling && late_poll_armed.exchange(false))
+    {
+        poll_cb();
+        pad_sample_state();
+        PerfStats::MarkInputPoll();
+    }
+
     return pad_start_poll(pad);
 }
 
@@ -97,6 +97,7 @@ u8 PADstartPoll(int pad);
 s32 PADinit(u32 flags);
 u8 PADpoll(u8 value);
 s32 PADsetSlot(u8 port, u8 slot);
+s32 PADfreeze(int mode, freezeData* data);
 void PADshutdown();
 
 #define MODE_DIGITAL 0x41
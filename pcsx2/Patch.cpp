@@ -23,6 +23,7 @@
 #include "MemoryPatchDatabase.h"
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <wx/textfile.h>
 #include <wx/dir.h>
@@ -40,6 +41,61 @@ extern void _ApplyPatch(IniPatch* p);
 
 static std::vector<IniPatch> Patch;
 
+// --------------------------------------------------------------------------------------
+//  Compiled frame-patch program
+// --------------------------------------------------------------------------------------
+// The continuously-applied patches run every vsync, and with the stacked cheat
+// databases (widescreen + 60fps + no-interlacing) plus user pnach files the raw
+// list easily reaches hundreds of lines, many of them boot-only or duplicates
+// of each other.  Instead of rescanning the whole list each frame, the
+// PPT_CONTINUOUSLY subset is compiled once into two flat programs:
+//
+// - plain pokes (byte/short/word/double), deduplicated by cpu/type/address
+//   with last-line-wins semantics, matching what sequential application would
+//   leave in memory anyway;
+// - extended (raw cheat engine) lines, kept verbatim and in file order, since
+//   their conditionals and pointer chains thread state from line to line.
+//
+// The program is rebuilt lazily whenever the patch list changes.  The pokes
+// still go through _ApplyPatch so the unchanged-value short circuit (and the
+// recompiler invalidation on a real write) stays in one place.
+static std::vector<IniPatch> s_frame_pokes;
+static std::vector<IniPatch> s_frame_interpreted;
+static bool s_frame_compiled = false;
+
+static void CompileFramePatches()
+{
+	s_frame_pokes.clear();
+	s_frame_interpreted.clear();
+
+	std::unordered_map<u64, size_t> poke_index;
+
+	for (const IniPatch& i : Patch)
+	{
+		if (!i.enabled || i.placetopatch != PPT_CONTINUOUSLY)
+			continue;
+
+		if (i.type == EXTENDED_T)
+		{
+			s_frame_interpreted.push_back(i);
+			continue;
+		}
+
+		const u64 key = ((u64)i.cpu << 36) | ((u64)i.type << 32) | i.addr;
+
+		auto it = poke_index.find(key);
+		if (it != poke_index.end())
+			s_frame_pokes[it->second] = i;
+		else
+		{
+			poke_index[key] = s_frame_pokes.size();
+			s_frame_pokes.push_back(i);
+		}
+	}
+
+	s_frame_compiled = true;
+}
+
 struct PatchTextTable
 {
 	int				code;
@@ -165,6 +221,7 @@ void inifile_process(wxTextFile& f1)
 void ForgetLoadedPatches()
 {
 	Patch.clear();
+	s_frame_compiled = false;
 }
 
 static int _LoadPatchFiles(const wxDirName& folderName, wxString& fileSpec, const wxString& friendlyName, int& numberFoundPatchFiles)
@@ -378,6 +435,7 @@ namespace PatchFunc
 
 			iPatch.enabled = 1; // omg success!!
 			Patch.push_back(iPatch);
+			s_frame_compiled = false;
 		}
 
 		return;
@@ -390,6 +448,20 @@ error:
 // This is for applying patches directly to memory
 void ApplyLoadedPatches(patch_place_type place)
 {
+	if (place == PPT_CONTINUOUSLY)
+	{
+		if (!s_frame_compiled)
+			CompileFramePatches();
+
+		for (auto& i : s_frame_pokes)
+			_ApplyPatch(&i);
+
+		for (auto& i : s_frame_interpreted)
+			_ApplyPatch(&i);
+
+		return;
+	}
+
 	for (auto& i : Patch)
 	{
 		if (i.placetopatch == place)
@@ -265,6 +265,8 @@ bool Pcsx2Config::GamefixOptions::Get( GamefixId id ) const
 }
 
 
+bool g_DeterministicMode = false;
+
 Pcsx2Config::Pcsx2Config()
 {
 	bitset = 0;
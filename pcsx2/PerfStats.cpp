@@ -0,0 +1,300 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "PerfStats.h"
+
+#include <wx/ffile.h>
+
+#include <atomic>
+#include <chrono>
+
+namespace PerfStats
+{
+	thread_local u64 t_scope_ticks = 0;
+
+	static const char* const s_names[Subsys_Count] = {"EE", "VU", "GS", "SPU2", "CDVD", "MTVU", "MTGS", "GPU"};
+
+	// Per-frame histogram over log2 microsecond buckets: bucket N counts
+	// frames that spent [2^N, 2^(N+1)) us in the subsystem (bucket 0 also
+	// takes 0us frames, the last bucket is open ended at ~32ms+).
+	static const int HistBuckets = 16;
+
+	static std::atomic<u64> s_accum[Subsys_Count];
+
+	static u64 s_hist[Subsys_Count][HistBuckets];
+	static u64 s_total_us[Subsys_Count];
+	static double s_avg_us[Subsys_Count];
+	static u64 s_frames = 0;
+
+	// rdtsc rate is calibrated continuously against the host clock, so the
+	// scopes themselves never need anything slower than rdtsc.
+	static u64 s_tsc_base = 0;
+	static std::chrono::steady_clock::time_point s_wall_base;
+	static double s_ticks_per_us = 0.0;
+
+	// Input-to-present latency.  The FIFO shadows the MTGS ring's vsync
+	// packets: the EE thread pushes the current poll stamp when it queues a
+	// vsync, the GS thread pops when it presents one.  A handful of slots is
+	// plenty since VsyncQueueSize bounds the vsyncs in flight.
+	static std::atomic<u64> s_input_poll_tsc(0);
+
+	static const int LatencyFifoSize = 8;
+	static u64 s_latency_fifo[LatencyFifoSize];
+	static std::atomic<u32> s_latency_wseq(0);
+	static u32 s_latency_rseq = 0;
+
+	// Linear 250us buckets up to 64ms keep the percentile readout fine
+	// grained where it matters (one to four frame periods).
+	static const int LatencyBuckets = 256;
+	static const u32 LatencyBucketUs = 250;
+	static u64 s_latency_hist[LatencyBuckets];
+	static u64 s_latency_samples = 0;
+	static double s_latency_avg_us = 0.0;
+	static u32 s_latency_last_us = 0;
+
+	static FILE* s_trace = NULL;
+	static char* s_trace_buf = NULL;
+	static u32 s_trace_frame = 0;
+	static std::chrono::steady_clock::time_point s_trace_last_wall;
+	static double s_vsync_hz = 0.0;
+
+	static const size_t TraceBufSize = 256 * 1024;
+
+	void Add(PerfSubsys subsys, u64 ticks)
+	{
+		s_accum[subsys].fetch_add(ticks, std::memory_order_relaxed);
+	}
+
+	void AddMicroseconds(PerfSubsys subsys, u64 us)
+	{
+		if (s_ticks_per_us > 0.0)
+			Add(subsys, (u64)(us * s_ticks_per_us));
+	}
+
+	void FrameBoundaryEE()
+	{
+		static thread_local u64 last_tsc = 0;
+		static thread_local u64 last_children = 0;
+
+		u64 now = Ticks();
+		if (last_tsc)
+		{
+			u64 total = now - last_tsc;
+			u64 children = t_scope_ticks - last_children;
+			if (total > children)
+				Add(Subsys_EE, total - children);
+		}
+		last_tsc = now;
+		last_children = t_scope_ticks;
+	}
+
+	void MarkInputPoll()
+	{
+		s_input_poll_tsc.store(Ticks(), std::memory_order_relaxed);
+	}
+
+	void VsyncQueued()
+	{
+		u32 seq = s_latency_wseq.load(std::memory_order_relaxed);
+		s_latency_fifo[seq % LatencyFifoSize] = s_input_poll_tsc.load(std::memory_order_relaxed);
+		s_latency_wseq.store(seq + 1, std::memory_order_release);
+	}
+
+	void VsyncPresented()
+	{
+		// Vsyncs raised outside the ring (resets, drains) have no token.
+		if (s_latency_rseq == s_latency_wseq.load(std::memory_order_acquire))
+			return;
+		u64 poll = s_latency_fifo[s_latency_rseq % LatencyFifoSize];
+		s_latency_rseq++;
+
+		if (!poll || s_ticks_per_us <= 0.0)
+			return; // no poll yet, or tick rate not calibrated
+
+		u64 us = (u64)((Ticks() - poll) / s_ticks_per_us);
+		int bucket = (int)(us / LatencyBucketUs);
+		if (bucket >= LatencyBuckets)
+			bucket = LatencyBuckets - 1;
+		s_latency_hist[bucket]++;
+		s_latency_samples++;
+		s_latency_avg_us = s_latency_avg_us * 0.95 + (double)us * 0.05;
+		s_latency_last_us = (u32)us;
+	}
+
+	// Percentile from the latency histogram, in microseconds (bucket centre).
+	static double LatencyPercentile(double p)
+	{
+		if (!s_latency_samples)
+			return 0.0;
+
+		u64 target = (u64)((double)s_latency_samples * p);
+		u64 seen = 0;
+		for (int i = 0; i < LatencyBuckets; i++)
+		{
+			seen += s_latency_hist[i];
+			if (seen > target)
+				return (i + 0.5) * LatencyBucketUs;
+		}
+		return (LatencyBuckets - 0.5) * LatencyBucketUs;
+	}
+
+	void FrameEnd()
+	{
+		u64 now_tsc = Ticks();
+		std::chrono::steady_clock::time_point now_wall = std::chrono::steady_clock::now();
+
+		if (!s_tsc_base)
+		{
+			s_tsc_base = now_tsc;
+			s_wall_base = now_wall;
+			return;
+		}
+
+		u64 wall_us = std::chrono::duration_cast<std::chrono::microseconds>(now_wall - s_wall_base).count();
+		if (wall_us < 1000)
+			return; // too soon to calibrate, keep accumulating
+		s_ticks_per_us = (double)(now_tsc - s_tsc_base) / (double)wall_us;
+
+		u32 frame_us[Subsys_Count];
+
+		for (int i = 0; i < Subsys_Count; i++)
+		{
+			u64 us = (u64)(s_accum[i].exchange(0, std::memory_order_relaxed) / s_ticks_per_us);
+			frame_us[i] = (u32)us;
+
+			int bucket = 0;
+			while (bucket < HistBuckets - 1 && (us >> (bucket + 1)))
+				bucket++;
+			s_hist[i][bucket]++;
+			s_total_us[i] += us;
+			s_avg_us[i] = s_avg_us[i] * 0.95 + (double)us * 0.05;
+		}
+		s_frames++;
+
+		if (s_trace)
+		{
+			u32 wall_dt_us = (u32)std::chrono::duration_cast<std::chrono::microseconds>(now_wall - s_trace_last_wall).count();
+			s_trace_last_wall = now_wall;
+
+			s32 drift_us = 0;
+			if (s_vsync_hz > 0.0)
+				drift_us = (s32)((double)wall_dt_us - 1e6 / s_vsync_hz);
+
+			u32 rec[4 + Subsys_Count] = {s_trace_frame++, wall_dt_us, (u32)drift_us, s_latency_last_us};
+			s_latency_last_us = 0;
+			memcpy(&rec[4], frame_us, sizeof(frame_us));
+			fwrite(rec, sizeof(rec), 1, s_trace);
+		}
+	}
+
+	void Reset()
+	{
+		for (int i = 0; i < Subsys_Count; i++)
+		{
+			s_accum[i].store(0, std::memory_order_relaxed);
+			memzero(s_hist[i]);
+			s_total_us[i] = 0;
+			s_avg_us[i] = 0.0;
+		}
+		s_frames = 0;
+		s_tsc_base = 0;
+
+		// The FIFO sequence counters are deliberately left alone: the EE
+		// thread may be mid-queue, and an unmatched token is dropped by the
+		// calibration guard anyway.
+		memzero(s_latency_hist);
+		s_latency_samples = 0;
+		s_latency_avg_us = 0.0;
+		s_latency_last_us = 0;
+	}
+
+	void FormatOverlay(char* dst, int len)
+	{
+		snprintf(dst, len, "EE %.2f | VU %.2f | GS %.2f | SPU2 %.2f | CDVD %.2f | MTVU %.2f | MTGS %.2f | GPU %.2f ms/frame | lat %.1f/%.1f ms",
+				 s_avg_us[Subsys_EE] / 1000.0, s_avg_us[Subsys_VU] / 1000.0,
+				 s_avg_us[Subsys_GS] / 1000.0, s_avg_us[Subsys_SPU2] / 1000.0,
+				 s_avg_us[Subsys_CDVD] / 1000.0, s_avg_us[Subsys_MTVU] / 1000.0,
+				 s_avg_us[Subsys_MTGS] / 1000.0, s_avg_us[Subsys_GPU] / 1000.0,
+				 LatencyPercentile(0.50) / 1000.0, LatencyPercentile(0.99) / 1000.0);
+	}
+
+	bool TraceStart(const wxString& path)
+	{
+		if (s_trace)
+			return true;
+
+		FILE* file = fopen(path.ToUTF8(), "wb");
+		if (!file)
+			return false;
+
+		// One big stdio buffer so the per-frame fwrite is just a memcpy and
+		// the actual flush to disk only happens every few thousand frames.
+		s_trace_buf = new char[TraceBufSize];
+		setvbuf(file, s_trace_buf, _IOFBF, TraceBufSize);
+
+		const u32 header[4] = {0x52543250 /* "P2TR" */, 2, (u32)((4 + Subsys_Count) * sizeof(u32)), Subsys_Count};
+		fwrite(header, sizeof(header), 1, file);
+
+		s_trace_frame = 0;
+		s_trace_last_wall = std::chrono::steady_clock::now();
+		s_trace = file;
+		return true;
+	}
+
+	void TraceStop()
+	{
+		if (!s_trace)
+			return;
+
+		fclose(s_trace);
+		s_trace = NULL;
+
+		delete[] s_trace_buf;
+		s_trace_buf = NULL;
+	}
+
+	void SetVSyncRate(double hz)
+	{
+		s_vsync_hz = hz;
+	}
+
+	bool ExportJson(const wxString& path)
+	{
+		wxFFile file(path, L"wb");
+		if (!file.IsOpened())
+			return false;
+
+		wxString out = wxsFormat(L"{\n  \"frames\": %llu,\n  \"subsystems\": [\n", (unsigned long long)s_frames);
+		for (int i = 0; i < Subsys_Count; i++)
+		{
+			out += wxsFormat(L"    {\"name\": \"%s\", \"total_ms\": %.3f, \"avg_us\": %.1f, \"hist_log2_us\": [",
+							 wxString::FromUTF8(s_names[i]).c_str(), s_total_us[i] / 1000.0, s_avg_us[i]);
+			for (int b = 0; b < HistBuckets; b++)
+				out += wxsFormat(b ? L", %llu" : L"%llu", (unsigned long long)s_hist[i][b]);
+			out += wxsFormat(L"]}%s\n", (i + 1 < Subsys_Count) ? L"," : L"");
+		}
+		out += wxsFormat(L"  ],\n  \"input_latency\": {\"samples\": %llu, \"p50_ms\": %.2f, \"p95_ms\": %.2f, \"p99_ms\": %.2f, \"avg_ms\": %.2f, \"hist_250us\": [",
+						 (unsigned long long)s_latency_samples,
+						 LatencyPercentile(0.50) / 1000.0, LatencyPercentile(0.95) / 1000.0,
+						 LatencyPercentile(0.99) / 1000.0, s_latency_avg_us / 1000.0);
+		for (int b = 0; b < LatencyBuckets; b++)
+			out += wxsFormat(b ? L", %llu" : L"%llu", (unsigned long long)s_latency_hist[b]);
+		out += L"]}\n}\n";
+
+		file.Write(out);
+		return true;
+	}
+}
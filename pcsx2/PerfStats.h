@@ -0,0 +1,139 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Pcsx2Types.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+// Always-compiled, sampling-based subsystem timing.  Scopes cost two rdtsc
+// reads and a relaxed atomic add, cheap enough to leave on in production;
+// everything heavier (histogram folding, text/JSON formatting) happens once
+// per frame on the frontend thread.
+enum PerfSubsys
+{
+	Subsys_EE = 0, // EE recompiler, measured as frame time minus nested scopes
+	Subsys_VU,     // microVU program execution
+	Subsys_GS,     // GIF packet transfers on the GS thread
+	Subsys_SPU2,   // SPU2 mixing/update
+	Subsys_CDVD,   // disc image reads
+	Subsys_MTVU,   // EE thread stalls waiting on the MTVU thread
+	Subsys_MTGS,   // stalls waiting on the GS thread (WaitGS, ring buffer full)
+	Subsys_GPU,    // whole-frame GPU execution time from backend timer queries
+	Subsys_Count
+};
+
+namespace PerfStats
+{
+	// Cumulative time spent inside scopes on this thread; lets an enclosing
+	// measurement (a scope or the EE frame boundary) subtract its children
+	// and record exclusive time.
+	extern thread_local u64 t_scope_ticks;
+
+	static __fi u64 Ticks() { return __rdtsc(); }
+
+	void Add(PerfSubsys subsys, u64 ticks);
+
+	// For sources that report real time instead of rdtsc ticks (GPU timer
+	// queries); dropped until the tick rate has been calibrated (~1s).
+	void AddMicroseconds(PerfSubsys subsys, u64 us);
+
+	class Scope
+	{
+	public:
+		__fi Scope(PerfSubsys subsys)
+			: m_subsys(subsys)
+			, m_start(Ticks())
+			, m_saved(t_scope_ticks)
+		{
+			t_scope_ticks = 0;
+		}
+
+		__fi ~Scope()
+		{
+			u64 total = Ticks() - m_start;
+			u64 self = (total > t_scope_ticks) ? total - t_scope_ticks : 0;
+			Add(m_subsys, self);
+			t_scope_ticks = m_saved + total;
+		}
+
+	private:
+		PerfSubsys m_subsys;
+		u64 m_start;
+		u64 m_saved;
+	};
+
+	// Called once per emulated vsync on the EE thread; attributes the time
+	// since the previous boundary, minus nested scopes, to Subsys_EE.
+	void FrameBoundaryEE();
+
+	// ------------------------------------------------------------------------
+	// Input-to-present latency.  A frame "token" is the rdtsc stamp of the
+	// last pad poll; it rides a tiny FIFO alongside the MTGS ring so the
+	// stamp taken when the EE queues a vsync packet is paired with that same
+	// packet's presentation on the GS thread.  Cross-thread rdtsc comparison
+	// is safe on anything with an invariant TSC, same assumption the scope
+	// timers already make.
+	//
+	// MarkInputPoll   - wherever poll_cb() runs (frontend Update, late poll)
+	// VsyncQueued     - EE thread, when the vsync packet enters the ring
+	// VsyncPresented  - GS thread, after GSvsync hands the frame over
+	//
+	// Queued/Presented pair strictly FIFO, matching ring buffer order.
+	void MarkInputPoll();
+	void VsyncQueued();
+	void VsyncPresented();
+
+	// Called once per host frame on the frontend thread: folds the per-frame
+	// accumulators into the histograms and rolling averages.
+	void FrameEnd();
+
+	void Reset();
+
+	// One-line per-subsystem ms/frame summary for the OSD.
+	void FormatOverlay(char* dst, int len);
+
+	// Dumps frame counts, totals and the per-frame microsecond histograms.
+	bool ExportJson(const wxString& path);
+
+	// ------------------------------------------------------------------------
+	// Per-frame binary trace.  Appended once per host frame from FrameEnd(),
+	// through a large stdio buffer so the steady-state cost is one record
+	// copy; cheap enough to leave on for whole sessions.
+	//
+	// File format (little endian):
+	//   header : char magic[4] = "P2TR", u32 version = 2,
+	//            u32 record_bytes, u32 subsys_count
+	//   record : u32 frame, u32 wall_dt_us, s32 vsync_drift_us,
+	//            u32 input_latency_us, u32 subsys_us[subsys_count]
+	//
+	// wall_dt_us is the host time since the previous record, vsync_drift_us
+	// is that minus the emulated vsync period (positive = running slow).
+	// input_latency_us is the pad-poll-to-present time of the most recent
+	// frame presented before this record (0 if none; version 2 addition).
+	// subsys_us is indexed by PerfSubsys.  record_bytes/subsys_count keep
+	// old readers working when subsystems are added.
+	bool TraceStart(const wxString& path);
+	void TraceStop();
+
+	// Emulated vsync rate in Hz, used to compute vsync_drift_us; reported by
+	// Counters.cpp whenever the video mode changes.
+	void SetVSyncRate(double hz);
+}
@@ -233,6 +233,14 @@ void iopTestIntc()
 
 	if( !eeEventTestIsActive )
 	{
+		// IRQ coalescing: if a previous device IRQ already armed a near EE-side
+		// wakeup that hasn't run yet, the pending event test will see this line's
+		// 0x1070 bit too (the exception path services the OR of all raised lines),
+		// so one wakeup delivers the whole batch at the deadline already scheduled.
+		// Device IRQ storms during FMV+audio streaming hit this path hard.
+		if( iopEventAction && (int)(g_nextEventCycle - cpuRegs.cycle) <= 16 )
+			return;
+
 		// An iop exception has occurred while the EE is running code.
 		// Inform the EE to branch so the IOP can handle it promptly:
 
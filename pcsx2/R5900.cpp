@@ -32,6 +32,7 @@
 
 #include "Elfheader.h"
 #include "CDVD/CDVD.h"
+#include "SaveState.h"
 #include "Patch.h"
 #include "GameDatabase.h"
 
@@ -58,6 +59,64 @@ bool eeEventTestIsActive = false;
 
 u32 g_eeloadMain = 0, g_eeloadExec = 0, g_osdsys_str = 0;
 
+// Per-range execution policies (see R5900.h).  A handful of ranges per title
+// at most, so a flat array beats anything fancier; lookups happen once per
+// block compile, never at runtime.
+struct EEExecRange
+{
+	u32 start;
+	u32 end; // exclusive
+	EEExecPolicy policy;
+};
+
+static std::vector<EEExecRange> s_execRanges;
+
+void eeClearExecPolicyRanges()
+{
+	s_execRanges.clear();
+}
+
+void eeAddExecPolicyRange(u32 start, u32 end, EEExecPolicy policy)
+{
+	if (end <= start)
+		return;
+
+	s_execRanges.push_back({start, end, policy});
+}
+
+bool eeHasExecPolicyRanges()
+{
+	return !s_execRanges.empty();
+}
+
+EEExecPolicy eeExecPolicyAt(u32 addr, u32* start, u32* end)
+{
+	for (const EEExecRange& r : s_execRanges)
+	{
+		if (addr >= r.start && addr < r.end)
+		{
+			if (start) *start = r.start;
+			if (end) *end = r.end;
+			return r.policy;
+		}
+	}
+
+	return EEExec_Rec;
+}
+
+u32 eeNextExecPolicyBoundary(u32 addr)
+{
+	u32 next = 0xffffffff;
+
+	for (const EEExecRange& r : s_execRanges)
+	{
+		if (r.start > addr) next = std::min(next, r.start);
+		if (r.end > addr) next = std::min(next, r.end);
+	}
+
+	return next;
+}
+
 /* I don't know how much space for args there is in the memory block used for args in full boot mode,
 but in fast boot mode, the block we use can fit at least 16 argv pointers (varies with BIOS version).
 The second EELOAD call during full boot has three built-in arguments ("EELOAD rom0:PS2LOGO <ELF>"),
@@ -120,6 +179,8 @@ void cpuReset()
 	LastELF = L"";
 
 	g_eeloadMain = 0, g_eeloadExec = 0, g_osdsys_str = 0;
+
+	KernelBootSnapshot_SessionReset();
 }
 
 void cpuShutdown()
@@ -280,6 +341,31 @@ static __fi void TESTINT( u8 n, void (*callback)() )
 		cpuSetNextEvent( cpuRegs.sCycle[n], cpuRegs.eCycle[n] );
 }
 
+// The event sources tested on each pass, in priority order. The order is kept
+// from the old unconditional test chain (common DMA channels first), since the
+// relative order at a shared deadline is observable by games.
+static const struct { u8 n; void (*callback)(); } s_eeInts[] =
+{
+	{ DMAC_VIF1,		vif1Interrupt },
+	{ DMAC_GIF,			gifInterrupt },
+	{ DMAC_SIF0,		EEsif0Interrupt },
+	{ DMAC_SIF1,		EEsif1Interrupt },
+	{ DMAC_VIF0,		vif0Interrupt },
+	{ DMAC_FROM_IPU,	ipu0Interrupt },
+	{ DMAC_TO_IPU,		ipu1Interrupt },
+	{ DMAC_FROM_SPR,	SPRFROMinterrupt },
+	{ DMAC_TO_SPR,		SPRTOinterrupt },
+	{ DMAC_MFIFO_VIF,	vifMFIFOInterrupt },
+	{ DMAC_MFIFO_GIF,	gifMFIFOInterrupt },
+	{ VIF_VU0_FINISH,	vif0VUFinish },
+	{ VIF_VU1_FINISH,	vif1VUFinish },
+};
+
+#define EE_TEST_INT_MASK ( \
+	(1 << DMAC_VIF0) | (1 << DMAC_VIF1) | (1 << DMAC_GIF) | (1 << DMAC_SIF0) | (1 << DMAC_SIF1) \
+	| (1 << DMAC_FROM_IPU) | (1 << DMAC_TO_IPU) | (1 << DMAC_FROM_SPR) | (1 << DMAC_TO_SPR) \
+	| (1 << DMAC_MFIFO_VIF) | (1 << DMAC_MFIFO_GIF) | (1 << VIF_VU0_FINISH) | (1 << VIF_VU1_FINISH))
+
 // [TODO] move this function to LegacyDmac.cpp, and remove most of the DMAC-related headers from
 // being included into R5900.cpp.
 static __fi void _cpuTestInterrupts()
@@ -292,32 +378,32 @@ static __fi void _cpuTestInterrupts()
 	/* These are 'pcsx2 interrupts', they handle asynchronous stuff
 	   that depends on the cycle timings */
 
-	TESTINT(DMAC_VIF1,		vif1Interrupt);	
-	TESTINT(DMAC_GIF,		gifInterrupt);
-	TESTINT(DMAC_SIF0,		EEsif0Interrupt);
-	TESTINT(DMAC_SIF1,		EEsif1Interrupt);
-	
-	// Profile-guided Optimization (sorta)
-	// The following ints are rarely called.  Encasing them in a conditional
-	// as follows helps speed up most games.
+	// Work off a local pending mask so the walk stops as soon as the tested
+	// sources are exhausted; most passes have none or one bit set, making
+	// the test O(pending) instead of a fixed chain of per-source tests.
+	u32 pending = cpuRegs.interrupt & EE_TEST_INT_MASK;
+	u32 tested  = 0;
 
-	if (cpuRegs.interrupt & ((1 << DMAC_VIF0) | (1 << DMAC_FROM_IPU) | (1 << DMAC_TO_IPU)
-		| (1 << DMAC_FROM_SPR) | (1 << DMAC_TO_SPR) | (1 << DMAC_MFIFO_VIF) | (1 << DMAC_MFIFO_GIF)
-		| (1 << VIF_VU0_FINISH) | (1 << VIF_VU1_FINISH)))
+	for (size_t i = 0; i < ArraySize(s_eeInts); i++)
 	{
-		TESTINT(DMAC_VIF0,		vif0Interrupt);
-
-		TESTINT(DMAC_FROM_IPU,	ipu0Interrupt);
-		TESTINT(DMAC_TO_IPU,	ipu1Interrupt);
+		if (!pending)
+			break;
 
-		TESTINT(DMAC_FROM_SPR,	SPRFROMinterrupt);
-		TESTINT(DMAC_TO_SPR,	SPRTOinterrupt);
+		const u32 bit = 1u << s_eeInts[i].n;
+		tested |= bit;
 
-		TESTINT(DMAC_MFIFO_VIF, vifMFIFOInterrupt);
-		TESTINT(DMAC_MFIFO_GIF, gifMFIFOInterrupt);
-
-		TESTINT(VIF_VU0_FINISH, vif0VUFinish);
-		TESTINT(VIF_VU1_FINISH, vif1VUFinish);
+		if (pending & bit)
+		{
+			TESTINT(s_eeInts[i].n, s_eeInts[i].callback);
+
+			// A callback may raise a later source with a zero-cycle delay
+			// (load-bearing timing hacks; see "Gets the timing right -
+			// Flatout" in Vif.cpp).  The old unconditional chain dispatched
+			// those in the same pass, so refresh the snapshot -- but never
+			// revisit sources already walked this pass, which it didn't do
+			// either.
+			pending = cpuRegs.interrupt & EE_TEST_INT_MASK & ~tested;
+		}
 	}
 }
 
@@ -619,6 +705,11 @@ void __fastcall eeloadHook()
 	wxString discelf;
 	int disctype = GetPS2ElfName(discelf);
 
+	// First time through on a fast boot we're sitting at the EELOAD main entry with
+	// kernel init freshly completed and nothing game-specific patched in yet -- the
+	// one point worth snapshotting for later boots to resume from.
+	KernelBootSnapshot_Capture(disctype);
+
 	std::string elfname;
 	int argc = cpuRegs.GPR.n.a0.SD[0];
 	if (argc) // calls to EELOAD *after* the first one during the startup process will come here
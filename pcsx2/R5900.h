@@ -156,22 +156,30 @@ union CP0regs {
 
 struct cpuRegisters {
 	GPRregs GPR;		// GPR regs
-	// NOTE: don't change order since recompiler uses it
+	// NOTE: don't change order since recompiler uses it -- HI and LO are
+	// addressed as GPR indices 32/33 (XMMGPR_HI/XMMGPR_LO).
 	GPR_reg HI;
 	GPR_reg LO;			// hi & log 128bit wide
 	CP0regs CP0;		// is COP0 32bit?
+	u32 _hotpad[8];		// pushes the hot block below onto its own 64-byte line
+	// Hot scheduling state: everything the dispatcher and event test touch
+	// every block lives in this one cache line (offset 704, 36 bytes).  The
+	// recompiler reaches all of it through symbolic addresses, so only the
+	// savestate layout cares about the exact offsets.
 	u32 sa;				// shift amount (32bit), needs to be 16 byte aligned
 	u32 IsDelaySlot;	// set true when the current instruction is a delay slot.
-	u32 pc;				// Program counter, when changing offset in struct, check iR5900-X.S to make sure offset is correct
+	u32 pc;				// Program counter
 	u32 code;			// current instruction
-	PERFregs PERF;
-	u32 eCycle[32];
-	u32 sCycle[32];		// for internal counters
 	u32 cycle;			// calculate cpucycles..
 	u32 interrupt;
 	int branch;
 	int opmode;			// operating mode
 	u32 tempcycles;
+	// Cold per-interrupt bookkeeping, only touched when an event is
+	// scheduled or serviced.
+	PERFregs PERF;
+	u32 eCycle[32];
+	u32 sCycle[32];		// for internal counters
 };
 
 // used for optimization
@@ -268,6 +276,38 @@ void intSetBranch();
 // parts of the Recs (namely COP0's branch codes and stuff).
 void __fastcall intDoBranch(u32 target);
 
+// --------------------------------------------------------------------------------------
+//  Per-range execution policies (game database 'execPolicies')
+// --------------------------------------------------------------------------------------
+// Lets the game database pin a fragile function to the interpreter, or to a
+// recompile mode that tests events on every block exit, without turning the
+// recompiler off for the whole game.  Ranges are virtual EE addresses with an
+// exclusive end, applied by loadGameSettings and consulted by recRecompile.
+enum EEExecPolicy
+{
+	EEExec_Rec = 0,   // default: plain recompilation
+	EEExec_Interpret, // hand the range to the interpreter
+	EEExec_SyncRec    // recompile, but exit through the event dispatcher every block
+};
+
+extern void eeClearExecPolicyRanges();
+extern void eeAddExecPolicyRange(u32 start, u32 end, EEExecPolicy policy);
+extern bool eeHasExecPolicyRanges();
+extern EEExecPolicy eeExecPolicyAt(u32 addr, u32* start = NULL, u32* end = NULL);
+// Next range start or end strictly above addr (0xffffffff if none); block
+// scanning stops there so compiled code never runs into a policed range.
+extern u32 eeNextExecPolicyBoundary(u32 addr);
+
+// Runs the interpreter until control leaves [start, end); the recompiler calls
+// this from the stub blocks it emits for interpreted policy ranges.
+extern void intExecuteRange(u32 start, u32 end);
+
+// Aborts the instruction the interpreter is currently executing and resumes
+// its main loop (the vtlb miss path uses this after raising the guest TLB
+// exception).  Returns via fastjmp when intExecute's resume point is armed,
+// and falls back to throwing Exception::CancelInstruction otherwise.
+extern void intCancelInstruction();
+
 // modules loaded at hardcoded addresses by the kernel
 const u32 EEKERNEL_START	= 0;
 const u32 EENULL_START		= 0x81FC0;
@@ -16,8 +16,11 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 
+#include <emmintrin.h>
+
 /* Forward declaration */
 extern retro_audio_sample_t sample_cb;
+extern retro_audio_sample_batch_t batch_cb;
 
 static const s32 tbl_XA_Factor[16][2] =
 	{
@@ -109,11 +112,14 @@ static void __forceinline IncrementNextA(V_Core& thiscore, uint voiceidx)
 	// Important!  Both cores signal IRQ when an address is read, regardless of
 	// which core actually reads the address.
 
-	for (int i = 0; i < 2; i++)
+	if (SpuIrqArmed)
 	{
-		if (Cores[i].IRQEnable && (vc.NextA == Cores[i].IRQA))
+		for (int i = 0; i < 2; i++)
 		{
-			SetIrqCall(i);
+			if (Cores[i].IRQEnable && (vc.NextA == Cores[i].IRQA))
+			{
+				SetIrqCall(i);
+			}
 		}
 	}
 
@@ -163,9 +169,10 @@ static __forceinline s32 GetNextDataBuffered(V_Core& thiscore, uint voiceidx)
 
 		// We'll need the loop flags and buffer pointers regardless of cache status:
 
-		for (int i = 0; i < 2; i++)
-			if (Cores[i].IRQEnable && Cores[i].IRQA == (vc.NextA & 0xFFFF8))
-				SetIrqCall(i);
+		if (SpuIrqArmed)
+			for (int i = 0; i < 2; i++)
+				if (Cores[i].IRQEnable && Cores[i].IRQA == (vc.NextA & 0xFFFF8))
+					SetIrqCall(i);
 
 		s16* memptr = GetMemPtr(vc.NextA & 0xFFFF8);
 		vc.LoopFlags = *memptr >> 8; // grab loop flags from the upper byte.
@@ -219,9 +226,10 @@ static __forceinline void GetNextDataDummy(V_Core& thiscore, uint voiceidx)
 
 	if (vc.SCurrent == 28)
 	{
-		for (int i = 0; i < 2; i++)
-			if (Cores[i].IRQEnable && Cores[i].IRQA == (vc.NextA & 0xFFFF8))
-				SetIrqCall(i);
+		if (SpuIrqArmed)
+			for (int i = 0; i < 2; i++)
+				if (Cores[i].IRQEnable && Cores[i].IRQA == (vc.NextA & 0xFFFF8))
+					SetIrqCall(i);
 
 		vc.LoopFlags = *GetMemPtr(vc.NextA & 0xFFFF8) >> 8; // grab loop flags from the upper byte.
 
@@ -454,12 +462,15 @@ static __forceinline s32 GetNoiseValues(V_Core& thiscore, uint voiceidx)
 static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 {
 	// Fixes some of the oldest hangs in pcsx2's history! :p
-	for (int i = 0; i < 2; i++)
+	if (SpuIrqArmed)
 	{
-		if (Cores[i].IRQEnable && Cores[i].IRQA == addr)
+		for (int i = 0; i < 2; i++)
 		{
-			//printf("Core %d special write IRQ Called (IRQ passed). IRQA = %x\n",i,addr);
-			SetIrqCall(i);
+			if (Cores[i].IRQEnable && Cores[i].IRQA == addr)
+			{
+				//printf("Core %d special write IRQ Called (IRQ passed). IRQA = %x\n",i,addr);
+				SetIrqCall(i);
+			}
 		}
 	}
 // throw an assertion if the memory range is invalid:
@@ -557,21 +568,50 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 const VoiceMixSet VoiceMixSet::Empty((StereoOut32()), (StereoOut32())); // Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
+// Finished sample pairs are collected into a small block and handed to the
+// frontend in one batch call; pushing 48k individual sample callbacks a second
+// through the libretro layer costs more than the gate mixing itself.
+static const uint OutputBlockFrames = 128;
+static s16 OutputBlock[OutputBlockFrames * 2];
+static uint OutputBlockPos = 0;
+
+static void FlushOutputBlock()
+{
+	if (OutputBlockPos == 0)
+		return;
+
+	if (batch_cb)
+		batch_cb(OutputBlock, OutputBlockPos);
+	else
+		for (uint i = 0; i < OutputBlockPos; i++)
+			sample_cb(OutputBlock[i * 2], OutputBlock[i * 2 + 1]);
+
+	OutputBlockPos = 0;
+}
+
 static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
 
+	// Accumulate (Dry.L, Dry.R, Wet.L, Wet.R) four-wide across the voices.
+	// The voice gates are 0 / -1 s16 masks, so sign-extending them gives the
+	// same AND behavior as the old scalar per-channel code.
+	__m128i acc = _mm_loadu_si128((__m128i*)&dest.Dry.Left);
+
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
 		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
 
 		// Note: Results from MixVoice are ranged at 16 bits.
 
-		dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+		__m128i gates = _mm_loadl_epi64((const __m128i*)&thiscore.VoiceGates[voiceidx]);
+		gates = _mm_srai_epi32(_mm_unpacklo_epi16(gates, gates), 16);
+
+		const __m128i val = _mm_setr_epi32(VVal.Left, VVal.Right, VVal.Left, VVal.Right);
+		acc = _mm_add_epi32(acc, _mm_and_si128(val, gates));
 	}
+
+	_mm_storeu_si128((__m128i*)&dest.Dry.Left, acc);
 }
 
 StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
@@ -709,7 +749,10 @@ __forceinline
 
 		Out = clamp_mix(Out, SndOutVolumeShift);
 	}
-	sample_cb(Out.Left >> 12, Out.Right >> 12);
+	OutputBlock[OutputBlockPos * 2 + 0] = (s16)(Out.Left >> 12);
+	OutputBlock[OutputBlockPos * 2 + 1] = (s16)(Out.Right >> 12);
+	if (++OutputBlockPos == OutputBlockFrames)
+		FlushOutputBlock();
 
 	// Update AutoDMA output positioning
 	OutPos++;
@@ -16,22 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 
-__forceinline s32 V_Core::RevbGetIndexer(s32 offset)
-{
-	u32 pos = ReverbX + offset;
-
-	// Fast and simple single step wrapping, made possible by the preparation of the
-	// effects buffer addresses.
-
-	if (pos > EffectsEndA)
-	{
-		pos -= EffectsEndA + 1;
-		pos += EffectsStartA;
-	}
-
-	assert(pos >= EffectsStartA && pos <= EffectsEndA);
-	return pos;
-}
+#include <emmintrin.h>
 
 void V_Core::Reverb_AdvanceBuffer()
 {
@@ -58,24 +43,43 @@ StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 	bool R = Cycles & 1;
 
 	// Calculate the read/write addresses we'll be needing for this session of reverb.
+	// The channel's offsets are pre-packed by UpdateEffectsBufferSize, so all 14
+	// addresses are produced by four add/wrap vector steps.  Wrapping is the same
+	// fast single-step scheme the scalar indexer used, made possible by the
+	// preparation of the effects buffer addresses.
+
+	__aligned16 u32 addr[16];
+
+	{
+		const __m128i rx = _mm_set1_epi32(ReverbX);
+		const __m128i end = _mm_set1_epi32(EffectsEndA);
+		const __m128i wrap = _mm_set1_epi32(EffectsStartA - EffectsEndA - 1);
+
+		for (int i = 0; i < 16; i += 4)
+		{
+			__m128i pos = _mm_add_epi32(_mm_load_si128((__m128i*)&RevbPacked[Index][R][i]), rx);
+			pos = _mm_add_epi32(pos, _mm_and_si128(_mm_cmpgt_epi32(pos, end), wrap));
+			_mm_store_si128((__m128i*)&addr[i], pos);
+		}
+	}
 
-	const u32 same_src = RevbGetIndexer(R ? RevBuffers.SAME_R_SRC : RevBuffers.SAME_L_SRC);
-	const u32 same_dst = RevbGetIndexer(R ? RevBuffers.SAME_R_DST : RevBuffers.SAME_L_DST);
-	const u32 same_prv = RevbGetIndexer(R ? RevBuffers.SAME_R_PRV : RevBuffers.SAME_L_PRV);
+	const u32 same_src = addr[0];
+	const u32 same_dst = addr[1];
+	const u32 same_prv = addr[2];
 
-	const u32 diff_src = RevbGetIndexer(R ? RevBuffers.DIFF_L_SRC : RevBuffers.DIFF_R_SRC);
-	const u32 diff_dst = RevbGetIndexer(R ? RevBuffers.DIFF_R_DST : RevBuffers.DIFF_L_DST);
-	const u32 diff_prv = RevbGetIndexer(R ? RevBuffers.DIFF_R_PRV : RevBuffers.DIFF_L_PRV);
+	const u32 diff_src = addr[3];
+	const u32 diff_dst = addr[4];
+	const u32 diff_prv = addr[5];
 
-	const u32 comb1_src = RevbGetIndexer(R ? RevBuffers.COMB1_R_SRC : RevBuffers.COMB1_L_SRC);
-	const u32 comb2_src = RevbGetIndexer(R ? RevBuffers.COMB2_R_SRC : RevBuffers.COMB2_L_SRC);
-	const u32 comb3_src = RevbGetIndexer(R ? RevBuffers.COMB3_R_SRC : RevBuffers.COMB3_L_SRC);
-	const u32 comb4_src = RevbGetIndexer(R ? RevBuffers.COMB4_R_SRC : RevBuffers.COMB4_L_SRC);
+	const u32 comb1_src = addr[6];
+	const u32 comb2_src = addr[7];
+	const u32 comb3_src = addr[8];
+	const u32 comb4_src = addr[9];
 
-	const u32 apf1_src = RevbGetIndexer(R ? RevBuffers.APF1_R_SRC : RevBuffers.APF1_L_SRC);
-	const u32 apf1_dst = RevbGetIndexer(R ? RevBuffers.APF1_R_DST : RevBuffers.APF1_L_DST);
-	const u32 apf2_src = RevbGetIndexer(R ? RevBuffers.APF2_R_SRC : RevBuffers.APF2_L_SRC);
-	const u32 apf2_dst = RevbGetIndexer(R ? RevBuffers.APF2_R_DST : RevBuffers.APF2_L_DST);
+	const u32 apf1_src = addr[10];
+	const u32 apf1_dst = addr[11];
+	const u32 apf2_src = addr[12];
+	const u32 apf2_dst = addr[13];
 
 	// -----------------------------------------
 	//          Optimized IRQ Testing !
@@ -84,21 +88,21 @@ StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 	// This test is enhanced by using the reverb effects area begin/end test as a
 	// shortcut, since all buffer addresses are within that area.  If the IRQA isn't
 	// within that zone then the "bulk" of the test is skipped, so this should only
-	// be a slowdown on a few evil games.
+	// be a slowdown on a few evil games.  The padding slots wrap far above the SPU2
+	// address space, so they can never match an IRQA.
 
 	for (int i = 0; i < 2; i++)
 	{
 		if (Cores[i].IRQEnable && ((Cores[i].IRQA >= EffectsStartA) && (Cores[i].IRQA <= EffectsEndA)))
 		{
-			if ((Cores[i].IRQA == same_src) || (Cores[i].IRQA == diff_src) ||
-				(Cores[i].IRQA == same_dst) || (Cores[i].IRQA == diff_dst) ||
-				(Cores[i].IRQA == same_prv) || (Cores[i].IRQA == diff_prv) ||
+			const __m128i irqa = _mm_set1_epi32(Cores[i].IRQA);
 
-				(Cores[i].IRQA == comb1_src) || (Cores[i].IRQA == comb2_src) ||
-				(Cores[i].IRQA == comb3_src) || (Cores[i].IRQA == comb4_src) ||
+			__m128i hit = _mm_cmpeq_epi32(_mm_load_si128((__m128i*)&addr[0]), irqa);
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi32(_mm_load_si128((__m128i*)&addr[4]), irqa));
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi32(_mm_load_si128((__m128i*)&addr[8]), irqa));
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi32(_mm_load_si128((__m128i*)&addr[12]), irqa));
 
-				(Cores[i].IRQA == apf1_dst) || (Cores[i].IRQA == apf1_src) ||
-				(Cores[i].IRQA == apf2_dst) || (Cores[i].IRQA == apf2_src))
+			if (_mm_movemask_epi8(hit))
 			{
 				//printf("Core %d IRQ Called (Reverb). IRQA = %x\n",i,addr);
 				SetIrqCall(i);
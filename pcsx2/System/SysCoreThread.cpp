@@ -23,6 +23,7 @@
 #include "Counters.h"
 #include "GS.h"
 #include "Elfheader.h"
+#include "SaveState.h"
 #include "Patch.h"
 #include "SysThreads.h"
 #include "MTVU.h"
@@ -34,6 +35,8 @@
 #include "../DebugTools/MIPSAnalyst.h"
 #include "../DebugTools/SymbolMap.h"
 
+#include <thread>
+
 #include "IopBios.h"
 
 DEV9handler dev9Handler;
@@ -67,8 +70,11 @@ static void modules_close(void)
 
 static void modules_open(bool isSuspended)
 {
+	// Resume() starts the GS open (device creation, shader compiles) on the
+	// MTGS thread; none of the other modules touch the GS, so open them here
+	// while that runs and only block on the result at the end.  On a cold
+	// boot this overlaps the ISO open/index build with the shader warmup.
 	GetMTGS().Resume();
-	GetMTGS().WaitForOpen();
 	if (isSuspended || !g_GameStarted)
 		DoCDVDopen();
 	FWopen();
@@ -89,6 +95,8 @@ static void modules_open(bool isSuspended)
 	usbHandler = USBirqHandler();
 
 	FileMcd_EmuOpen();
+
+	GetMTGS().WaitForOpen();
 }
 
 static void modules_init(void)
@@ -272,6 +280,11 @@ void SysCoreThread::_reset_stuff_as_needed()
 		m_resetVsyncTimers = false;
 
 		ForgetLoadedPatches();
+
+		// On a fresh fast boot, resume from the per-BIOS kernel snapshot if one
+		// exists -- execution then starts at the EELOAD entry instead of the
+		// reset vector, skipping several seconds of kernel init.
+		KernelBootSnapshot_TryRestore();
 	}
 
 	if (m_resetVsyncTimers)
@@ -302,12 +315,38 @@ void SysCoreThread::VsyncInThread()
 	ApplyLoadedPatches(PPT_CONTINUOUSLY);
 }
 
+// Walking the whole ELF text segment for function boundaries takes seconds on
+// large games, and nothing on the EE thread needs the result synchronously -
+// SymbolMap locks internally and the debug tooling tolerates symbols arriving
+// late.  So the scan runs on a worker; joined before the next scan (ELF
+// reload) and at VM cleanup so it never outlives the memory it reads.
+static std::thread s_function_scan_thread;
+
+static void StartFunctionScan()
+{
+	if (s_function_scan_thread.joinable())
+		s_function_scan_thread.join();
+
+	const u32 start = ElfTextRange.first;
+	const u32 end = ElfTextRange.first + ElfTextRange.second;
+
+	s_function_scan_thread = std::thread([start, end]() {
+		Threading::SetNumaAffinityForSelf();
+
+		if (!MIPSAnalyst::LoadFunctionScanCache(start, end, true))
+		{
+			MIPSAnalyst::ScanForFunctions(start, end, true);
+			MIPSAnalyst::SaveFunctionScanCache(start, end);
+		}
+		symbolMap.UpdateActiveSymbols();
+	});
+}
+
 void SysCoreThread::GameStartingInThread()
 {
 	GetMTGS().SendGameCRC(ElfCRC);
 
-	MIPSAnalyst::ScanForFunctions(ElfTextRange.first, ElfTextRange.first + ElfTextRange.second, true);
-	symbolMap.UpdateActiveSymbols();
+	StartFunctionScan();
 
 	ApplyLoadedPatches(PPT_ONCE_ON_LOAD);
 #ifndef __LIBRETRO__
@@ -373,6 +412,10 @@ void SysCoreThread::OnCleanupInThread()
 	m_resetVirtualMachine = true;
 
 	R3000A::ioman::reset();
+
+	if (s_function_scan_thread.joinable())
+		s_function_scan_thread.join();
+
 	// FIXME: temporary workaround for deadlock on exit, which actually should be a crash
 	vu1Thread.WaitVU();
 	modules_close();
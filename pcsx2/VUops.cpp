@@ -367,6 +367,107 @@ static __fi float vuADD_TriAceHack(u32 a, u32 b) {
 	return vuDouble(a) + vuDouble(b);
 }
 
+/* Whole-register SSE helpers for the FMAC op families below.  The upper
+   ops used to run lane-by-lane through vuDouble()/VU_MAC_UPDATE(); these
+   compute all four lanes at once while reproducing the same input
+   clamping, result rewriting and MAC flag bits exactly. */
+
+// movmskps returns x in bit 0, but the MAC flag nibbles keep x in bit 3;
+// this table bit-reverses a 4-bit lane mask into flag order.
+static const u8 s_vuLaneRev[16] = {
+	0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+	0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf
+};
+
+// per-lane write masks indexed by _XYZW (x in bit 3, w in bit 0)
+static const __aligned16 u32 s_vuWriteMask[16][4] = {
+	{ 0, 0, 0, 0 }, { 0, 0, 0, ~0u }, { 0, 0, ~0u, 0 }, { 0, 0, ~0u, ~0u },
+	{ 0, ~0u, 0, 0 }, { 0, ~0u, 0, ~0u }, { 0, ~0u, ~0u, 0 }, { 0, ~0u, ~0u, ~0u },
+	{ ~0u, 0, 0, 0 }, { ~0u, 0, 0, ~0u }, { ~0u, 0, ~0u, 0 }, { ~0u, 0, ~0u, ~0u },
+	{ ~0u, ~0u, 0, 0 }, { ~0u, ~0u, 0, ~0u }, { ~0u, ~0u, ~0u, 0 }, { ~0u, ~0u, ~0u, ~0u }
+};
+
+// vuDouble() applied to all four lanes: denormals flush to signed zero,
+// Inf/NaN clamp to the largest normal float of the same sign.
+static __fi __m128 vuSafeVec(__m128 v)
+{
+#ifndef INT_VUDOUBLEHACK
+	const __m128i iv    = _mm_castps_si128(v);
+	const __m128i expm  = _mm_set1_epi32(0x7f800000);
+	const __m128i exp   = _mm_and_si128(iv, expm);
+	const __m128i den   = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+	const __m128i inf   = _mm_cmpeq_epi32(exp, expm);
+	const __m128i sign  = _mm_and_si128(iv, _mm_set1_epi32(0x80000000));
+
+	__m128i r = iv;
+	r = _mm_or_si128(_mm_andnot_si128(den, r), _mm_and_si128(den, sign));
+	r = _mm_or_si128(_mm_andnot_si128(inf, r), _mm_and_si128(inf, _mm_or_si128(sign, _mm_set1_epi32(0x7f7fffff))));
+	return _mm_castsi128_ps(r);
+#else
+	return v;
+#endif
+}
+
+static __fi __m128 vuLoadVF(const VURegs * VU, int reg)
+{
+	return vuSafeVec(_mm_load_ps(&VU->VF[reg].f.x));
+}
+
+static __fi __m128 vuLoadACC(const VURegs * VU)
+{
+	return vuSafeVec(_mm_load_ps(&VU->ACC.f.x));
+}
+
+static __fi __m128 vuLoadBC(u32 f)
+{
+	return vuSafeVec(_mm_castsi128_ps(_mm_set1_epi32((s32)f)));
+}
+
+/* Stores the enabled lanes of res into dst and updates macflag exactly
+   the way per-lane VU_MACx_UPDATE/VU_MACx_CLEAR would; callers still run
+   VU_STAT_UPDATE afterwards. */
+static __ri void vuMACVecUpdate(VURegs * VU, VECTOR * dst, __m128 res)
+{
+	const int xyzw = _XYZW;
+
+	const __m128i ir    = _mm_castps_si128(res);
+	const __m128i expm  = _mm_set1_epi32(0x7f800000);
+	const __m128i exp   = _mm_and_si128(ir, expm);
+	const __m128i sign  = _mm_and_si128(ir, _mm_set1_epi32(0x80000000));
+
+	// f == 0 uses the float compare, like the scalar code; lanes that
+	// compare zero keep their raw bits even if they hold denormals
+	const __m128i zero = _mm_castps_si128(_mm_cmpeq_ps(res, _mm_setzero_ps()));
+	const __m128i den  = _mm_andnot_si128(zero, _mm_cmpeq_epi32(exp, _mm_setzero_si128()));
+	const __m128i inf  = _mm_cmpeq_epi32(exp, expm);
+
+	// VU_MAC_UPDATE's result rewriting: denormals become signed zero,
+	// Inf/NaN clamp to the largest normal float of the same sign
+	__m128i out = ir;
+	out = _mm_or_si128(_mm_andnot_si128(den, out), _mm_and_si128(den, sign));
+	out = _mm_or_si128(_mm_andnot_si128(inf, out), _mm_and_si128(inf, _mm_or_si128(sign, _mm_set1_epi32(0x7f7fffff))));
+
+	const u32 mZ = s_vuLaneRev[_mm_movemask_ps(_mm_castsi128_ps(zero))];
+	const u32 mD = s_vuLaneRev[_mm_movemask_ps(_mm_castsi128_ps(den))];
+	const u32 mI = s_vuLaneRev[_mm_movemask_ps(_mm_castsi128_ps(inf))];
+	const u32 mS = s_vuLaneRev[_mm_movemask_ps(res)];
+
+	// zero/sign/underflow/overflow nibbles; overflowed lanes keep their
+	// previous zero bit (VU_MAC_UPDATE's case 255 doesn't clear it)
+	const u32 mac = (mZ | mD | (mI & (VU->macflag & 0xF)))
+	              | (mS << 4) | (mD << 8) | (mI << 12);
+
+	VU->macflag = (VU->macflag & ~0xFFFFu) | (mac & (0x1111u * xyzw));
+
+	if (xyzw == 0xF)
+		_mm_store_si128((__m128i*)dst, out);
+	else {
+		const __m128i wm  = _mm_load_si128((const __m128i*)s_vuWriteMask[xyzw]);
+		const __m128i old = _mm_load_si128((const __m128i*)dst);
+		_mm_store_si128((__m128i*)dst, _mm_or_si128(_mm_and_si128(wm, out), _mm_andnot_si128(wm, old)));
+	}
+}
+
 void _vuABS(VURegs * VU) {
 	if (_Ft_ == 0) return;
 
@@ -382,10 +483,7 @@ static __fi void _vuADD(VURegs * VU) {
 	if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_)));
     VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
@@ -396,10 +494,7 @@ static __fi void _vuADDi(VURegs * VU) {
 	else dst = &VU->VF[_Fd_];
 
 	if (!CHECK_VUADDSUBHACK) {
-		if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + vuDouble(VU->VI[REG_I].UL));} else VU_MACx_CLEAR(VU);
-		if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + vuDouble(VU->VI[REG_I].UL));} else VU_MACy_CLEAR(VU);
-		if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + vuDouble(VU->VI[REG_I].UL));} else VU_MACz_CLEAR(VU);
-		if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + vuDouble(VU->VI[REG_I].UL));} else VU_MACw_CLEAR(VU);
+		vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL)));
 		VU_STAT_UPDATE(VU);
 	}
 	else {
@@ -417,135 +512,79 @@ static __fi void _vuADDq(VURegs * VU) {
 	if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + vuDouble(VU->VI[REG_Q].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + vuDouble(VU->VI[REG_Q].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + vuDouble(VU->VI[REG_Q].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + vuDouble(VU->VI[REG_Q].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 
 static __fi void _vuADDx(VURegs * VU) {
-	float ftx;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftx=vuDouble(VU->VF[_Ft_].i.x);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + ftx); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + ftx); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + ftx); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + ftx); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDy(VURegs * VU) {
-	float fty;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	fty=vuDouble(VU->VF[_Ft_].i.y);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + fty);} else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + fty);} else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + fty);} else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + fty);} else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDz(VURegs * VU) {
-	float ftz;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftz=vuDouble(VU->VF[_Ft_].i.z);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + ftz); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + ftz); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + ftz); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + ftz); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDw(VURegs * VU) {
-	float ftw;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftw=vuDouble(VU->VF[_Ft_].i.w);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + ftw); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + ftw); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + ftw); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + ftw); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDA(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDAi(VURegs * VU) {
-	float ti = vuDouble(VU->VI[REG_I].UL);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + ti); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + ti); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + ti); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + ti); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDAq(VURegs * VU) {
-	float tf = vuDouble(VU->VI[REG_Q].UL);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + tf); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + tf); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + tf); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + tf); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDAx(VURegs * VU) {
-	float tx = vuDouble(VU->VF[_Ft_].i.x);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + tx); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + tx); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + tx); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + tx); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDAy(VURegs * VU) {
-	float ty = vuDouble(VU->VF[_Ft_].i.y);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + ty); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + ty); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + ty); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + ty); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDAz(VURegs * VU) {
-	float tz = vuDouble(VU->VF[_Ft_].i.z);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + tz); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + tz); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + tz); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + tz); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
 static __fi void _vuADDAw(VURegs * VU) {
-	float tw = vuDouble(VU->VF[_Ft_].i.w);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) + tw); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) + tw); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) + tw); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) + tw); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w)));
 	VU_STAT_UPDATE(VU);
 }/*Reworked from define to function. asadr*/
 
@@ -555,10 +594,7 @@ static __fi void _vuSUB(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - vuDouble(VU->VF[_Ft_].i.x));  } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - vuDouble(VU->VF[_Ft_].i.y));  } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - vuDouble(VU->VF[_Ft_].i.z));  } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - vuDouble(VU->VF[_Ft_].i.w));  } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_)));
 	VU_STAT_UPDATE(VU);
 }
 
@@ -567,10 +603,7 @@ static __fi void _vuSUBi(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL)));
 	VU_STAT_UPDATE(VU);
 }
 
@@ -579,131 +612,79 @@ static __fi void _vuSUBq(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBx(VURegs * VU) {
-	float ftx;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftx=vuDouble(VU->VF[_Ft_].i.x);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - ftx); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - ftx); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - ftx); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - ftx); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBy(VURegs * VU) {
-	float fty;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	fty=vuDouble(VU->VF[_Ft_].i.y);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - fty); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - fty); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - fty); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - fty); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBz(VURegs * VU) {
-	float ftz;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftz=vuDouble(VU->VF[_Ft_].i.z);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - ftz); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - ftz); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - ftz); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - ftz); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBw(VURegs * VU) {
-	float ftw;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-    ftw=vuDouble(VU->VF[_Ft_].i.w);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - ftw); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - ftw); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - ftw); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - ftw); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w)));
 	VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuSUBA(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBAi(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - vuDouble(VU->VI[REG_I].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBAq(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - vuDouble(VU->VI[REG_Q].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBAx(VURegs * VU) {
-	float tx = vuDouble(VU->VF[_Ft_].i.x);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - tx); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - tx); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - tx); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - tx); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBAy(VURegs * VU) {
-	float ty = vuDouble(VU->VF[_Ft_].i.y);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - ty); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - ty); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - ty); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - ty); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBAz(VURegs * VU) {
-	float tz = vuDouble(VU->VF[_Ft_].i.z);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - tz); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - tz); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - tz); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - tz); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuSUBAw(VURegs * VU) {
-	float tw = vuDouble(VU->VF[_Ft_].i.w);
-
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) - tw); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) - tw); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) - tw); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) - tw); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w)));
 	VU_STAT_UPDATE(VU);
 }
 
@@ -712,10 +693,7 @@ static __fi void _vuMUL(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_)));
     VU_STAT_UPDATE(VU);
 }
 
@@ -725,10 +703,7 @@ static __fi void _vuMULi(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL)));
     VU_STAT_UPDATE(VU);
 }
 
@@ -737,127 +712,83 @@ static __fi void _vuMULq(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL)));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMULx(VURegs * VU) {
-	float ftx;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
- 	ftx=vuDouble(VU->VF[_Ft_].i.x);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * ftx); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * ftx); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * ftx); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * ftx); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x)));
     VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuMULy(VURegs * VU) {
-	float fty;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
- 	fty=vuDouble(VU->VF[_Ft_].i.y);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * fty); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * fty); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * fty); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * fty); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y)));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMULz(VURegs * VU) {
-	float ftz;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
- 	ftz=vuDouble(VU->VF[_Ft_].i.z);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * ftz); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * ftz); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * ftz); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * ftz); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z)));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMULw(VURegs * VU) {
-	float ftw;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftw=vuDouble(VU->VF[_Ft_].i.w);
-	if (_X){ dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * ftw); } else VU_MACx_CLEAR(VU);
-	if (_Y){ dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * ftw); } else VU_MACy_CLEAR(VU);
-	if (_Z){ dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * ftw); } else VU_MACz_CLEAR(VU);
-	if (_W){ dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * ftw); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w)));
 	VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuMULA(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_)));
 	VU_STAT_UPDATE(VU);
 }
 
 /* No need to presave I reg in ti. asadr */
 static __fi void _vuMULAi(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_I].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL)));
 	VU_STAT_UPDATE(VU);
 }
 
 /* No need to presave Q reg in ti. asadr */
 static __fi void _vuMULAq(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_Q].UL)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL)));
     VU_STAT_UPDATE(VU);
 }
 
 /* No need to presave X reg in ti. asadr */
 static __fi void _vuMULAx(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.x)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x)));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMULAy(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.y)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y)));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMULAz(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.z)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z)));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMULAw(VURegs * VU) {
-	if (_X){ VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACx_CLEAR(VU);
-	if (_Y){ VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACy_CLEAR(VU);
-	if (_Z){ VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACz_CLEAR(VU);
-	if (_W){ VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w)); } else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w)));
     VU_STAT_UPDATE(VU);
 }
 
@@ -866,10 +797,7 @@ static __fi void _vuMADD(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_))));
     VU_STAT_UPDATE(VU);
 }
 
@@ -879,10 +807,7 @@ static __fi void _vuMADDi(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_I].UL))); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_I].UL))); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_I].UL))); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_I].UL))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL))));
     VU_STAT_UPDATE(VU);
 }
 
@@ -892,126 +817,78 @@ static __fi void _vuMADDq(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDx(VURegs * VU) {
-	float ftx;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftx=vuDouble(VU->VF[_Ft_].i.x);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * ftx)); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * ftx)); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * ftx)); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * ftx)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDy(VURegs * VU) {
-	float fty;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	fty=vuDouble(VU->VF[_Ft_].i.y);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * fty)); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * fty)); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * fty)); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * fty)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDz(VURegs * VU) {
-	float ftz;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftz=vuDouble(VU->VF[_Ft_].i.z);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * ftz)); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * ftz)); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * ftz)); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * ftz)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z))));
 	VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDw(VURegs * VU) {
-	float ftw;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftw=vuDouble(VU->VF[_Ft_].i.w);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * ftw)); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * ftw)); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * ftw)); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * ftw)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDA(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + (vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + (vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + (vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + (vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDAi(VURegs * VU) {
-	float ti = vuDouble(VU->VI[REG_I].UL);
-
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * ti)); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * ti)); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * ti)); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * ti)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDAq(VURegs * VU) {
-	float tq = vuDouble(VU->VI[REG_Q].UL);
-
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * tq)); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * tq)); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * tq)); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * tq)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDAx(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDAy(VURegs * VU) {
-	if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDAz(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMADDAw(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) + ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) + ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) + ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) + ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_add_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w))));
     VU_STAT_UPDATE(VU);
 }
 
@@ -1020,160 +897,100 @@ static __fi void _vuMSUB(VURegs * VU) {
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBi(VURegs * VU) {
-	float ti = vuDouble(VU->VI[REG_I].UL);
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * ti  ) ); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * ti  ) ); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * ti  ) ); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * ti  ) ); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBq(VURegs * VU) {
-	float tq = vuDouble(VU->VI[REG_Q].UL);
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x)  - ( vuDouble(VU->VF[_Fs_].i.x) * tq  ) ); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y)  - ( vuDouble(VU->VF[_Fs_].i.y) * tq  ) ); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z)  - ( vuDouble(VU->VF[_Fs_].i.z) * tq  ) ); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w)  - ( vuDouble(VU->VF[_Fs_].i.w) * tq  ) ); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuMSUBx(VURegs * VU) {
-	float ftx;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftx=vuDouble(VU->VF[_Ft_].i.x);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x)  - ( vuDouble(VU->VF[_Fs_].i.x) * ftx  ) ); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y)  - ( vuDouble(VU->VF[_Fs_].i.y) * ftx  ) ); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z)  - ( vuDouble(VU->VF[_Fs_].i.z) * ftx  ) ); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w)  - ( vuDouble(VU->VF[_Fs_].i.w) * ftx  ) ); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x))));
     VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuMSUBy(VURegs * VU) {
-	float fty;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	fty=vuDouble(VU->VF[_Ft_].i.y);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x)  - ( vuDouble(VU->VF[_Fs_].i.x) * fty  ) ); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y)  - ( vuDouble(VU->VF[_Fs_].i.y) * fty  ) ); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z)  - ( vuDouble(VU->VF[_Fs_].i.z) * fty  ) ); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w)  - ( vuDouble(VU->VF[_Fs_].i.w) * fty  ) ); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y))));
     VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuMSUBz(VURegs * VU) {
-	float ftz;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftz=vuDouble(VU->VF[_Ft_].i.z);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x)  - ( vuDouble(VU->VF[_Fs_].i.x) * ftz  ) ); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y)  - ( vuDouble(VU->VF[_Fs_].i.y) * ftz  ) ); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z)  - ( vuDouble(VU->VF[_Fs_].i.z) * ftz  ) ); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w)  - ( vuDouble(VU->VF[_Fs_].i.w) * ftz  ) ); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBw(VURegs * VU) {
-	float ftw;
 	VECTOR * dst;
     if (_Fd_ == 0) dst = &RDzero;
 	else dst = &VU->VF[_Fd_];
 
-	ftw=vuDouble(VU->VF[_Ft_].i.w);
-    if (_X) dst->i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x)  - ( vuDouble(VU->VF[_Fs_].i.x) * ftw  ) ); else VU_MACx_CLEAR(VU);
-    if (_Y) dst->i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y)  - ( vuDouble(VU->VF[_Fs_].i.y) * ftw  ) ); else VU_MACy_CLEAR(VU);
-    if (_Z) dst->i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z)  - ( vuDouble(VU->VF[_Fs_].i.z) * ftw  ) ); else VU_MACz_CLEAR(VU);
-    if (_W) dst->i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w)  - ( vuDouble(VU->VF[_Fs_].i.w) * ftw  ) ); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, dst, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w))));
     VU_STAT_UPDATE(VU);
 }
 
 
 static __fi void _vuMSUBA(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VF[_Ft_].i.x))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VF[_Ft_].i.y))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VF[_Ft_].i.z))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VF[_Ft_].i.w))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadVF(VU, _Ft_))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBAi(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_I].UL))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_I].UL))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_I].UL))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_I].UL))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_I].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBAq(VURegs * VU) {
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * vuDouble(VU->VI[REG_Q].UL))); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VI[REG_Q].UL))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBAx(VURegs * VU) {
-	float tx = vuDouble(VU->VF[_Ft_].i.x);
-
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * tx)); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * tx)); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * tx)); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * tx)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.x))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBAy(VURegs * VU) {
-	float ty = vuDouble(VU->VF[_Ft_].i.y);
-
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * ty)); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * ty)); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * ty)); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * ty)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.y))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBAz(VURegs * VU) {
-	float tz = vuDouble(VU->VF[_Ft_].i.z);
-
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * tz)); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * tz)); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * tz)); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * tz)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.z))));
     VU_STAT_UPDATE(VU);
 }
 
 static __fi void _vuMSUBAw(VURegs * VU) {
-	float tw = vuDouble(VU->VF[_Ft_].i.w);
-
-    if (_X) VU->ACC.i.x = VU_MACx_UPDATE(VU, vuDouble(VU->ACC.i.x) - ( vuDouble(VU->VF[_Fs_].i.x) * tw)); else VU_MACx_CLEAR(VU);
-    if (_Y) VU->ACC.i.y = VU_MACy_UPDATE(VU, vuDouble(VU->ACC.i.y) - ( vuDouble(VU->VF[_Fs_].i.y) * tw)); else VU_MACy_CLEAR(VU);
-    if (_Z) VU->ACC.i.z = VU_MACz_UPDATE(VU, vuDouble(VU->ACC.i.z) - ( vuDouble(VU->VF[_Fs_].i.z) * tw)); else VU_MACz_CLEAR(VU);
-    if (_W) VU->ACC.i.w = VU_MACw_UPDATE(VU, vuDouble(VU->ACC.i.w) - ( vuDouble(VU->VF[_Fs_].i.w) * tw)); else VU_MACw_CLEAR(VU);
+	vuMACVecUpdate(VU, &VU->ACC, _mm_sub_ps(vuLoadACC(VU), _mm_mul_ps(vuLoadVF(VU, _Fs_), vuLoadBC(VU->VF[_Ft_].i.w))));
     VU_STAT_UPDATE(VU);
 }
 
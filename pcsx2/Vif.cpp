@@ -40,6 +40,9 @@ void vif1Reset()
 	memzero(vif1);
 	memzero(vif1Regs);
 
+	g_vif1ReadStagingCount = 0;
+	g_vif1ReadStagingPos = 0;
+
 	resetNewVif(1);
 }
 
@@ -65,6 +68,12 @@ void SaveStateBase::vif1Freeze()
 
 	Freeze(nVif[1].bSize);
 	FreezeMem(nVif[1].buffer, nVif[1].bSize);
+
+	// GS download read-ahead staging (FiFo.cpp); its content has already
+	// advanced the GS-side transfer position, so it's part of VIF1's state.
+	Freeze(g_vif1ReadStagingCount);
+	Freeze(g_vif1ReadStagingPos);
+	Freeze(g_vif1ReadStaging);
 }
 
 //------------------------------------------------------------------
@@ -68,10 +68,17 @@ void vif1TransferToMemory()
 		pxAssert(p3.isDone() || !p3.gifTag.isValid);
 	}
 
-	GetMTGS().WaitGS();
-	GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO2, size, pMem);
-	GetMTGS().WaitGS(false); // wait without reg sync
-	GSreadFIFO2((u8*)pMem, size);
+	// Serve whatever the FIFO read-ahead staging already pulled out of the GS
+	// before bulk-reading the rest; mixed FIFO+DMA downloads must consume one
+	// contiguous stream (see FiFo.cpp).
+	const u32 drained = vif1ReadStagingDrain(pMem, size);
+
+	if (size > drained) {
+		GetMTGS().WaitGS();
+		GetMTGS().SendPointerPacket(GS_RINGTYPE_INIT_READ_FIFO2, size - drained, pMem + drained);
+		GetMTGS().WaitGS(false); // wait without reg sync
+		GSreadFIFO2((u8*)(pMem + drained), size - drained);
+	}
 //	pMem += size;
 
 	//Some games such as Alex Ferguson's Player Manager 2001 reads less than GSLastDownloadSize by VIF then reads the remainder by FIFO
@@ -289,29 +289,46 @@ static __fi void _vifCode_MPG(int idx, u32 addr, const u32 *data, int size) {
 		return;
 	}	
 
+	// Only touch the recompiler when the upload actually changes micro memory:
+	// the Clear() invalidates the quick-reference table, so the next activation
+	// has to re-search the program list with a memcmp per cached program.
+	// Games that re-upload an unchanged program every frame (common with many
+	// small microprograms) pay that search for nothing, which costs far more
+	// than this one compare.  When the data did change, the compare bails on
+	// the first differing line and the clear was needed anyway.
+
 	// Don't forget the Unsigned designator for these checks
 	if((addr + size *4) > vuMemSize)
 	{
 		//log_cb(RETRO_LOG_DEBUG, "Handling split MPG\n");
-		if (!idx)  CpuVU0->Clear(addr, vuMemSize - addr);
-		else	   CpuVU1->Clear(addr, vuMemSize - addr);
-		
-		memcpy(VUx.Micro + addr, data, vuMemSize - addr);
+		if (memcmp_mmx(VUx.Micro + addr, data, vuMemSize - addr))
+		{
+			if (!idx)  CpuVU0->Clear(addr, vuMemSize - addr);
+			else	   CpuVU1->Clear(addr, vuMemSize - addr);
+
+			memcpy(VUx.Micro + addr, data, vuMemSize - addr);
+		}
 		size -= (vuMemSize - addr) / 4;
 		data += (vuMemSize - addr) / 4;
-		memcpy(VUx.Micro, data, size * 4);
+		if (memcmp_mmx(VUx.Micro, data, size * 4))
+		{
+			if (!idx)  CpuVU0->Clear(0, size * 4);
+			else	   CpuVU1->Clear(0, size * 4);
+
+			memcpy(VUx.Micro, data, size * 4);
+		}
 
 		vifX.tag.addr = size * 4;
 	}
 	else
 	{
-	//The compare is pretty much a waste of time, likelyhood is that the program isnt there, thats why its copying it.
-	//Faster without.
-	//if (memcmp_mmx(VUx.Micro + addr, data, size*4)) {
-		// Clear VU memory before writing!
-		if (!idx)  CpuVU0->Clear(addr, size*4);
-		else	   CpuVU1->Clear(addr, size*4);
-		memcpy(VUx.Micro + addr, data, size*4); //from tests, memcpy is 1fps faster on Grandia 3 than memcpy
+		if (memcmp_mmx(VUx.Micro + addr, data, size*4))
+		{
+			// Clear VU memory before writing!
+			if (!idx)  CpuVU0->Clear(addr, size*4);
+			else	   CpuVU1->Clear(addr, size*4);
+			memcpy(VUx.Micro + addr, data, size*4);
+		}
 
 		vifX.tag.addr   +=   size * 4;
 	}
@@ -100,6 +100,14 @@ struct vifStruct {
 
 extern __aligned16 vifStruct  vif0, vif1;
 
+// FiFo.cpp: read-ahead staging for FIFO-polled GS downloads.  The first FIFO
+// read of a burst bulk-reads up to a FIFO's worth (16 qwords) from the GS; the
+// DMA download path drains it first so both paths consume one stream.
+extern __aligned16 u128 g_vif1ReadStaging[16];
+extern u32 g_vif1ReadStagingCount;
+extern u32 g_vif1ReadStagingPos;
+extern u32 vif1ReadStagingDrain(u128* dst, u32 max);
+
 _vifT extern u32 vifRead32(u32 mem);
 _vifT extern bool vifWrite32(u32 mem, u32 value);
 void ExecuteVU(int idx);
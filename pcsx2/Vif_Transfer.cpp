@@ -59,6 +59,20 @@ _vifT void vifTransferLoop(u32* &data) {
 		ret = vifCmdHandler[idx][vifX.cmd & 0x7f](vifX.pass, data);
 		data   += ret;
 		pSize  -= ret;
+
+		// UNPACK takes two trips through this loop per command: the setup
+		// pass consumes the code word, then the data pass runs on re-entry.
+		// The setup pass cannot stall, so chain straight into the data pass
+		// and spare burst unpacks the code-decode checks above.  (Whole-
+		// packet pre-decode is not workable here: an UNPACK's word count
+		// depends on CYCLE.CL/WL, so command lengths are only known once the
+		// preceding codes have executed.)
+		if((vifX.cmd & 0x60) == 0x60 && vifX.pass == 1 && pSize > 0 && !vifX.vifstalled.enabled)
+		{
+			ret = vifCmdHandler[idx][vifX.cmd & 0x7f](1, data);
+			data   += ret;
+			pSize  -= ret;
+		}
 	}
 }
 
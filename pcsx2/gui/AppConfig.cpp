@@ -380,6 +380,12 @@ bool AppConfig::IsOkApplyPreset(int n, bool ignoreMTVU)
 	}
 
 
+	// Deterministic mode overrides the preset: MTVU delivers GS SIGNAL/LABEL
+	// changes based on how far the worker thread got when the EE polls, which
+	// depends on host scheduling, so lockstep peers must run with it off.
+	if (g_DeterministicMode)
+		EmuOptions.Speedhacks.vuThread = false;
+
 	EnablePresets=true;
 	PresetIndex=n;
 
@@ -172,6 +172,10 @@ void AppCoreThread::OnPause()
 // Returns number of gamefixes set
 static int loadGameSettings(Pcsx2Config& dest, const GameDatabaseSchema::GameEntry& game)
 {
+	// Always reset the policy ranges so a title without an entry doesn't
+	// inherit the previous title's ranges.
+	eeClearExecPolicyRanges();
+
 	if (!game.isValid)
 		return 0;
 
@@ -255,6 +259,27 @@ static int loadGameSettings(Pcsx2Config& dest, const GameDatabaseSchema::GameEnt
 		}
 	}
 
+	// Per-range execution policies: fragile functions get pinned to the
+	// interpreter (or to sync recompilation) instead of a gamefix that turns
+	// the recompiler off wholesale.  Entries were validated by the database
+	// parser; recRecompile picks the ranges up on the next rec reset.
+	eeClearExecPolicyRanges();
+
+	for (const std::string& policy : game.execPolicies)
+	{
+		unsigned int start = 0, end = 0;
+
+		if (sscanf(policy.c_str(), "interpret=%x-%x", &start, &end) == 2)
+			eeAddExecPolicyRange(start, end, EEExec_Interpret);
+		else if (sscanf(policy.c_str(), "syncrec=%x-%x", &start, &end) == 2)
+			eeAddExecPolicyRange(start, end, EEExec_SyncRec);
+		else
+			continue;
+
+		log_cb(RETRO_LOG_INFO, "(GameDB) Execution policy: %s\n", policy.c_str());
+		gf++;
+	}
+
 	return gf;
 }
 
@@ -22,9 +22,10 @@
 AppGameDatabase& AppGameDatabase::Load()
 {
 	std::string game_index(reinterpret_cast<const char*>(&GameIndex_yaml), GameIndex_yaml_len);
-	std::istringstream stream(game_index);
 
-	if (!this->initDatabase(stream))
+	// Index the embedded database without parsing it; entries are parsed
+	// individually when a serial is actually looked up.
+	if (!this->initDatabaseLazy(std::move(game_index)))
 	{
 		log_cb(RETRO_LOG_ERROR, "[GameDB] Database could not be loaded successfully\n");
 		return *this;
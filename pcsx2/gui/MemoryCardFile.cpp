@@ -24,7 +24,12 @@
 #include "svnrev.h"
 
 #include <wx/ffile.h>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include  "options_tools.h"
 
 static const int MCD_SIZE = 1024 * 8 * 16; // Legacy PSX card default size
@@ -144,19 +149,43 @@ static bool ConvertRAWtoNoECC(wxString file_in, wxString file_out)
 // --------------------------------------------------------------------------------------
 // Provides thread-safe direct file IO mapping.
 //
+// The full card image is cached in RAM at Open() time, so SIO reads and
+// read-modify-write cycles never touch the filesystem on the EE thread.  Writes
+// are applied to the cache immediately and flushed to disk by a background
+// thread, journal-first: each write is appended to a <card>.journal file before
+// the card image is updated, and the journal is restarted once the image has
+// caught up.  A journal left behind by a crash is replayed on the next Open().
+//
 class FileMemoryCard
 {
 protected:
 	wxFFile m_file[8];
+	wxFFile m_journal[8];
 	u8 m_effeffs[528 * 16];
 	SafeArray<u8> m_currentdata;
+	SafeArray<u8> m_image[8];
 	u64 m_chksum[8];
 	bool m_ispsx[8];
+	bool m_cached[8];
+	u32 m_filesize[8];
+	u32 m_offset[8];
 	u32 m_chkaddr;
 
+	struct McdWrite
+	{
+		u8 slot;
+		u32 adr;
+		std::vector<u8> data;
+	};
+	std::deque<McdWrite> m_writeQueue;
+	std::mutex m_writeLock;
+	std::condition_variable m_writeCond;
+	std::thread m_writeThread;
+	bool m_writeThreadRunning;
+
 public:
 	FileMemoryCard();
-	virtual ~FileMemoryCard() = default;
+	virtual ~FileMemoryCard();
 
 	void Lock();
 	void Unlock();
@@ -176,6 +205,11 @@ protected:
 	bool Seek(wxFFile& f, u32 adr);
 	bool Create(const wxString& mcdFile, uint sizeInMB);
 
+	void ReplayJournal(uint slot, const wxString& cardPath);
+	void QueueWrite(uint slot, u32 adr, const u8* src, int size);
+	void StopWriteThread();
+	void WriteThreadProc();
+
 	wxString GetDisabledMessage(uint slot) const
 	{
 		return wxsFormat(L"The PS2-slot %d has been automatically disabled.  You can correct the problem\nand re-enable it at any time using Config:Memory cards from the main menu.", slot //TODO: translate internal slot index to human-readable slot description
@@ -247,6 +281,19 @@ FileMemoryCard::FileMemoryCard()
 {
 	memset8<0xff>(m_effeffs);
 	m_chkaddr = 0;
+	m_writeThreadRunning = false;
+
+	for (int slot = 0; slot < 8; ++slot)
+	{
+		m_cached[slot] = false;
+		m_filesize[slot] = 0;
+		m_offset[slot] = 0;
+	}
+}
+
+FileMemoryCard::~FileMemoryCard()
+{
+	StopWriteThread();
 }
 
 void FileMemoryCard::Open()
@@ -329,21 +376,71 @@ void FileMemoryCard::Open()
 					wxsFormat("Access denied to memory card: \n\n%s\n\n %s\n", str.c_str(), GetDisabledMessage(slot).c_str()).c_str()
 			      );
 		}
-		else // Load checksum
+		else
 		{
+			// Crash recovery: fold any leftover write-behind journal into the
+			// card before reading anything from it.
+			ReplayJournal(slot, str);
+
+			// Load checksum
 			m_ispsx[slot] = m_file[slot].Length() == 0x20000;
 			m_chkaddr = 0x210;
 
 			if (!m_ispsx[slot] && !!m_file[slot].Seek(m_chkaddr))
 				m_file[slot].Read(&m_chksum[slot], 8);
+
+			// Cache the full card image; SIO traffic is served from RAM from
+			// here on, with writes flushed by the background thread.
+			m_filesize[slot] = m_file[slot].Length();
+
+			if (m_filesize[slot] == MCD_SIZE + 64)
+				m_offset[slot] = 64;
+			else if (m_filesize[slot] == MCD_SIZE + 3904)
+				m_offset[slot] = 3904;
+			else
+				m_offset[slot] = 0;
+
+			m_image[slot].MakeRoomFor(m_filesize[slot]);
+			m_cached[slot] = m_file[slot].Seek(0) &&
+				(m_file[slot].Read(m_image[slot].GetPtr(), m_filesize[slot]) == m_filesize[slot]);
+
+			if (m_cached[slot])
+			{
+				if (!m_journal[slot].Open(str + L".journal", L"ab"))
+					log_cb(RETRO_LOG_WARN, "(FileMcd) Could not open write journal for slot %u; crash safety reduced.\n", slot);
+			}
+			else
+				log_cb(RETRO_LOG_WARN, "(FileMcd) Could not cache memory card image for slot %u; falling back to synchronous IO.\n", slot);
 		}
 	}
+
+	bool anycached = false;
+	for (int slot = 0; slot < 8; ++slot)
+		anycached |= m_cached[slot];
+
+	if (anycached)
+	{
+		m_writeThreadRunning = true;
+		m_writeThread = std::thread(&FileMemoryCard::WriteThreadProc, this);
+	}
 }
 
 void FileMemoryCard::Close()
 {
+	// Drain pending writes and stop the flush thread before touching the files.
+	StopWriteThread();
+
 	for (int slot = 0; slot < 8; ++slot)
 	{
+		if (m_journal[slot].IsOpened())
+		{
+			wxString jname = m_journal[slot].GetName();
+			m_journal[slot].Close();
+			wxRemoveFile(jname);
+		}
+		m_cached[slot] = false;
+		m_image[slot].Dispose();
+
 		if (m_file[slot].IsOpened())
 		{
 			// Store checksum
@@ -405,6 +502,120 @@ bool FileMemoryCard::Create(const wxString& mcdFile, uint sizeInMB)
 	return true;
 }
 
+// Applies a journal left behind by a crashed session to the card file, then
+// removes it.  Records are absolute writes, so replaying them is idempotent;
+// a torn record at the tail (crash mid-append) is detected and skipped.
+void FileMemoryCard::ReplayJournal(uint slot, const wxString& cardPath)
+{
+	const wxString jpath(cardPath + L".journal");
+	if (!wxFileExists(jpath))
+		return;
+
+	wxFFile jf(jpath, L"rb");
+	if (!jf.IsOpened())
+		return;
+
+	log_cb(RETRO_LOG_WARN, "(FileMcd) Replaying write journal for slot %u.\n", slot);
+
+	std::vector<u8> buffer;
+	for (;;)
+	{
+		u32 adr, size;
+		if (jf.Read(&adr, 4) != 4 || jf.Read(&size, 4) != 4)
+			break;
+		if (size == 0 || size > sizeof(m_effeffs))
+			break;
+		buffer.resize(size);
+		if (jf.Read(buffer.data(), size) != size)
+			break;
+		if (Seek(m_file[slot], adr))
+			m_file[slot].Write(buffer.data(), size);
+	}
+
+	m_file[slot].Flush();
+	jf.Close();
+	wxRemoveFile(jpath);
+}
+
+void FileMemoryCard::QueueWrite(uint slot, u32 adr, const u8* src, int size)
+{
+	McdWrite w;
+	w.slot = slot;
+	w.adr = adr;
+	w.data.assign(src, src + size);
+
+	std::unique_lock<std::mutex> lock(m_writeLock);
+	m_writeQueue.push_back(std::move(w));
+	m_writeCond.notify_one();
+}
+
+void FileMemoryCard::StopWriteThread()
+{
+	if (!m_writeThread.joinable())
+		return;
+
+	{
+		std::unique_lock<std::mutex> lock(m_writeLock);
+		m_writeThreadRunning = false;
+		m_writeCond.notify_one();
+	}
+	m_writeThread.join();
+}
+
+void FileMemoryCard::WriteThreadProc()
+{
+	std::unique_lock<std::mutex> lock(m_writeLock);
+	for (;;)
+	{
+		m_writeCond.wait(lock, [&] { return !m_writeQueue.empty() || !m_writeThreadRunning; });
+
+		bool wrote = false;
+		while (!m_writeQueue.empty())
+		{
+			McdWrite w = std::move(m_writeQueue.front());
+			m_writeQueue.pop_front();
+			lock.unlock();
+
+			// Journal first: if we die between here and the card update, the
+			// record is replayed by the next Open().
+			if (m_journal[w.slot].IsOpened())
+			{
+				const u32 size = w.data.size();
+				m_journal[w.slot].Write(&w.adr, 4);
+				m_journal[w.slot].Write(&size, 4);
+				m_journal[w.slot].Write(w.data.data(), size);
+				m_journal[w.slot].Flush();
+			}
+
+			if (Seek(m_file[w.slot], w.adr))
+				m_file[w.slot].Write(w.data.data(), w.data.size());
+
+			wrote = true;
+			lock.lock();
+		}
+
+		if (wrote)
+		{
+			// The card files have caught up with everything journaled, so the
+			// journals can be restarted from scratch.
+			lock.unlock();
+			for (int slot = 0; slot < 8; ++slot)
+			{
+				if (!m_journal[slot].IsOpened())
+					continue;
+				m_file[slot].Flush();
+				wxString jname = m_journal[slot].GetName();
+				m_journal[slot].Close();
+				m_journal[slot].Open(jname, L"wb");
+			}
+			lock.lock();
+		}
+
+		if (!m_writeThreadRunning && m_writeQueue.empty())
+			break;
+	}
+}
+
 s32 FileMemoryCard::IsPresent(uint slot)
 {
 	return m_file[slot].IsOpened();
@@ -416,7 +627,9 @@ void FileMemoryCard::GetSizeInfo(uint slot, McdSizeInfo& outways)
 	outways.EraseBlockSizeInSectors = 16; // 0x0010
 	outways.Xor = 18;                     // 0x12, XOR 02 00 00 10
 
-	if (pxAssert(m_file[slot].IsOpened()))
+	if (m_cached[slot]) // don't race the flush thread's file position
+		outways.McdSizeInSectors = m_filesize[slot] / (outways.SectorSize + outways.EraseBlockSizeInSectors);
+	else if (pxAssert(m_file[slot].IsOpened()))
 		outways.McdSizeInSectors = m_file[slot].Length() / (outways.SectorSize + outways.EraseBlockSizeInSectors);
 	else
 		outways.McdSizeInSectors = 0x4000;
@@ -439,6 +652,13 @@ s32 FileMemoryCard::Read(uint slot, u8* dest, u32 adr, int size)
 		memset(dest, 0, size);
 		return 1;
 	}
+	if (m_cached[slot])
+	{
+		if (adr + m_offset[slot] + size > m_filesize[slot])
+			return 0;
+		memcpy(dest, m_image[slot].GetPtr(adr + m_offset[slot]), size);
+		return 1;
+	}
 	if (!Seek(mcfp, adr))
 		return 0;
 	return mcfp.Read(dest, size) != 0;
@@ -462,11 +682,19 @@ s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 	}
 	else
 	{
-		if (!Seek(mcfp, adr))
-			return 0;
 		m_currentdata.MakeRoomFor(size);
-		mcfp.Read(m_currentdata.GetPtr(), size);
-
+		if (m_cached[slot])
+		{
+			if (adr + m_offset[slot] + size > m_filesize[slot])
+				return 0;
+			memcpy(m_currentdata.GetPtr(), m_image[slot].GetPtr(adr + m_offset[slot]), size);
+		}
+		else
+		{
+			if (!Seek(mcfp, adr))
+				return 0;
+			mcfp.Read(m_currentdata.GetPtr(), size);
+		}
 
 		for (int i = 0; i < size; i++)
 		{
@@ -488,10 +716,24 @@ s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 		}
 	}
 
-	if (!Seek(mcfp, adr))
-		return 0;
+	int status;
 
-	int status = mcfp.Write(m_currentdata.GetPtr(), size);
+	if (m_cached[slot])
+	{
+		// Apply to the cached image and let the flush thread journal it out;
+		// the EE thread never waits on storage here.
+		if (adr + m_offset[slot] + size > m_filesize[slot])
+			return 0;
+		memcpy(m_image[slot].GetPtr(adr + m_offset[slot]), m_currentdata.GetPtr(), size);
+		QueueWrite(slot, adr, m_currentdata.GetPtr(), size);
+		status = 1;
+	}
+	else
+	{
+		if (!Seek(mcfp, adr))
+			return 0;
+		status = mcfp.Write(m_currentdata.GetPtr(), size);
+	}
 
 	if (status)
 	{
@@ -521,6 +763,15 @@ s32 FileMemoryCard::EraseBlock(uint slot, u32 adr)
 		return 1;
 	}
 
+	if (m_cached[slot])
+	{
+		if (adr + m_offset[slot] + sizeof(m_effeffs) > m_filesize[slot])
+			return 0;
+		memcpy(m_image[slot].GetPtr(adr + m_offset[slot]), m_effeffs, sizeof(m_effeffs));
+		QueueWrite(slot, adr, m_effeffs, sizeof(m_effeffs));
+		return 1;
+	}
+
 	if (!Seek(mcfp, adr))
 		return 0;
 	return mcfp.Write(m_effeffs, sizeof(m_effeffs)) != 0;
@@ -536,19 +787,29 @@ u64 FileMemoryCard::GetCRC(uint slot)
 
 	if (m_ispsx[slot])
 	{
-		if (!Seek(mcfp, 0))
-			return 0;
+		if (m_cached[slot])
+		{
+			const u64* pdata = (u64*)m_image[slot].GetPtr();
+			const uint loops = m_filesize[slot] / sizeof(u64);
+			for (uint i = 0; i < loops; ++i)
+				retval ^= pdata[i];
+		}
+		else
+		{
+			if (!Seek(mcfp, 0))
+				return 0;
 
-		// Process the file in 4k chunks.  Speeds things up significantly.
+			// Process the file in 4k chunks.  Speeds things up significantly.
 
-		u64 buffer[528 * 8]; // use 528 (sector size), ensures even divisibility
+			u64 buffer[528 * 8]; // use 528 (sector size), ensures even divisibility
 
-		const uint filesize = mcfp.Length() / sizeof(buffer);
-		for (uint i = filesize; i; --i)
-		{
-			mcfp.Read(&buffer, sizeof(buffer));
-			for (uint t = 0; t < ArraySize(buffer); ++t)
-				retval ^= buffer[t];
+			const uint filesize = mcfp.Length() / sizeof(buffer);
+			for (uint i = filesize; i; --i)
+			{
+				mcfp.Read(&buffer, sizeof(buffer));
+				for (uint t = 0; t < ArraySize(buffer); ++t)
+					retval ^= buffer[t];
+			}
 		}
 	}
 	else
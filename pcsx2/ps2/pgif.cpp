@@ -701,13 +701,10 @@ void fillFifoOnDrain()
     //Maybe it could be cleared once FIFO has data?
     //This bit could be an enabler for the DREQ (EE->IOP for SIF2=PGIF) line. The FIFO is filled only when this is set
     //and the IOP acknowledges it.
+    //Each drain function loops internally until the FIFO watermark or the end
+    //of its transfer, so one call per mode moves the whole batch.
     drainPgpuDmaLl();
     drainPgpuDmaNrToGpu();
-    //This is done here in a loop, rather than recursively in each function, because a very large buffer causes stack oveflow.
-    while ((pgifDatRbC.count < ((pgifDatRbC.size) - PGIF_DAT_RB_LEAVE_FREE)) && ((PgpuDmaNrActToGpu != 0) || (PgpuDmaLlAct != 0))) {
-        drainPgpuDmaLl();
-        drainPgpuDmaNrToGpu();
-    }
     //Flags' names: PgpuDmaLlAct is for linked-list, PgpuDmaNrActToGpu is for normal IOP->GPU
     if ((PgpuDmaLlAct == 1) || (PgpuDmaNrActToGpu == 1))
         if (PgpuDmaNrActToIop != 1)
@@ -719,7 +716,6 @@ void fillFifoOnDrain()
 
 void drainPgpuDmaLl()
 {
-    u32 data = 0;
     if (PgpuDmaLlAct == 0)
         return;  //process only on transfer active
 
@@ -729,31 +725,32 @@ void drainPgpuDmaLl()
     //This func will be caled by this command as well.
     //if ((PGpuStatReg & 0x60000000) != 0x40000000) return;
 
-    if (pgifDatRbC.count >= ((pgifDatRbC.size) - PGIF_DAT_RB_LEAVE_FREE))
-        return;  //buffer full - needs to be drained first.
-
     if ((nextAddr == 0x000C8000) || (nextAddr == 0x0) || (nextAddr == 0x3))
         dntPrt++;
     //	if (dntPrt <5)
     //log_cb(RETRO_LOG_INFO, "LLDMAFILL nxtAdr %08X  trAddr %08X wordNr %08X  wCnt %08X  IF_CTRL= %08X \n",  nextAddr, pgpuDmaTrAddr, wordNr, wCnt, getUpdPgifCtrlReg(),  cpuRegs.pc, psxRegs.pc);
 
-    if (wCnt >= wordNr) {  //Reached end of sequence, or the beginning of a new one
-        //if ((nextAddr == DMA_LL_END_CODE) || (nextAddr == 0x00000000)) { //complete
-        //why does BoF3 US get to a link pointing to address 0??
-        if (nextAddr == DMA_LL_END_CODE) {
-            dntPrt = 0;
-            PgpuDmaLlAct = 0;
-            pgpuDmaMadr = 0x00FFFFFF;
-            //pgpuDmaMadr = nextAddr; //The END_CODE should go in the MADR reg.
-            //But instead copy the whole header code, each time one is encuntered - makes a bit more sense.
-            pgpuDmaChcr &= ~DMA_TRIGGER;     //DMA is no longer active (in transfer)
-            pgpuDmaChcr &= ~DMA_START_BUSY;  //Transfer completed => clear busy flag
-            pgpuDmaIntr(3);
+    //Walk the list in one call (headers and data sections alike), rather than
+    //re-entering per word, until the FIFO watermark or the end-code is hit.
+    while (pgifDatRbC.count < ((pgifDatRbC.size) - PGIF_DAT_RB_LEAVE_FREE)) {
+        if (wCnt >= wordNr) {  //Reached end of sequence, or the beginning of a new one
+            //if ((nextAddr == DMA_LL_END_CODE) || (nextAddr == 0x00000000)) { //complete
+            //why does BoF3 US get to a link pointing to address 0??
+            if (nextAddr == DMA_LL_END_CODE) {
+                dntPrt = 0;
+                PgpuDmaLlAct = 0;
+                pgpuDmaMadr = 0x00FFFFFF;
+                //pgpuDmaMadr = nextAddr; //The END_CODE should go in the MADR reg.
+                //But instead copy the whole header code, each time one is encuntered - makes a bit more sense.
+                pgpuDmaChcr &= ~DMA_TRIGGER;     //DMA is no longer active (in transfer)
+                pgpuDmaChcr &= ~DMA_START_BUSY;  //Transfer completed => clear busy flag
+                pgpuDmaIntr(3);
 #if LOG_PGPU_DMA == 1
-            log_cb(RETRO_LOG_INFO, "PGPU DMA LINKED LIST FINISHED \n");
+                log_cb(RETRO_LOG_INFO, "PGPU DMA LINKED LIST FINISHED \n");
 #endif
-        } else {
-            data = iopMemRead32(nextAddr);
+                return;
+            }
+            const u32 data = iopMemRead32(nextAddr);
             //		log_cb(RETRO_LOG_INFO, "PGPU LL DMA HDR= %08X  \n", data);
             //data = psxHu32(nextAddr); //The (next) current header word.
             //log_cb(RETRO_LOG_DEBUG, "PGPU LL DMA data= %08X  \n", data);
@@ -764,30 +761,35 @@ void drainPgpuDmaLl()
             wCnt = 0;
             wordNr = (data >> 24) & 0xFF;  // Current length of packet and future address of header word.
             nextAddr = data & 0x00FFFFFF;
-        }
-    } else {
-        //if (wCnt < wordNr) {
-        data = iopMemRead32(pgpuDmaTrAddr);  //0; //psxHu32(pgpuDmaTrAddr); //Get the word of the packet from IOP RAM.
+        } else {
+            //Data section of the current packet: contiguous in IOP RAM, so move
+            //as much of it as the FIFO can take without re-reading the flags.
+            u32 words = wordNr - wCnt;
+            const u32 room = ((pgifDatRbC.size) - PGIF_DAT_RB_LEAVE_FREE) - pgifDatRbC.count;
+            if (words > room)
+                words = room;
+            for (u32 i = 0; i < words; i++) {
+                u32 data = iopMemRead32(pgpuDmaTrAddr);  //Get the word of the packet from IOP RAM.
 #if LOG_PGPU_DMA == 1
 //	log_cb(RETRO_LOG_INFO, "PGPU LL DMA data= %08X  addr %08X \n", data, pgpuDmaTrAddr);
 #endif
-        ringBufPut(&pgifDatRbC, &data);
-        pgpuDmaTrAddr += 4;
-        wCnt++;
+                ringBufPut(&pgifDatRbC, &data);
+                pgpuDmaTrAddr += 4;
+                wCnt++;
+            }
+        }
     }
 }
 
 void drainPgpuDmaNrToGpu()
 {
-    u32 data = 0;
-
     if (PgpuDmaNrActToGpu == 0)
         return;  //process only on transfer active
-    if (pgifDatRbC.count >= ((pgifDatRbC.size) - PGIF_DAT_RB_LEAVE_FREE))
-        return;  //buffer full - needs to be drained first.
 
-    if (crWordN < nrWordsN) {
-        data = iopMemRead32(addrNdma);  //Get the word of the packet from IOP RAM.
+    //The source is contiguous in IOP RAM, so drain in one loop up to the FIFO
+    //watermark instead of one word per call.
+    while ((crWordN < nrWordsN) && (pgifDatRbC.count < ((pgifDatRbC.size) - PGIF_DAT_RB_LEAVE_FREE))) {
+        u32 data = iopMemRead32(addrNdma);  //Get the word of the packet from IOP RAM.
 #if LOG_PGPU_DMA == 1
 //	log_cb(RETRO_LOG_INFO, "PGPU NRM DMA data= %08X  addr %08X \n", data, pgpuDmaTrAddr);
 #endif
@@ -826,7 +828,9 @@ void drainPgpuDmaNrToIop()
 		pgpuDmaChcr &= ~DMA_START_BUSY; //Transfer completed => clear busy flag
 		psxDmaInterrupt(2);
 	} else { */
-    if (crWordN < nrWordsN) {  //This is not the best way, but... is there another?
+    //Drain everything available in one loop.  This used to tail-recurse once
+    //per word, which with a data FIFO this large could go very deep.
+    while ((pgifDatRbC.count > 0) && (crWordN < nrWordsN)) {
         ringBufGet(&pgifDatRbC, &data);
         iopMemWrite32(addrNdma, data);
         pgpuDmaMadr = 4 + pgpuDmaMadr;  //addrNdma += 4;
@@ -847,9 +851,6 @@ void drainPgpuDmaNrToIop()
         log_cb(RETRO_LOG_INFO, "PGPU DMA GPU->IOP FINISHED \n");
 #endif
     }
-
-    if (pgifDatRbC.count > 0)
-        drainPgpuDmaNrToIop();
 }
 
 
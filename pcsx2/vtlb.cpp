@@ -69,34 +69,6 @@ vtlb_private::VTLBVirtual::VTLBVirtual(VTLBPhysical phys, u32 paddr, u32 vaddr)
 		value = phys.raw() - vaddr;
 }
 
-__inline int CheckCache(u32 addr)
-{
-	// Data Cache Disabled ?
-	if(((cpuRegs.CP0.n.Config >> 16) & 0x1) != 0) 
-	{
-		for(int i = 1; i < 48; i++)
-		{
-			if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3) {
-				u32 mask  = tlb[i].PageMask;
-
-				if ((addr >= tlb[i].PFN1) && (addr <= tlb[i].PFN1 + mask)) {
-					//log_cb(RETRO_LOG_DEBUG, "Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x\n", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-					return true;
-				}
-			}
-			if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3) {
-				u32 mask  = tlb[i].PageMask;
-
-				if ((addr >= tlb[i].PFN0) && (addr <= tlb[i].PFN0 + mask)) {
-					//log_cb(RETRO_LOG_DEBUG, "Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x\n", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-					return true;
-				}
-			}
-		}
-	}
-
-	return false;
-}
 // --------------------------------------------------------------------------------------
 // Interpreter Implementations of VTLB Memory Operations.
 // --------------------------------------------------------------------------------------
@@ -109,7 +81,24 @@ DataType __fastcall vtlb_memRead(u32 addr)
 	auto vmv = vtlbdata.vmap[addr>>VTLB_PAGE_BITS];
 
 	if (!vmv.isHandler(addr))
+	{
+		if (CHECK_CACHE && CacheCheckPage(addr))
+		{
+			switch (DataSize)
+			{
+				case 8:
+					return readCache8(addr);
+				case 16:
+					return readCache16(addr);
+				case 32:
+					return readCache32(addr);
+
+				jNO_DEFAULT;
+			}
+		}
+
 		return *reinterpret_cast<DataType*>(vmv.assumePtr(addr));
+	}
 
 	//has to: translate, find function, call function
 	u32 paddr=vmv.assumeHandlerGetPAddr(addr);
@@ -137,6 +126,12 @@ void __fastcall vtlb_memRead64(u32 mem, mem64_t *out)
 
 	if (!vmv.isHandler(mem))
 	{
+		if (CHECK_CACHE && CacheCheckPage(mem))
+		{
+			*out = readCache64(mem);
+			return;
+		}
+
 		*out = *(mem64_t*)vmv.assumePtr(mem);
 	}
 	else
@@ -153,6 +148,12 @@ void __fastcall vtlb_memRead128(u32 mem, mem128_t *out)
 
 	if (!vmv.isHandler(mem))
 	{
+		if (CHECK_CACHE && CacheCheckPage(mem))
+		{
+			readCache128(mem, out);
+			return;
+		}
+
 		CopyQWC(out,(void*)vmv.assumePtr(mem));
 	}
 	else
@@ -172,7 +173,25 @@ void __fastcall vtlb_memWrite(u32 addr, DataType data)
 	auto vmv = vtlbdata.vmap[addr>>VTLB_PAGE_BITS];
 
 	if (!vmv.isHandler(addr))
-	{		
+	{
+		if (CHECK_CACHE && CacheCheckPage(addr))
+		{
+			switch (DataSize)
+			{
+				case 8:
+					writeCache8(addr, data);
+					return;
+				case 16:
+					writeCache16(addr, data);
+					return;
+				case 32:
+					writeCache32(addr, data);
+					return;
+
+				jNO_DEFAULT;
+			}
+		}
+
 		*reinterpret_cast<DataType*>(vmv.assumePtr(addr))=data;
 	}
 	else
@@ -189,7 +208,13 @@ void __fastcall vtlb_memWrite64(u32 mem, const mem64_t* value)
 	auto vmv = vtlbdata.vmap[mem>>VTLB_PAGE_BITS];
 
 	if (!vmv.isHandler(mem))
-	{		
+	{
+		if (CHECK_CACHE && CacheCheckPage(mem))
+		{
+			writeCache64(mem, *value);
+			return;
+		}
+
 		*(mem64_t*)vmv.assumePtr(mem) = *value;
 	}
 	else
@@ -208,6 +233,12 @@ void __fastcall vtlb_memWrite128(u32 mem, const mem128_t *value)
 
 	if (!vmv.isHandler(mem))
 	{
+		if (CHECK_CACHE && CacheCheckPage(mem))
+		{
+			writeCache128(mem, value);
+			return;
+		}
+
 		CopyQWC((void*)vmv.assumePtr(mem), value);
 	}
 	else
@@ -299,8 +330,10 @@ static __ri void vtlb_Miss(u32 addr,u32 mode)
 		else
 			cpuTlbMissR(addr, cpuRegs.branch);
 
-		// Exception handled. Current instruction need to be stopped
-		throw Exception::CancelInstruction();
+		// Exception handled. Current instruction need to be stopped; this
+		// resumes the interpreter's main loop via fastjmp when armed (no
+		// per-miss unwind), or throws Exception::CancelInstruction if not.
+		intCancelInstruction();
 	}
 }
 
@@ -102,6 +102,7 @@ extern void vtlb_DynGenRead64(u32 sz);
 extern void vtlb_DynGenWrite_Const( u32 bits, u32 addr_const );
 extern void vtlb_DynGenRead64_Const( u32 bits, u32 addr_const );
 extern void vtlb_DynGenRead32_Const( u32 bits, bool sign, u32 addr_const );
+extern void* vtlb_DynGenDirectPtr_Const( u32 addr_const );
 
 // --------------------------------------------------------------------------------------
 //  VtlbMemoryReserve
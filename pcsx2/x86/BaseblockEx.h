@@ -35,6 +35,7 @@ struct BASEBLOCKEX
 	uptr fnptr;
 	u16  size;	 // The size in dwords (equivalent to the number of instructions)
 	u16  x86size; // The size in byte of the translated x86 instructions
+	u32  srcHash; // Hash of the source words this block was compiled from
 
 #ifdef PCSX2_DEVBUILD
 	// Could be useful to instrument the block
@@ -211,6 +212,16 @@ public:
 
 	void Link(u32 pc, s32* jumpptr);
 
+	// Redirects every recorded link into the block at startpc to ptr, without
+	// touching the block itself.  Used to route direct block-to-block jumps
+	// through a verification stub (and back) when pages lose write protection.
+	__fi void RepointLinks(u32 startpc, uptr ptr)
+	{
+		std::pair<linkiter_t, linkiter_t> range = links.equal_range(startpc);
+		for (linkiter_t i = range.first; i != range.second; ++i)
+			*(u32*)i->second = ptr - (i->second + 4);
+	}
+
 	__fi void Reset()
 	{
 		blocks.clear();
@@ -85,11 +85,9 @@ __fi void* _XMMGetAddr(int type, int reg, VURegs *VU)
 // Get the index of a free register
 // Step1: check any available register (inuse == 0)
 // Step2: check registers that are not live (both EEINST_LIVE* are cleared)
-// Step3: check registers that won't use SSE in the future (likely broken as EEINST_XMM isn't set properly)
-// Step4: take a randome register
-//
-// Note: I don't understand why we don't check register that aren't useful anymore
-// (i.e EEINST_USED is cleared)
+// Step3: check registers that aren't useful anymore (EEINST_USED is cleared)
+// Step4: check registers that won't use SSE in the future (likely broken as EEINST_XMM isn't set properly)
+// Step5: take a randome register
 int  _getFreeXMMreg()
 {
 	int i, tempi;
@@ -114,6 +112,18 @@ int  _getFreeXMMreg()
 		}
 	}
 
+	// check for regs the rest of the block doesn't use anymore, so that
+	// registers hot in the remaining instructions stay cached
+	for (i=0; (uint)i<iREGCNT_XMM; i++) {
+		if (xmmregs[i].needed) continue;
+		if (xmmregs[i].type == XMMTYPE_GPRREG ) {
+			if (!(g_pCurInstInfo->regs[xmmregs[i].reg] & EEINST_USED)) {
+				_freeXMMreg(i);
+				return i;
+			}
+		}
+	}
+
 	// check for future xmm usage
 	for (i=0; (uint)i<iREGCNT_XMM; i++) {
 		if (xmmregs[i].needed) continue;
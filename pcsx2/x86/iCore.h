@@ -286,7 +286,10 @@ int _allocCheckGPRtoX86(EEINST* pinst, int gprreg, int mode);
 #define FLUSH_EVERYTHING	0x1ff
 //#define FLUSH_EXCEPTION		0x1ff   // will probably do this totally differently actually
 #define FLUSH_INTERPRETER	0xfff
-#define FLUSH_FULLVTLB FLUSH_NOCONST
+// The vtlb indirect dispatchers spill/reload the xmm file themselves around
+// the handler call, so memory accesses only need a writeback (registers stay
+// allocated across the much more common direct path).
+#define FLUSH_FULLVTLB (FLUSH_FLUSH_XMM|FLUSH_FREE_TEMPX86)
 
 // no freeing, used when callee won't destroy xmm regs
 #define FLUSH_NODESTROY (FLUSH_CACHED_REGS|FLUSH_FLUSH_XMM|FLUSH_FLUSH_ALLX86)
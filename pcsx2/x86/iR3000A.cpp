@@ -764,6 +764,20 @@ static __fi void recClearIOP(u32 Addr, u32 Size)
 		pc += PSXREC_CLEARM(pc);
 }
 
+// Emits an inline copy of the DispatcherReg dispatch at a block exit, giving
+// the exit its own indirect branch.  When every register-indirect branch in
+// the program funnels through the shared iopDispatcherReg, they all alias a
+// single BTB entry; duplicated per exit site, the common case of a JR $ra
+// returning to one dominant caller predicts correctly.
+static void iPsxDispatchReg()
+{
+	xMOV( eax, ptr[&psxRegs.pc] );
+	xMOV( ebx, eax );
+	xSHR( eax, 16 );
+	xMOV( rcx, ptrNative[xComplexAddress(rcx, psxRecLUT, rax*wordsize)] );
+	xJMP( ptrNative[rbx*(wordsize/4) + rcx] );
+}
+
 void psxSetBranchReg(u32 reg)
 {
 	psxbranch = 1;
@@ -801,7 +815,7 @@ void psxSetBranchReg(u32 reg)
 	_psxFlushCall(FLUSH_EVERYTHING);
 	iPsxBranchTest(0xffffffff, 1);
 
-	JMP32((uptr)iopDispatcherReg - ( (uptr)x86Ptr + 5 ));
+	iPsxDispatchReg();
 }
 
 void psxSetBranchImm( u32 imm )
@@ -1066,18 +1080,81 @@ static void __fastcall iopRecRecompile( const u32 startpc )
 
 StartRecomp:
 
+	// Idle-loop detection, same scheme as the EE recompiler's: a self loop
+	// qualifies for the FF path in iPsxBranchTest when no register is written
+	// after being read (registers reloaded or rebuilt from constants every
+	// iteration are fine) and nothing but registers changes.  Such a loop
+	// repeats identically until an event changes memory, so time can warp to
+	// the next event - the body still executes, only the cycle count jumps.
+	// The IOP spends most of its life in exactly these loops, polling SIF
+	// mailboxes and status words.  Loop-carried counters land in 'reads' and
+	// disqualify the block, which keeps delay/timeout loops at their real
+	// duration.  (The old check here only accepted all-nop bodies.)
 	s_nBlockFF = false;
 	if (s_branchTo == startpc) {
 		s_nBlockFF = true;
+
+		u32 reads = 0, loads = 1;
+
 		for (i = startpc; i < s_nEndBlock; i += 4) {
-			if (i != s_nEndBlock - 8) {
-				switch (iopMemRead32(i)) {
-					case 0: // nop
-						break;
-					default:
-						s_nBlockFF = false;
+			if (i == s_nEndBlock - 8)
+				continue; // the loop branch itself
+			psxRegs.code = iopMemRead32(i);
+			// nop
+			if (psxRegs.code == 0)
+				continue;
+			// imm arithmetic (addi..lui)
+			else if ((psxRegs.code >> 26 & 070) == 010)
+			{
+				if (loads & 1 << _Rs_) {
+					loads |= 1 << _Rt_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_;
+				if (reads & 1 << _Rt_) {
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// register arithmetic (add..nor, slt/sltu)
+			else if ((psxRegs.code >> 26) == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
+			{
+				if (loads & 1 << _Rs_ && loads & 1 << _Rt_) {
+					loads |= 1 << _Rd_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_ | 1 << _Rt_;
+				if (reads & 1 << _Rd_) {
+					s_nBlockFF = false;
+					break;
 				}
 			}
+			// loads (lb..lwr)
+			else if ((psxRegs.code >> 26 & 070) == 040 && (psxRegs.code >> 26) != 047)
+			{
+				if (loads & 1 << _Rs_) {
+					loads |= 1 << _Rt_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_;
+				if (reads & 1 << _Rt_) {
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// mfc0/cfc0, mfc2/cfc2; none of these change without an event
+			else if ((psxRegs.code >> 26 & 074) == 020 && _Rs_ < 4)
+			{
+				loads |= 1 << _Rt_;
+			}
+			else
+			{
+				s_nBlockFF = false;
+				break;
+			}
 		}
 	}
 
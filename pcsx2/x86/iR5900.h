@@ -74,6 +74,14 @@ void recBranchCall( void (*func)() );
 void recCall( void (*func)() );
 u32 scaleblockcycles_clear();
 
+// COP2 macro-op fusion state (defined in microVU_Macro.inl).  While a fused run
+// of consecutive COP2 macro instructions is open, VU0 status flags and cached VF
+// registers live in host registers; mVUmacroClose() writes them back.
+extern bool g_cop2MacroRunOpen;
+extern void mVUmacroReset();
+extern void mVUmacroClose();
+extern bool mVUmacroCanFuse(u32 code);
+
 namespace R5900{
 namespace Dynarec {
 extern void recDoBranchImm( u32* jmpSkip, bool isLikely = false );
@@ -30,6 +30,13 @@
 #include "GS.h"
 #include "CDVD/CDVD.h"
 #include "Elfheader.h"
+#include "PathDefs.h"
+
+#include <wx/ffile.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 #include "../DebugTools/Breakpoints.h"
 #include "Patch.h"
@@ -92,6 +99,7 @@ static BASEBLOCKEX* s_pCurBlockEx = NULL;
 u32 s_nEndBlock = 0; // what pc the current block ends
 u32 s_branchTo;
 static bool s_nBlockFF;
+static bool s_policy_sync = false; // block lies in a syncrec policy range: exit through the event dispatcher, no wait-loop/loop-hoist shortcuts
 
 // save states for branches
 GPR_reg64 s_saveConstRegs[32];
@@ -308,6 +316,7 @@ void recCall( void (*func)() )
 static void __fastcall recRecompile( const u32 startpc );
 static void __fastcall dyna_block_discard(u32 start,u32 sz);
 static void __fastcall dyna_page_reset(u32 start,u32 sz);
+static uptr __fastcall dyna_block_reverify(u32 vpc);
 
 // Recompiled code buffer for EE recompiler dispatchers!
 static u8 __pagealigned eeRecDispatchers[__pagesize];
@@ -318,13 +327,103 @@ static DynGenFunc* DispatcherEvent		= NULL;
 static DynGenFunc* DispatcherReg		= NULL;
 static DynGenFunc* JITCompile			= NULL;
 static DynGenFunc* JITCompileInBlock	= NULL;
+static DynGenFunc* JITReverify			= NULL;
 static DynGenFunc* EnterRecompiledCode	= NULL;
 static DynGenFunc* ExitRecompiledCode	= NULL;
 static DynGenFunc* DispatchBlockDiscard = NULL;
 static DynGenFunc* DispatchPageReset    = NULL;
+static DynGenFunc* DispatchIndirectMiss = NULL;
+
+// Inline caches for register-indirect block exits (JR/JALR).  Each site
+// remembers the last guest pc it dispatched and the address of that pc's
+// BASEBLOCK slot; a hit skips the two-level recLUT walk and gives the exit
+// its own predictable indirect branch.  The cache stores the slot rather
+// than the code pointer on purpose: the slot is re-read on every dispatch,
+// so block clears and reverification stay authoritative (a cleared block
+// simply routes to JITCompile), and slots only move on a full reset, which
+// discards the generated sites too.
+struct ICSite
+{
+	u32 pc;          // last guest pc seen; 1 never matches (pc is word aligned)
+	u32 pad;
+	BASEBLOCK* slot; // recLUT slot of that pc
+};
+
+static const int IC_SITE_COUNT = 0x8000;
+static ICSite s_ic_sites[IC_SITE_COUNT];
+static int s_ic_count = 0;
+
+// Pure compute loops (single-block self loops with no memory access, no COP0
+// and no COP2) get their event test hoisted: the block prologue works out how
+// many iterations fit before g_nextEventCycle, and the loop's back edge just
+// counts them down, jumping straight back into the block body without touching
+// cpuRegs.cycle.  The cycle sum is applied in bulk when the burst runs out or
+// the loop falls through.  One site per compiled loop; the pool is discarded
+// on reset together with the code that references it.
+struct LoopSite
+{
+	u32 init;    // iterations granted for the current burst
+	u32 counter; // iterations left; exits derive the executed count from the difference
+	u32 cycles;  // scaled cycle cost of one iteration, filled in when the back edge is emitted
+};
+
+static const int LOOP_SITE_COUNT = 0x1000;
+static LoopSite s_loop_sites[LOOP_SITE_COUNT];
+static int s_loop_count = 0;
+static LoopSite* s_loop_site = NULL; // active site while recompiling a qualifying block
+static u8* s_loop_top = NULL;        // body entry the back edge jumps to (skips the prologue)
+
+static uptr __fastcall dyna_ic_miss(ICSite* site)
+{
+	const u32 pc = cpuRegs.pc;
+	BASEBLOCK* block = PC_GETBLOCK(pc);
+
+	if (recLUT[pc >> 16])
+	{
+		site->pc = pc;
+		site->slot = block;
+	}
+
+	return block->GetFnptr();
+}
+
+// Execution profile for the persistent block cache's layout (recCacheStore).
+// The dispatcher drops into recEventTest a few thousand times a second with
+// cpuRegs.pc holding the next block to run, which makes a free block-start
+// sampling profiler.  The table is a small frequent-items sketch: hits bump
+// a slot, collisions drain it, so sustained hot blocks survive and one-off
+// visitors don't.  Counts are decayed, not cleared, across rec resets so the
+// hot set stays stable over a session.
+struct HotSample
+{
+	u32 pc; // physical address, same keying as the block cache entries
+	u32 count;
+};
+
+static const int HOT_TABLE_SIZE = 0x400;
+static HotSample s_hot_table[HOT_TABLE_SIZE];
+
+static __fi void recHotSample(u32 ppc)
+{
+	HotSample& slot = s_hot_table[((ppc >> 2) * 2654435761u) >> 22 & (HOT_TABLE_SIZE - 1)];
+
+	if (slot.pc == ppc)
+		slot.count++;
+	else if (slot.count == 0)
+	{
+		slot.pc = ppc;
+		slot.count = 1;
+	}
+	else
+		slot.count--;
+}
 
 static void recEventTest()
 {
+	const u32 pc = cpuRegs.pc;
+	if (recLUT[pc >> 16] && HWADDR(pc) < Ps2MemSize::MainRam)
+		recHotSample(HWADDR(pc));
+
 	_cpuEventTest_Shared();
 }
 
@@ -342,9 +441,11 @@ static DynGenFunc* _DynGen_JITCompile()
 	// u32 addr = cpuRegs.pc;
 	// void(**base)() = (void(**)())recLUT[addr >> 16];
 	// base[addr >> 2]();
-	xMOV( eax, ptr[&cpuRegs.pc] );
-	xMOV( ebx, eax );
-	xSHR( eax, 16 );
+	//
+	// The level-1 index is just the top half of pc, so load it flat as a
+	// word instead of the copy+shift dance.
+	xMOV( ebx, ptr[&cpuRegs.pc] );
+	xMOVZX( eax, ptr16[(u16*)((u8*)&cpuRegs.pc + 2)] );
 	xMOV( rcx, ptrNative[xComplexAddress(rcx, recLUT, rax*wordsize)] );
 	xJMP( ptrNative[rbx*(wordsize/4) + rcx] );
 
@@ -358,6 +459,20 @@ static DynGenFunc* _DynGen_JITCompileInBlock()
 	return (DynGenFunc*)retval;
 }
 
+// The address for blocks that survived their page losing write protection: the
+// C handler hash-checks the block's source words and returns either the block's
+// own entry point or JITCompile.  Entered via the same cpuRegs.pc contract as
+// JITCompile (both the dispatchers and patched block links set pc first).
+static DynGenFunc* _DynGen_JITReverify()
+{
+	u8* retval = xGetAlignedCallTarget();
+
+	xFastCall((void*)dyna_block_reverify, ptr32[&cpuRegs.pc] );
+	xJMP( rax );
+
+	return (DynGenFunc*)retval;
+}
+
 // called when jumping to variable pc address
 static DynGenFunc* _DynGen_DispatcherReg()
 {
@@ -367,9 +482,10 @@ static DynGenFunc* _DynGen_DispatcherReg()
 	// u32 addr = cpuRegs.pc;
 	// void(**base)() = (void(**)())recLUT[addr >> 16];
 	// base[addr >> 2]();
-	xMOV( eax, ptr[&cpuRegs.pc] );
-	xMOV( ebx, eax );
-	xSHR( eax, 16 );
+	//
+	// Same flat-indexed form as JITCompile above.
+	xMOV( ebx, ptr[&cpuRegs.pc] );
+	xMOVZX( eax, ptr16[(u16*)((u8*)&cpuRegs.pc + 2)] );
 	xMOV( rcx, ptrNative[xComplexAddress(rcx, recLUT, rax*wordsize)] );
 	xJMP( ptrNative[rbx*(wordsize/4) + rcx] );
 
@@ -422,6 +538,17 @@ static DynGenFunc* _DynGen_DispatchPageReset()
 	return (DynGenFunc*)retval;
 }
 
+// Shared miss path of the register-indirect inline caches; the site pointer
+// is preloaded into arg1reg at the exit.  Returns the (possibly freshly
+// cached) fnptr to jump to.
+static DynGenFunc* _DynGen_DispatchIndirectMiss()
+{
+	u8* retval = xGetPtr();
+	xFastCall((void*)dyna_ic_miss);
+	xJMP( rax );
+	return (DynGenFunc*)retval;
+}
+
 static void _DynGen_Dispatchers()
 {
 	// In case init gets called multiple times:
@@ -439,9 +566,11 @@ static void _DynGen_Dispatchers()
 
 	JITCompile           = _DynGen_JITCompile();
 	JITCompileInBlock    = _DynGen_JITCompileInBlock();
+	JITReverify          = _DynGen_JITReverify();
 	EnterRecompiledCode  = _DynGen_EnterRecompiledCode();
 	DispatchBlockDiscard = _DynGen_DispatchBlockDiscard();
 	DispatchPageReset    = _DynGen_DispatchPageReset();
+	DispatchIndirectMiss = _DynGen_DispatchIndirectMiss();
 
 	HostSys::MemProtectStatic( eeRecDispatchers, PageAccess_ExecOnly() );
 
@@ -575,6 +704,231 @@ static bool eeCpuExecuting = false;
 static bool g_resetEeScalingStats = false;
 static int g_patchesNeedRedo = 0;
 
+// --------------------------------------------------------------------------------------
+//  Persistent block seed cache
+// --------------------------------------------------------------------------------------
+// Translated x86 can't be persisted as-is (it is full of absolute host addresses into
+// recmem, cpuRegs and the handler tables), but recRecompile is deterministic for a given
+// program image; the expensive part of a cold boot is re-discovering which PCs are block
+// entry points, one dispatcher exit at a time.  So we persist the set of block start PCs
+// along with a hash of their source words, keyed by ElfCRC, and precompile every block
+// whose source still matches when the same game is booted again.
+
+static bool s_recCacheLoadPending = false;	// set when the game's ELF entry point is first compiled
+static u32  s_recCacheSavedCount = 0;		// blocks covered by the cache file already on disk
+
+static const u32 EEBLOCKCACHE_MAGIC   = 0x43424545;	// 'EEBC'
+static const u32 EEBLOCKCACHE_VERSION = 1;
+
+struct EEBlockCacheEntry
+{
+	u32 startpc;	// physical address, main RAM only
+	u32 size;		// size in dwords, same unit as BASEBLOCKEX::size
+	u32 hash;
+};
+
+static wxString recCacheFilename()
+{
+	// Same "<serial> (<crc>)" keying as the savestates, so the profile follows
+	// the title the GameDatabase knows it by and multi-ELF discs don't collide.
+	wxString serialName( DiscSerial );
+	if (serialName.IsEmpty()) serialName = L"BIOS";
+
+	return Path::Combine(PathDefs::GetSavestates().ToString(), pxsFmt(L"%s (%08X).eeblocks", WX_STR(serialName), ElfCRC));
+}
+
+static u32 recCacheHashSource(u32 startpc, u32 sizeDwords)
+{
+	// FNV-1a over the source words; cheap enough to run over every cached block on boot.
+	const u32* src = (u32*)PSM(startpc);
+	u32 hash = 2166136261U;
+	for (u32 i = 0; i < sizeDwords; ++i) {
+		hash ^= src[i];
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+// --------------------------------------------------------------------------------------
+//  Duplicate-content accounting
+// --------------------------------------------------------------------------------------
+// Overlay systems load the same routines at several physical addresses, and since
+// blocks key on startpc each copy is translated from scratch.  Sharing or cloning the
+// existing translation is not an option with this emitter: guest PCs are baked into
+// the object code as plain immediates at dozens of sites (branch targets, the
+// cpuRegs.pc stores in iFlushCall, event-test exits, inline-cache sites) and no
+// relocation records exist to find them again, while MIPS-relative branch targets
+// change meaning with the load address anyway.  What we can do cheaply is measure the
+// problem: every finalized block registers its source hash here, and the reset path
+// reports how much translation work went into content that was already compiled at
+// another address.
+static std::unordered_map<u32, u32> s_contentFirstPC; // srcHash -> first startpc seen
+static u32 s_dupContentBlocks = 0;
+static u32 s_dupContentInsns = 0;
+
+static void recContentNote(u32 startpc, u32 sizeDwords, u32 hash)
+{
+	std::pair<std::unordered_map<u32, u32>::iterator, bool> ins =
+		s_contentFirstPC.insert(std::make_pair(hash, startpc));
+
+	if (!ins.second && ins.first->second != startpc)
+	{
+		s_dupContentBlocks++;
+		s_dupContentInsns += sizeDwords;
+	}
+}
+
+// --------------------------------------------------------------------------------------
+//  Speculative successor compilation
+// --------------------------------------------------------------------------------------
+// Every part of the emitter is process-global state (x86Ptr, recConstBuf, the inst
+// cache, the reg alloc tables), so blocks cannot be compiled on worker threads without
+// rewriting the whole backend.  What we can do is stop paying one full dispatcher
+// round trip per block during compilation storms: when the dispatcher demand-compiles
+// a block, its statically known successors (direct branch target and fall-through) are
+// queued and compiled right away from the same cache-warm state, breadth-first up to a
+// small bound.  Since block endings link directly to compiled successors
+// (recBlocks.Link / SetBranchImm), the speculated blocks are wired in for free.
+
+static const uint recSpecQueueSize = 32;
+static u32  s_specQueue[recSpecQueueSize];
+static uint s_specCount = 0;
+static bool s_specDraining = false;
+
+static void recSpecEnqueue(u32 vpc)
+{
+	// Only main RAM code is worth speculating on (the BIOS compiles once and stays),
+	// and only through mapped pages; unmapped ones leave recLUT pointing at null.
+	if (s_specCount >= recSpecQueueSize || vpc == 0 || vpc == (u32)-1 || (vpc & 3))
+		return;
+	if (!recLUT[vpc >> 16] || HWADDR(vpc) >= Ps2MemSize::MainRam)
+		return;
+	if (PC_GETBLOCK(vpc)->GetFnptr() != (uptr)JITCompile)
+		return;
+
+	s_specQueue[s_specCount++] = vpc;
+}
+
+// Snapshots the currently compiled block set to disk.  Called when the block table is
+// about to be thrown away (rec reset / shutdown), which is exactly when it describes the
+// game's hot set best.
+static void recCacheStore()
+{
+	if (!ElfCRC || !recRAM)
+		return;
+
+	u32 count = 0;
+	for (int i = 0; recBlocks[i]; ++i) {
+		const BASEBLOCKEX& block = *recBlocks[i];
+		if (block.startpc < Ps2MemSize::MainRam && block.size)
+			count++;
+	}
+
+	// Don't rewrite the file for a population we've already covered (frequent resets
+	// mid-game would otherwise turn into file I/O stutter of their own).
+	if (count <= s_recCacheSavedCount + 256)
+		return;
+
+	wxFFile file(recCacheFilename(), L"wb");
+	if (!file.IsOpened())
+		return;
+
+	file.Write(&EEBLOCKCACHE_MAGIC, sizeof(u32));
+	file.Write(&EEBLOCKCACHE_VERSION, sizeof(u32));
+	file.Write(&ElfCRC, sizeof(u32));
+	file.Write(&count, sizeof(u32));
+
+	std::vector<EEBlockCacheEntry> entries;
+	entries.reserve(count);
+
+	for (int i = 0; recBlocks[i]; ++i) {
+		const BASEBLOCKEX& block = *recBlocks[i];
+		if (block.startpc >= Ps2MemSize::MainRam || !block.size)
+			continue;
+
+		EEBlockCacheEntry entry;
+		entry.startpc = block.startpc;
+		entry.size    = block.size;
+		entry.hash    = recCacheHashSource(block.startpc, block.size);
+		entries.push_back(entry);
+	}
+
+	// Hottest blocks first, cold remainder in address order.  Priming compiles
+	// in file order and the speculative drain lays each head's static successor
+	// chain out right behind it, so after every reset the hot set lands
+	// contiguously at the front of recmem instead of scattered in first-compile
+	// order across the whole cache.
+	std::unordered_map<u32, u32> hotness;
+	for (const HotSample& slot : s_hot_table)
+		if (slot.count)
+			hotness[slot.pc] = slot.count;
+
+	std::stable_sort(entries.begin(), entries.end(),
+		[&hotness](const EEBlockCacheEntry& a, const EEBlockCacheEntry& b) {
+			auto ia = hotness.find(a.startpc);
+			auto ib = hotness.find(b.startpc);
+			const u32 ca = (ia != hotness.end()) ? ia->second : 0;
+			const u32 cb = (ib != hotness.end()) ? ib->second : 0;
+			return ca > cb;
+		});
+
+	file.Write(entries.data(), entries.size() * sizeof(EEBlockCacheEntry));
+
+	s_recCacheSavedCount = count;
+	log_cb(RETRO_LOG_INFO, "EE/iR5900-32: saved %u blocks to the persistent block cache\n", count);
+}
+
+// Precompiles every cached block whose source words still match.  skippc is the block
+// currently being handled by our caller (recRecompile), which must not be compiled twice.
+static void recCachePrime(u32 skippc)
+{
+	wxFFile file(recCacheFilename(), L"rb");
+	if (!file.IsOpened())
+		return;
+
+	u32 header[4];
+	if (file.Read(header, sizeof(header)) != sizeof(header))
+		return;
+	if (header[0] != EEBLOCKCACHE_MAGIC || header[1] != EEBLOCKCACHE_VERSION || header[2] != ElfCRC)
+		return;
+
+	u32 primed = 0;
+	for (u32 i = 0; i < header[3]; ++i) {
+		EEBlockCacheEntry entry;
+		if (file.Read(&entry, sizeof(entry)) != sizeof(entry))
+			break;
+
+		if (entry.startpc >= Ps2MemSize::MainRam || entry.startpc == skippc || !entry.size)
+			continue;
+
+		// Distrust the on-disk size before hashing with it: the hash walk reads
+		// entry.size dwords straight out of main RAM, and a truncated or corrupt
+		// cache file (crash mid-store) must not turn into an out-of-bounds read
+		// on every subsequent boot.  BASEBLOCKEX::size is a u16, so anything
+		// larger cannot have come from recCacheStore either.
+		if (entry.size > 0xFFFF || entry.startpc + (u64)entry.size * 4 > Ps2MemSize::MainRam)
+			continue;
+
+		// Skip blocks already compiled, and blocks whose code has changed since the
+		// cache was written (overlays, self-modifying loaders, different game state).
+		if (PC_GETBLOCK(entry.startpc)->GetFnptr() != (uptr)JITCompile)
+			continue;
+		if (recCacheHashSource(entry.startpc, entry.size) != entry.hash)
+			continue;
+
+		recRecompile(entry.startpc);
+		primed++;
+
+		// A reset mid-prime means the code cache filled up; the remaining entries
+		// would only flush what we just compiled.
+		if (eeRecNeedsReset)
+			break;
+	}
+
+	s_recCacheSavedCount = std::max(s_recCacheSavedCount, primed);
+	log_cb(RETRO_LOG_INFO, "EE/iR5900-32: primed %u blocks from the persistent block cache\n", primed);
+}
+
 ////////////////////////////////////////////////////
 static void recResetRaw()
 {
@@ -585,6 +939,15 @@ static void recResetRaw()
 
 	log_cb(RETRO_LOG_INFO, "EE/iR5900-32 Recompiler Reset\n" );
 
+	if (s_dupContentBlocks)
+		log_cb(RETRO_LOG_INFO, "EE/iR5900-32: %u blocks (%u insns) recompiled content already translated at another address\n",
+			s_dupContentBlocks, s_dupContentInsns);
+	s_contentFirstPC.clear();
+	s_dupContentBlocks = 0;
+	s_dupContentInsns = 0;
+
+	recCacheStore();
+
 	recMem->Reset();
 	ClearRecLUT((BASEBLOCK*)recLutReserve_RAM, recLutSize);
 	memset(recRAMCopy, 0, Ps2MemSize::MainRam);
@@ -607,10 +970,21 @@ static void recResetRaw()
 	g_branch = 0;
 	g_resetEeScalingStats = true;
 	g_patchesNeedRedo = 1;
+
+	// Generated inline-cache and loop-hoist sites were discarded with the code buffer.
+	s_ic_count = 0;
+	s_loop_count = 0;
+
+	// Let the execution profile adapt but keep the established hot set ranked
+	// across the reset; the next recCacheStore orders the cache file by it.
+	for (HotSample& slot : s_hot_table)
+		slot.count >>= 1;
 }
 
 static void recShutdown()
 {
+	recCacheStore();
+
 	safe_delete( recMem );
 	safe_aligned_free( recRAMCopy );
 	safe_aligned_free( recLutReserve_RAM );
@@ -687,6 +1061,11 @@ static void recExecute()
 	{
 	}
 
+	// Execution exits on suspend/state-change requests, which are the only
+	// orderly checkpoints a frontend guarantees us; recCacheStore() itself
+	// skips the write unless the block population grew meaningfully.
+	recCacheStore();
+
 #else
 
 	int oldstate;
@@ -718,6 +1097,11 @@ static void recExecute()
 
 	eeCpuExecuting = false;
 
+	// Execution exits on suspend/state-change requests, which are the only
+	// orderly checkpoints a frontend guarantees us; recCacheStore() itself
+	// skips the write unless the block population grew meaningfully.
+	recCacheStore();
+
 	if(m_cpuException)	m_cpuException->Rethrow();
 	if(m_Exception)		m_Exception->Rethrow();
 #endif
@@ -911,6 +1295,10 @@ void LoadBranchState()
 
 void iFlushCall(int flushtype)
 {
+	// A fused COP2 macro run keeps VU0 state in host registers; close it before
+	// making the EE state canonical (covers block exits and emitted C calls).
+	if (g_cop2MacroRunOpen) mVUmacroClose();
+
 	// Free registers that are not saved across function calls (x86-32 ABI):
 	_freeX86reg(eax);
 	_freeX86reg(ecx);
@@ -1038,6 +1426,35 @@ u32 scaleblockcycles_clear()
 //   noDispatch - When set true, then jump to Dispatcher.  Used by the recs
 //   for blocks which perform exception checks without branching (it's enabled by
 //   setting "g_branch = 2";
+// Emits the register-indirect exit with its own inline cache.  Monomorphic
+// sites (JR $ra returning to one dominant caller, jump tables stuck on one
+// case) compare pc against the cached value and jump straight through the
+// cached BASEBLOCK slot; everything else funnels to the shared miss stub,
+// which refills the cache.  When the site pool runs dry the exit degrades
+// to the plain shared dispatcher.
+static void iDispatchRegInline()
+{
+	if (s_ic_count >= IC_SITE_COUNT)
+	{
+		xJMP( (void*)DispatcherReg );
+		return;
+	}
+
+	ICSite* site = &s_ic_sites[s_ic_count++];
+	site->pc = 1;
+	site->slot = NULL;
+
+	xMOV( eax, ptr[&cpuRegs.pc] );
+	xMOV64( rcx, (sptr)site );
+	xCMP( eax, ptr32[rcx] );
+	xForwardJNE8 miss;
+	xMOV( rax, ptrNative[rcx+8] );
+	xJMP( ptrNative[rax] );
+	miss.SetTarget();
+	xMOV( arg1reg, rcx );
+	xJMP( (void*)DispatchIndirectMiss );
+}
+
 static void iBranchTest(u32 newpc)
 {
 	// Check the Event scheduler if our "cycle target" has been reached.
@@ -1055,19 +1472,58 @@ static void iBranchTest(u32 newpc)
 
 		xJMP( (void*)DispatcherEvent );
 	}
+	else if (s_loop_site && newpc == s_branchTo)
+	{
+		// Hoisted event check: the prologue granted us init iterations, so the
+		// back edge only decrements the counter and re-enters the block body.
+		// When the burst runs out the whole cycle sum is applied at once and
+		// the scheduler gets a look; re-entry recomputes a fresh burst.
+		s_loop_site->cycles = std::max<u32>(scaleblockcycles(), 1);
+
+		xSUB(ptr32[&s_loop_site->counter], 1);
+		xJG(s_loop_top);
+
+		xMOV(eax, ptr32[&s_loop_site->init]);
+		xMUL(eax, ptr32[&s_loop_site->cycles]);
+		xADD(ptr32[&cpuRegs.cycle], eax);
+
+		xJMP( (void*)DispatcherEvent );
+	}
 	else
 	{
 		xMOV(eax, ptr[&cpuRegs.cycle]);
+		if (s_loop_site)
+		{
+			// Falling out of a hoisted loop: bill the iterations the burst has
+			// already run before the usual per-block accounting.
+			xMOV(ecx, ptr32[&s_loop_site->init]);
+			xSUB(ecx, ptr32[&s_loop_site->counter]);
+			xMUL(ecx, ptr32[&s_loop_site->cycles]);
+			xADD(eax, ecx);
+		}
 		xADD(eax, scaleblockcycles());
 		xMOV(ptr[&cpuRegs.cycle], eax); // update cycles
 		xSUB(eax, ptr[&g_nextEventCycle]);
 
-		if (newpc == 0xffffffff)
-			xJS( DispatcherReg );
+		if (s_policy_sync)
+		{
+			// syncrec policy range: always take the event dispatcher, no block
+			// linking and no inline cache (cpuRegs.pc is already written).
+			xJMP( (void*)DispatcherEvent );
+		}
+		else if (newpc == 0xffffffff)
+		{
+			xForwardJNS8 toEvent;
+			iDispatchRegInline();
+			toEvent.SetTarget();
+			xJMP( (void*)DispatcherEvent );
+		}
 		else
+		{
 			recBlocks.Link(HWADDR(newpc), xJcc32(Jcc_Signed));
 
-		xJMP( (void*)DispatcherEvent );
+			xJMP( (void*)DispatcherEvent );
+		}
 	}
 }
 
@@ -1361,6 +1817,11 @@ void recompileNextInstruction(int delayslot)
 		s_nBlockCycles +=9 * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
 	}
 	else {
+		// Close a fused COP2 macro run before compiling anything that doesn't
+		// fuse into it (EE NOPs emit no code, so they don't break a run).
+		if (g_cop2MacroRunOpen && !mVUmacroCanFuse(cpuRegs.code))
+			mVUmacroClose();
+
 		//If the COP0 DIE bit is disabled, cycles should be doubled.
 		s_nBlockCycles += opcode.cycles * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
 		try {
@@ -1490,6 +1951,102 @@ void __fastcall dyna_page_reset(u32 start,u32 sz)
 	mmap_MarkCountedRamPage( start );
 }
 
+// Called from the RAM write-protection fault handler (mmap_ClearCpuBlock) in place
+// of a wholesale Cpu->Clear of the page.  Nothing has been modified yet when the
+// fault fires -- the write re-executes after we return -- so instead of throwing
+// every block on the page away, each live block is parked behind JITReverify.  On
+// its next entry the block's source words are hash-checked against the hash stored
+// at compile time, and only blocks whose code actually changed get recompiled.
+// Direct block-to-block links are rerouted through the stub as well, since the
+// page stays writable and later writes won't fault.
+void recLazyClearPage(u32 paddr)
+{
+	if (Cpu != &recCpu) {
+		// Page protection is only ever armed by this recompiler, but stay safe
+		// if that ever changes.
+		Cpu->Clear(paddr, 0x400);
+		return;
+	}
+
+	const u32 page = paddr & ~0xfffUL;
+
+	int idx = recBlocks.LastIndex(page + 0xffc);
+	BASEBLOCKEX* pexblock;
+
+	while ((pexblock = recBlocks[idx--])) {
+		if (pexblock->startpc < page)	// blocks never span pages
+			break;
+
+		BASEBLOCK* pblock = PC_GETBLOCK(pexblock->startpc);
+
+		if (pblock->GetFnptr() == pexblock->fnptr) {
+			pblock->SetFnptr((uptr)JITReverify);
+			recBlocks.RepointLinks(pexblock->startpc, (uptr)JITReverify);
+		}
+	}
+}
+
+// Pre-entry check for blocks parked by recLazyClearPage.  Returns the address the
+// JITReverify stub should jump to: the block itself when its source is intact, or
+// JITCompile after clearing it when the code really was rewritten.  Blocks that
+// keep passing the check accumulate the same weighted credit the counted-manual
+// scheme uses, and once the page has proven stable its write protection is
+// re-armed and direct dispatch is restored.
+static uptr __fastcall dyna_block_reverify(u32 vpc)
+{
+	const u32 ppc = HWADDR(vpc);
+	BASEBLOCKEX* pex = recBlocks.Get(ppc);
+	BASEBLOCK* pblock = PC_GETBLOCK(vpc);
+
+	if (!pex || pex->startpc != ppc) {
+		// The block was removed behind our back (range clear from a DMA path).
+		pblock->SetFnptr((uptr)JITCompile);
+		return (uptr)JITCompile;
+	}
+
+	if (recCacheHashSource(pex->startpc, pex->size) != pex->srcHash) {
+		recClear(vpc, pex->size);
+		return (uptr)JITCompile;
+	}
+
+	const u32 pg = ppc >> 12;
+	const u32 credit = (u32)manual_page[pg] + pex->size;
+
+	if (credit <= 0xffff || manual_counter[pg] > 3) {
+		// Same give-up threshold as the counted-manual blocks: pages that keep
+		// cycling through resets stay permanently hash-checked instead.
+		manual_page[pg] = (u16)std::min<u32>(credit, 0xffff);
+		return pex->fnptr;
+	}
+
+	// The page ran a lot of verified code without being rewritten: re-protect it
+	// and reinstate direct dispatch for every block that still matches its hash.
+	// Blocks that don't are left parked and will clear themselves on next entry.
+	manual_page[pg] = 0;
+	manual_counter[pg]++;
+
+	int idx = recBlocks.LastIndex((pg << 12) + 0xffc);
+	BASEBLOCKEX* pexblock;
+
+	while ((pexblock = recBlocks[idx--])) {
+		if (pexblock->startpc < (pg << 12))
+			break;
+
+		BASEBLOCK* b = PC_GETBLOCK(pexblock->startpc);
+
+		if (b->GetFnptr() == (uptr)JITReverify
+			&& recCacheHashSource(pexblock->startpc, pexblock->size) == pexblock->srcHash)
+		{
+			b->SetFnptr(pexblock->fnptr);
+			recBlocks.RepointLinks(pexblock->startpc, pexblock->fnptr);
+		}
+	}
+
+	mmap_MarkCountedRamPage(ppc);
+
+	return pex->fnptr;
+}
+
 static void memory_protect_recompiled_code(u32 startpc, u32 size)
 {
 	u32 inpage_ptr = HWADDR(startpc);
@@ -1590,6 +2147,654 @@ bool skipMPEG_By_Pattern(u32 sPC) {
 	return 0;
 }
 
+////////////////////////////////////////////////
+// Back-Prob Function Tables - Gathering Info //
+////////////////////////////////////////////////
+// Backwards liveness propagation over the block, mirroring rpsxpropBSC on the
+// IOP side.  The EE twist is that GPRs are 128 bits wide: the regular 64-bit
+// ALU ops only replace the lower half and leave the upper one intact, so they
+// only kill EEINST_LIVE0.  Just the full quadword writes (LQ, QMFC2, the
+// parallel MMI ops) kill EEINST_LIVE2 as well.
+//
+// Anything modelled wrong here corrupts register state, so every opcode we
+// don't track precisely resets the analysis to fully-live via recpropClear.
+// Note that a reg can only be flagged written (_recFillRegister) when the
+// write is unconditional: _eeGetConstReg uses that info to skip flushing
+// constants.  The FPU side stays fully conservative (always live).
+
+#define recpropSetRead(reg) { \
+	if( reg ) { \
+		if( !(pinst->regs[reg] & EEINST_USED) ) \
+			pinst->regs[reg] |= EEINST_LASTUSE; \
+		prev->regs[reg] |= EEINST_LIVE0|EEINST_USED; \
+		pinst->regs[reg] |= EEINST_USED; \
+		_recFillRegister(*pinst, XMMTYPE_GPRREG, reg, 0); \
+	} \
+} \
+
+#define recpropSetRead128(reg) { \
+	if( reg ) { \
+		if( !(pinst->regs[reg] & EEINST_USED) ) \
+			pinst->regs[reg] |= EEINST_LASTUSE; \
+		prev->regs[reg] |= EEINST_LIVE0|EEINST_LIVE2|EEINST_USED; \
+		pinst->regs[reg] |= EEINST_USED; \
+		_recFillRegister(*pinst, XMMTYPE_GPRREG, reg, 0); \
+	} \
+} \
+
+#define recpropSetWrite(reg) { \
+	if( reg ) { \
+		prev->regs[reg] &= ~EEINST_LIVE0; \
+		if( !(pinst->regs[reg] & EEINST_USED) ) \
+			pinst->regs[reg] |= EEINST_LASTUSE; \
+		pinst->regs[reg] |= EEINST_USED; \
+		prev->regs[reg] |= EEINST_USED; \
+		_recFillRegister(*pinst, XMMTYPE_GPRREG, reg, 1); \
+	} \
+} \
+
+#define recpropSetWrite128(reg) { \
+	if( reg ) { \
+		prev->regs[reg] &= ~(EEINST_LIVE0|EEINST_LIVE2); \
+		if( !(pinst->regs[reg] & EEINST_USED) ) \
+			pinst->regs[reg] |= EEINST_LASTUSE; \
+		pinst->regs[reg] |= EEINST_USED; \
+		prev->regs[reg] |= EEINST_USED; \
+		_recFillRegister(*pinst, XMMTYPE_GPRREG, reg, 1); \
+	} \
+}
+
+// gives up on the instruction: everything before it is considered live again
+static void recpropClear(EEINST* prev)
+{
+	_recClearInst(prev);
+	prev->info = 0;
+}
+
+// The delay slot of a branch-likely is skipped on the not-taken path, so
+// whatever it killed may still be live when execution falls through behind
+// it; merge the state from past the slot back in.  pinst[1] is always valid:
+// in the worst case it is the fully-live block sentinel.
+static void recpropLikely(EEINST* prev, EEINST* pinst)
+{
+	int i;
+	for(i = 0; i < 34; ++i)
+		prev->regs[i] |= pinst[1].regs[i] & (EEINST_LIVE0|EEINST_LIVE2|EEINST_USED);
+}
+
+//SLL , NULL , SRL , SRA , SLLV   , NULL , SRLV  , SRAV ,
+//JR  , JALR , MOVZ, MOVN, SYSCALL, BREAK, NULL  , SYNC ,
+//MFHI, MTHI , MFLO, MTLO, DSLLV  , NULL , DSRLV , DSRAV,
+//MULT, MULTU, DIV , DIVU, NULL   , NULL , NULL  , NULL ,
+//ADD , ADDU , SUB , SUBU, AND    , OR   , XOR   , NOR  ,
+//MFSA, MTSA , SLT , SLTU, DADD   , DADDU, DSUB  , DSUBU,
+//TGE , TGEU , TLT , TLTU, TEQ    , NULL , TNE   , NULL ,
+//DSLL, NULL , DSRL, DSRA, DSLL32 , NULL , DSRL32, DSRA32
+static void recpropSPECIAL(EEINST* prev, EEINST* pinst)
+{
+	switch(_Funct_) {
+		case 0: // sll
+		case 2: // srl
+		case 3: // sra
+		case 56: // dsll
+		case 58: // dsrl
+		case 59: // dsra
+		case 60: // dsll32
+		case 62: // dsrl32
+		case 63: // dsra32
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rt_);
+			break;
+
+		case 4: // sllv
+		case 6: // srlv
+		case 7: // srav
+		case 20: // dsllv
+		case 22: // dsrlv
+		case 23: // dsrav
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+
+		case 8: // jr
+			recpropSetRead(_Rs_);
+			break;
+		case 9: // jalr
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 10: // movz
+		case 11: // movn
+			// rd keeps its old value when the condition fails, so it is
+			// effectively read and cannot be flagged as written
+			recpropSetRead(_Rd_);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+
+		case 12: // syscall
+		case 13: // break
+			recpropClear(prev);
+			break;
+		case 15: // sync
+			break;
+
+		case 16: // mfhi
+			recpropSetWrite(_Rd_);
+			recpropSetRead(XMMGPR_HI);
+			break;
+		case 17: // mthi
+			recpropSetWrite(XMMGPR_HI);
+			recpropSetRead(_Rs_);
+			break;
+		case 18: // mflo
+			recpropSetWrite(_Rd_);
+			recpropSetRead(XMMGPR_LO);
+			break;
+		case 19: // mtlo
+			recpropSetWrite(XMMGPR_LO);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 24: // mult
+		case 25: // multu
+			recpropSetWrite(_Rd_); // mult/multu can target a gpr on the EE
+			recpropSetWrite(XMMGPR_LO);
+			recpropSetWrite(XMMGPR_HI);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+		case 26: // div
+		case 27: // divu
+			recpropSetWrite(XMMGPR_LO);
+			recpropSetWrite(XMMGPR_HI);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+
+		case 32: // add
+		case 33: // addu
+		case 34: // sub
+		case 35: // subu
+		case 36: // and
+		case 37: // or
+		case 38: // xor
+		case 39: // nor
+		case 42: // slt
+		case 43: // sltu
+		case 44: // dadd
+		case 45: // daddu
+		case 46: // dsub
+		case 47: // dsubu
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+
+		case 40: // mfsa
+			recpropSetWrite(_Rd_);
+			break;
+		case 41: // mtsa
+			recpropSetRead(_Rs_);
+			break;
+
+		default:
+			// traps raise exceptions conditionally, so treat them (and any
+			// unknown encoding) as a full barrier
+			recpropClear(prev);
+			break;
+	}
+}
+
+//BLTZ  , BGEZ  , BLTZL  , BGEZL  , NULL, NULL, NULL, NULL,
+//TGEI  , TGEIU , TLTI   , TLTIU  , TEQI, NULL, TNEI, NULL,
+//BLTZAL, BGEZAL, BLTZALL, BGEZALL, NULL, NULL, NULL, NULL,
+//MTSAB , MTSAH , NULL   , NULL   , NULL, NULL, NULL, NULL
+static void recpropREGIMM(EEINST* prev, EEINST* pinst)
+{
+	switch(_Rt_) {
+		case 0: // bltz
+		case 1: // bgez
+			recpropSetRead(_Rs_);
+			break;
+		case 2: // bltzl
+		case 3: // bgezl
+			recpropLikely(prev, pinst);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 16: // bltzal
+		case 17: // bgezal
+			// do not kill 31
+			recpropSetRead(_Rs_);
+			break;
+		case 18: // bltzall
+		case 19: // bgezall
+			recpropLikely(prev, pinst);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 24: // mtsab
+		case 25: // mtsah
+			recpropSetRead(_Rs_);
+			break;
+
+		default:
+			recpropClear(prev);
+			break;
+	}
+}
+
+//MFC0, NULL, NULL, NULL, MTC0, NULL, NULL, NULL,
+//BC0 , NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+//TLB , NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+//NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
+static void recpropCP0(EEINST* prev, EEINST* pinst)
+{
+	switch(_Rs_) {
+		case 0: // mfc0
+			recpropSetWrite(_Rt_);
+			break;
+		case 4: // mtc0
+			recpropSetRead(_Rt_);
+			break;
+		case 8: // bc0
+			break;
+
+		default:
+			// tlb ops, eret, ei/di
+			recpropClear(prev);
+			break;
+	}
+}
+
+//MFC1, NULL, CFC1, NULL, MTC1, NULL, CTC1, NULL,
+//BC1 , NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+//S   , NULL, NULL, NULL, W   , NULL, NULL, NULL,
+//NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
+static void recpropCP1(EEINST* prev, EEINST* pinst)
+{
+	switch(_Rs_) {
+		case 0: // mfc1
+		case 2: // cfc1
+			recpropSetWrite(_Rt_);
+			break;
+		case 4: // mtc1
+		case 6: // ctc1
+			recpropSetRead(_Rt_);
+			break;
+		case 8: // bc1
+			break;
+		case 16: // cop1.s
+		case 20: // cop1.w
+			// fpu registers are tracked conservatively, no gpr access
+			break;
+
+		default:
+			recpropClear(prev);
+			break;
+	}
+}
+
+//NULL , QMFC2, CFC2, NULL, NULL, QMTC2, CTC2, NULL,
+//BC2  , NULL , NULL, NULL, NULL, NULL , NULL, NULL,
+//SPEC1, SPEC1, ...
+static void recpropCP2(EEINST* prev, EEINST* pinst)
+{
+	switch(_Rs_) {
+		case 1: // qmfc2
+			recpropSetWrite128(_Rt_);
+			break;
+		case 2: // cfc2
+			recpropSetWrite(_Rt_);
+			break;
+		case 5: // qmtc2
+			recpropSetRead128(_Rt_);
+			break;
+		case 6: // ctc2
+			recpropSetRead(_Rt_);
+			break;
+		case 8: // bc2
+			break;
+
+		default:
+			if( _Rs_ & 0x10 ) // vu0 macro instruction, no gpr access
+				break;
+			recpropClear(prev);
+			break;
+	}
+}
+
+//MADD , MADDU , NULL , NULL , PLZCW, NULL  , NULL , NULL,
+//MMI0 , MMI2  , NULL , NULL , NULL , NULL  , NULL , NULL,
+//MFHI1, MTHI1 , MFLO1, MTLO1, NULL , NULL  , NULL , NULL,
+//MULT1, MULTU1, DIV1 , DIVU1, NULL , NULL  , NULL , NULL,
+//MADD1, MADDU1, NULL , NULL , NULL , NULL  , NULL , NULL,
+//MMI1 , MMI3  , NULL , NULL , NULL , NULL  , NULL , NULL,
+//PMFHL, PMTHL , NULL , NULL , PSLLH, NULL  , PSRLH, PSRAH,
+//NULL , NULL  , NULL , NULL , PSLLW, NULL  , PSRLW, PSRAW
+static void recpropMMI(EEINST* prev, EEINST* pinst)
+{
+	switch(_Funct_) {
+		case 0: // madd
+		case 1: // maddu
+			recpropSetWrite(_Rd_);
+			recpropSetWrite(XMMGPR_LO);
+			recpropSetWrite(XMMGPR_HI);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			recpropSetRead(XMMGPR_LO); // accumulates
+			recpropSetRead(XMMGPR_HI);
+			break;
+
+		case 4: // plzcw
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 8: // mmi0
+		case 40: // mmi1
+			// parallel alu ops: full quadword rd = rs op rt, no hi/lo
+			recpropSetWrite128(_Rd_);
+			recpropSetRead128(_Rs_);
+			recpropSetRead128(_Rt_);
+			break;
+
+		case 9: // mmi2
+			switch(_Sa_) {
+				case 2: // psllvw
+				case 3: // psrlvw
+				case 10: // pinth
+				case 14: // pcpyld
+				case 18: // pand
+				case 19: // pxor
+				case 26: // pexeh
+				case 27: // prevh
+				case 30: // pexew
+				case 31: // prot3w
+					recpropSetWrite128(_Rd_);
+					recpropSetRead128(_Rs_);
+					recpropSetRead128(_Rt_);
+					break;
+
+				case 8: // pmfhi
+					recpropSetWrite128(_Rd_);
+					recpropSetRead128(XMMGPR_HI);
+					break;
+				case 9: // pmflo
+					recpropSetWrite128(_Rd_);
+					recpropSetRead128(XMMGPR_LO);
+					break;
+
+				case 0: // pmaddw
+				case 4: // pmsubw
+				case 12: // pmultw
+				case 16: // pmaddh
+				case 17: // phmadh
+				case 20: // pmsubh
+				case 21: // phmsbh
+				case 28: // pmulth
+					// hi/lo updates are kept live rather than modelled
+					recpropSetWrite128(_Rd_);
+					recpropSetRead128(_Rs_);
+					recpropSetRead128(_Rt_);
+					recpropSetRead128(XMMGPR_LO);
+					recpropSetRead128(XMMGPR_HI);
+					break;
+
+				case 13: // pdivw
+				case 29: // pdivbw
+					// no rd write, results go to hi/lo only
+					recpropSetRead128(_Rs_);
+					recpropSetRead128(_Rt_);
+					recpropSetRead128(XMMGPR_LO);
+					recpropSetRead128(XMMGPR_HI);
+					break;
+
+				default:
+					recpropClear(prev);
+					break;
+			}
+			break;
+
+		case 41: // mmi3
+			switch(_Sa_) {
+				case 3: // psravw
+				case 10: // pinteh
+				case 14: // pcpyud
+				case 18: // por
+				case 19: // pnor
+				case 26: // pexch
+				case 27: // pcpyh
+				case 30: // pexcw
+					recpropSetWrite128(_Rd_);
+					recpropSetRead128(_Rs_);
+					recpropSetRead128(_Rt_);
+					break;
+
+				case 8: // pmthi
+					recpropSetWrite128(XMMGPR_HI);
+					recpropSetRead128(_Rs_);
+					break;
+				case 9: // pmtlo
+					recpropSetWrite128(XMMGPR_LO);
+					recpropSetRead128(_Rs_);
+					break;
+
+				case 0: // pmadduw
+				case 12: // pmultuw
+					recpropSetWrite128(_Rd_);
+					recpropSetRead128(_Rs_);
+					recpropSetRead128(_Rt_);
+					recpropSetRead128(XMMGPR_LO);
+					recpropSetRead128(XMMGPR_HI);
+					break;
+
+				case 13: // pdivuw
+					recpropSetRead128(_Rs_);
+					recpropSetRead128(_Rt_);
+					recpropSetRead128(XMMGPR_LO);
+					recpropSetRead128(XMMGPR_HI);
+					break;
+
+				default:
+					recpropClear(prev);
+					break;
+			}
+			break;
+
+		case 16: // mfhi1
+			recpropSetWrite(_Rd_);
+			recpropSetRead128(XMMGPR_HI);
+			break;
+		case 18: // mflo1
+			recpropSetWrite(_Rd_);
+			recpropSetRead128(XMMGPR_LO);
+			break;
+		case 17: // mthi1
+			// only replaces the upper half of hi: treated as a use so the
+			// lower half stays live
+			recpropSetRead128(XMMGPR_HI);
+			recpropSetRead(_Rs_);
+			break;
+		case 19: // mtlo1
+			recpropSetRead128(XMMGPR_LO);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 24: // mult1
+		case 25: // multu1
+			// writes the pipeline 1 (upper) halves of hi/lo only
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			recpropSetRead128(XMMGPR_LO);
+			recpropSetRead128(XMMGPR_HI);
+			break;
+		case 26: // div1
+		case 27: // divu1
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			recpropSetRead128(XMMGPR_LO);
+			recpropSetRead128(XMMGPR_HI);
+			break;
+		case 32: // madd1
+		case 33: // maddu1
+			recpropSetWrite(_Rd_);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			recpropSetRead128(XMMGPR_LO);
+			recpropSetRead128(XMMGPR_HI);
+			break;
+
+		case 48: // pmfhl
+			recpropSetWrite128(_Rd_);
+			recpropSetRead128(XMMGPR_HI);
+			recpropSetRead128(XMMGPR_LO);
+			break;
+		case 49: // pmthl
+			// partial hi/lo update, keep both live
+			recpropSetRead128(_Rs_);
+			recpropSetRead128(XMMGPR_HI);
+			recpropSetRead128(XMMGPR_LO);
+			break;
+
+		case 52: // psllh
+		case 54: // psrlh
+		case 55: // psrah
+		case 60: // psllw
+		case 62: // psrlw
+		case 63: // psraw
+			recpropSetWrite128(_Rd_);
+			recpropSetRead128(_Rt_);
+			break;
+
+		default:
+			recpropClear(prev);
+			break;
+	}
+}
+
+//SPECIAL, REGIMM, J   , JAL  , BEQ , BNE , BLEZ , BGTZ ,
+//ADDI   , ADDIU , SLTI, SLTIU, ANDI, ORI , XORI , LUI  ,
+//COP0   , COP1  , COP2, NULL , BEQL, BNEL, BLEZL, BGTZL,
+//DADDI  , DADDIU, LDL , LDR  , MMI , NULL, LQ   , SQ   ,
+//LB     , LH    , LWL , LW   , LBU , LHU , LWR  , LWU  ,
+//SB     , SH    , SWL , SW   , SDL , SDR , SWR  , CACHE,
+//NULL   , LWC1  , NULL, PREF , NULL, NULL, LQC2 , LD   ,
+//NULL   , SWC1  , NULL, NULL , NULL, NULL, SQC2 , SD
+static void recpropBSC(EEINST* prev, EEINST* pinst)
+{
+	switch(cpuRegs.code >> 26) {
+		case 0: recpropSPECIAL(prev, pinst); break;
+		case 1: recpropREGIMM(prev, pinst); break;
+		case 2: // j
+			break;
+		case 3: // jal
+			recpropSetWrite(31);
+			break;
+		case 4: // beq
+		case 5: // bne
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+		case 6: // blez
+		case 7: // bgtz
+			recpropSetRead(_Rs_);
+			break;
+
+		case 8: // addi
+		case 9: // addiu
+		case 10: // slti
+		case 11: // sltiu
+		case 12: // andi
+		case 13: // ori
+		case 14: // xori
+		case 24: // daddi
+		case 25: // daddiu
+			recpropSetWrite(_Rt_);
+			recpropSetRead(_Rs_);
+			break;
+		case 15: // lui
+			recpropSetWrite(_Rt_);
+			break;
+
+		case 16: recpropCP0(prev, pinst); break;
+		case 17: recpropCP1(prev, pinst); break;
+		case 18: recpropCP2(prev, pinst); break;
+
+		case 20: // beql
+		case 21: // bnel
+			recpropLikely(prev, pinst);
+			recpropSetRead(_Rs_);
+			recpropSetRead(_Rt_);
+			break;
+		case 22: // blezl
+		case 23: // bgtzl
+			recpropLikely(prev, pinst);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 26: // ldl
+		case 27: // ldr
+		case 34: // lwl
+		case 38: // lwr
+			// merges with the old contents of rt
+			recpropSetWrite(_Rt_);
+			recpropSetRead(_Rt_);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 28: recpropMMI(prev, pinst); break;
+
+		case 30: // lq
+			recpropSetWrite128(_Rt_);
+			recpropSetRead(_Rs_);
+			break;
+		case 31: // sq
+			recpropSetRead128(_Rt_);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 32: // lb
+		case 33: // lh
+		case 35: // lw
+		case 36: // lbu
+		case 37: // lhu
+		case 39: // lwu
+		case 55: // ld
+			recpropSetWrite(_Rt_);
+			recpropSetRead(_Rs_);
+			break;
+
+		// stores
+		case 40: case 41: case 42: case 43:
+		case 44: case 45: case 46: case 63:
+			recpropSetRead(_Rt_);
+			recpropSetRead(_Rs_);
+			break;
+
+		case 47: // cache
+		case 51: // pref
+			recpropSetRead(_Rs_);
+			break;
+
+		case 49: // lwc1
+		case 57: // swc1
+		case 54: // lqc2
+		case 62: // sqc2
+			// cop1/cop2 register file untouched in gpr space
+			recpropSetRead(_Rs_);
+			break;
+
+		default:
+			recpropClear(prev);
+			break;
+	}
+}
+
 // defined at AppCoreThread.cpp but unclean and should not be public. We're the only
 // consumers of it, so it's declared only here.
 void LoadAllPatchesAndStuff(const Pcsx2Config&);
@@ -1607,6 +2812,13 @@ static void __fastcall recRecompile( const u32 startpc )
 
 	pxAssert( startpc );
 
+	if (s_recCacheLoadPending) {
+		// Deferred from the ELF entry point block: prime the code cache from disk before
+		// compiling the block we were actually asked for.
+		s_recCacheLoadPending = false;
+		recCachePrime(HWADDR(startpc));
+	}
+
 	// if recPtr reached the mem limit reset whole mem
 	if (recPtr >= (recMem->GetPtrEnd() - _64kb)) {
 		eeRecNeedsReset = true;
@@ -1618,6 +2830,9 @@ static void __fastcall recRecompile( const u32 startpc )
 
 	if (eeRecNeedsReset) recResetRaw();
 
+	// Compile-time COP2 fused-run state must not leak across blocks.
+	mVUmacroReset();
+
 	xSetPtr( recPtr );
 	recPtr = xGetAlignedCallTarget();
 
@@ -1686,11 +2901,47 @@ static void __fastcall recRecompile( const u32 startpc )
 		// Apply patch as soon as possible. Normally it is done in
 		// eeGameStarting but first block is already compiled.
 		doPlace0Patches();
+
+		// The CRC is valid from here on; seed the code cache from the previous run on
+		// the next compile so the cold-boot stutter happens once instead of per block.
+		s_recCacheLoadPending = true;
+		s_recCacheSavedCount = 0;
 	}
 
+	// Region execution policies from the game database: a block starting in an
+	// interpreted range compiles to a stub that hands the whole range to the
+	// interpreter, so one fragile function no longer needs a gamefix that turns
+	// the recompiler off for the entire game.  The stub bakes in no code bytes,
+	// so it needs no page protection; the interpreter always reads live memory.
+	if (eeHasExecPolicyRanges())
+	{
+		u32 range_start, range_end;
+
+		if (eeExecPolicyAt(startpc, &range_start, &range_end) == EEExec_Interpret)
+		{
+			xMOV(ptr32[&cpuRegs.pc], startpc);
+			xFastCall((void*)intExecuteRange, range_start, range_end);
+			xJMP((void*)DispatcherReg);
+
+			s_pCurBlockEx->size = 1;
+			s_pCurBlockEx->srcHash = recCacheHashSource(s_pCurBlockEx->startpc, s_pCurBlockEx->size);
+			s_pCurBlockEx->x86size = xGetPtr() - recPtr;
+			s_pCurBlock->SetFnptr((uptr)recPtr);
+			recPtr = xGetPtr();
+			s_pCurBlock = NULL;
+			s_pCurBlockEx = NULL;
+			return;
+		}
+
+		s_policy_sync = eeExecPolicyAt(startpc) == EEExec_SyncRec;
+	}
+	else
+		s_policy_sync = false;
+
 	g_branch = 0;
 
 	// reset recomp state variables
+	s_loop_site = NULL;
 	s_nBlockCycles = 0;
 	pc = startpc;
 	g_cpuHasConstReg = g_cpuFlushedConstReg = 1;
@@ -1716,6 +2967,11 @@ static void __fastcall recRecompile( const u32 startpc )
 	s_nEndBlock = 0xffffffff;
 	s_branchTo = -1;
 
+	// Never scan across a policy range boundary: fallthrough into (or out of)
+	// a policed range must go through the dispatcher so the range's own block
+	// gets control.
+	const u32 policy_clamp = eeHasExecPolicyRanges() ? eeNextExecPolicyBoundary(startpc) : 0xffffffff;
+
 	// compile breakpoints as individual blocks
 	int n1 = isBreakpointNeeded(i);
 	int n2 = isMemcheckNeeded(i);
@@ -1745,6 +3001,13 @@ static void __fastcall recRecompile( const u32 startpc )
 				break;
 			}
 
+			if( i == policy_clamp )	// breaks blocks at execution policy boundaries
+			{
+				willbranch3 = 1;
+				s_nEndBlock = i;
+				break;
+			}
+
 			if (pblock->GetFnptr() != (uptr)JITCompile && pblock->GetFnptr() != (uptr)JITCompileInBlock)
 			{
 				willbranch3 = 1;
@@ -1830,7 +3093,7 @@ StartRecomp:
 	// without a significant loss in cycle accuracy is with a division, but games would probably
 	// be happy with time wasting loops completing in 0 cycles and timeouts waiting forever.
 	s_nBlockFF = false;
-	if (s_branchTo == startpc) {
+	if (s_branchTo == startpc && !s_policy_sync) {
 		s_nBlockFF = true;
 
 		u32 reads = 0, loads = 1;
@@ -1900,6 +3163,48 @@ StartRecomp:
 		}
 	}
 
+	// Static classification for the hoisted event check (see LoopSite): a self
+	// loop qualifies when every instruction is plain register compute.  Loads
+	// and stores are out because a hardware access mid-burst would observe a
+	// stale cpuRegs.cycle (and could schedule events we wouldn't test for);
+	// COP0 is out for the same reason (MFC0 Count), COP2 because macro ops
+	// sync against VU0.  Idle loops already covered by the FF wait-loop hack
+	// keep that handling, it skips the iterations entirely.
+	if (s_branchTo == startpc && !s_policy_sync && !(s_nBlockFF && EmuConfig.Speedhacks.WaitLoop)
+		&& s_loop_count < LOOP_SITE_COUNT)
+	{
+		bool pure = true;
+
+		for (i = startpc; pure && i < s_nEndBlock; i += 4) {
+			cpuRegs.code = *(u32*)PSM(i);
+			if (cpuRegs.code == 0)
+				continue;
+			switch (_Opcode_) {
+				case 000: // special: ALU, shifts, mult/div, hi/lo moves; no jumps, syscall/break or traps
+					pure = _Funct_ != 010 && _Funct_ != 011 && _Funct_ != 014
+						&& _Funct_ != 015 && (_Funct_ & 070) != 060;
+					break;
+				case 001: // regimm: branches only, no traps or MTSA
+					pure = _Rt_ < 4 || (_Rt_ >= 16 && _Rt_ < 20);
+					break;
+				case 002:                               // j
+				case 004: case 005: case 006: case 007: // beq, bne, blez, bgtz
+				case 024: case 025: case 026: case 027: // and the likely forms
+				case 021:                               // cop1 moves, compares and arithmetic
+				case 034:                               // mmi arithmetic
+					break;
+				default: // imm arithmetic; anything touching memory, cop0 or cop2 disqualifies
+					pure = (_Opcode_ & 070) == 010 || (_Opcode_ & 076) == 030;
+					break;
+			}
+		}
+
+		if (pure) {
+			s_loop_site = &s_loop_sites[s_loop_count++];
+			s_loop_site->cycles = 1; // safe divisor until the back edge fills it in
+		}
+	}
+
 	// rec info //
 	{
 		EEINST* pcur;
@@ -1918,6 +3223,7 @@ StartRecomp:
 		for(i = s_nEndBlock; i > startpc; i -= 4 ) {
 			cpuRegs.code = *(int *)PSM(i-4);
 			pcur[-1] = pcur[0];
+			recpropBSC(pcur-1, pcur);
 			pcur--;
 		}
 	}
@@ -1965,6 +3271,27 @@ StartRecomp:
 	// Skip Recompilation if sceMpegIsEnd Pattern detected
 	bool doRecompilation = !skipMPEG_By_Pattern(startpc);
 
+	// Burst prologue for hoisted loops: grant as many iterations as fit before
+	// the next scheduled event (at least one, so an overdue event still gets
+	// tested after a single pass).  Every external entry lands here, so the
+	// counter is always fresh when the back edge starts counting it down.
+	if (s_loop_site)
+	{
+		xMOV(eax, ptr32[&g_nextEventCycle]);
+		xSUB(eax, ptr32[&cpuRegs.cycle]);
+		xMOV(ecx, 1);
+		xCMP(eax, ecx);
+		xCMOVL(eax, ecx);
+		xXOR(edx, edx);
+		xUDIV(ptr32[&s_loop_site->cycles]);
+		xCMP(eax, ecx);
+		xCMOVL(eax, ecx);
+		xMOV(ptr32[&s_loop_site->init], eax);
+		xMOV(ptr32[&s_loop_site->counter], eax);
+
+		s_loop_top = xGetPtr();
+	}
+
 	if (doRecompilation) {
 		// Finally: Generate x86 recompiled code!
 		g_pCurInstInfo = s_pInstCache;
@@ -2002,6 +3329,9 @@ StartRecomp:
 		memcpy(&recRAMCopy[HWADDR(startpc) / 4], PSM(startpc), pc - startpc);
 	}
 
+	s_pCurBlockEx->srcHash = recCacheHashSource(s_pCurBlockEx->startpc, s_pCurBlockEx->size);
+	recContentNote(s_pCurBlockEx->startpc, s_pCurBlockEx->size, s_pCurBlockEx->srcHash);
+
 	s_pCurBlock->SetFnptr((uptr)recPtr);
 
 	for(i = 1; i < (u32)s_pCurBlockEx->size; i++) {
@@ -2039,7 +3369,7 @@ StartRecomp:
 			// performance reasons.
 
 			int numinsts = (pc - startpc) / 4;
-			if( numinsts > 6 )
+			if( numinsts > 6 || s_policy_sync )
 				SetBranchImm(pc);
 			else
 			{
@@ -2062,6 +3392,25 @@ StartRecomp:
 
 	s_pCurBlock = NULL;
 	s_pCurBlockEx = NULL;
+
+	// Queue this block's static successors, then drain the queue from the outermost
+	// invocation only; nested calls just keep feeding it (bounded breadth-first walk).
+	recSpecEnqueue(s_branchTo);
+	recSpecEnqueue(pc);
+
+	if (!s_specDraining)
+	{
+		s_specDraining = true;
+
+		for (uint n = 0; n < s_specCount && !eeRecNeedsReset; n++)
+		{
+			if (PC_GETBLOCK(s_specQueue[n])->GetFnptr() == (uptr)JITCompile)
+				recRecompile(s_specQueue[n]);
+		}
+
+		s_specCount = 0;
+		s_specDraining = false;
+	}
 }
 
 // The only *safe* way to throw exceptions from the context of recompiled code.
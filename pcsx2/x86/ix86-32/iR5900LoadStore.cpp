@@ -93,12 +93,74 @@ using namespace Interpreter::OpcodeImpl;
 
 __aligned16 u32 dummyValue[4];
 
+// Returns a host pointer for compile-time reading when addr is an untranslated
+// (kseg0/kseg1 or low mirror) address inside one of the BIOS ROM regions.  ROM
+// contents cannot change after boot -- even writes aimed at them fall into the
+// null handler -- so a load through a constant ROM address can be folded into
+// the constant propagation outright.  TLB-mapped segments are left alone.
+static const void* _eeRomConstPtr(u32 addr, u32 bytes)
+{
+	if (addr >= 0x20000000 && (addr < 0x80000000 || addr >= 0xc0000000))
+		return NULL;
+
+	const u32 paddr = addr & 0x1fffffff;
+
+	if ((paddr >= 0x1fc00000 && paddr + bytes <= 0x1fc00000 + Ps2MemSize::Rom) ||
+		(paddr >= 0x1e000000 && paddr + bytes <= 0x1e000000 + Ps2MemSize::Rom1) ||
+		(paddr >= 0x1e400000 && paddr + bytes <= 0x1e400000 + Ps2MemSize::Rom2))
+	{
+		return PSM(paddr);
+	}
+
+	return NULL;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 //
 void recLoad64( u32 bits, bool sign )
 {
 	pxAssume( bits == 64 || bits == 128 );
 
+	if (bits == 64 && GPR_IS_CONST1(_Rs_))
+	{
+		u32 srcadr = g_cpuConstRegs[_Rs_].UL[0] + _Imm_;
+
+		if (const void* src = _eeRomConstPtr(srcadr, 8))
+		{
+			if (!_Rt_)
+				return;
+
+			_eeOnLoadWrite(_Rt_);
+			_deleteEEreg(_Rt_, 0);
+
+			GPR_SET_CONST(_Rt_);
+			g_cpuConstRegs[_Rt_].UD[0] = *(u64*)src;
+			return;
+		}
+	}
+
+	if (bits == 128 && GPR_IS_CONST1(_Rs_))
+	{
+		u32 srcadr = (g_cpuConstRegs[_Rs_].UL[0] + _Imm_) & ~0x0f;
+
+		if (void* src = vtlb_DynGenDirectPtr_Const(srcadr))
+		{
+			if (!_Rt_)
+				return;
+
+			// Direct-mapped quadword load: if the liveness info says later
+			// instructions want _Rt_ in xmm anyway, load it straight into its
+			// register and skip the bounce through the cpuRegs struct.
+			int rtreg = _allocCheckGPRtoXMM(g_pCurInstInfo, _Rt_, MODE_WRITE);
+			if (rtreg >= 0)
+			{
+				xMOVDQA(xRegisterSSE(rtreg), ptr[src]);
+				_clearNeededXMMregs();
+				return;
+			}
+		}
+	}
+
 	// Load arg2 with the destination.
 	// 64/128 bit modes load the result directly into the cpuRegs.GPR struct.
 
@@ -147,6 +209,30 @@ void recLoad32( u32 bits, bool sign )
 	{
 		u32 srcadr = g_cpuConstRegs[_Rs_].UL[0] + _Imm_;
 
+		if (const void* src = _eeRomConstPtr(srcadr, bits / 8))
+		{
+			if (!_Rt_)
+				return;
+
+			_eeOnLoadWrite(_Rt_);
+			_deleteEEreg(_Rt_, 0);
+
+			GPR_SET_CONST(_Rt_);
+			switch (bits)
+			{
+				case 8:
+					g_cpuConstRegs[_Rt_].UD[0] = sign ? (u64)(s64)*(s8*)src : (u64)*(u8*)src;
+					break;
+				case 16:
+					g_cpuConstRegs[_Rt_].UD[0] = sign ? (u64)(s64)*(s16*)src : (u64)*(u16*)src;
+					break;
+				case 32:
+					g_cpuConstRegs[_Rt_].UD[0] = sign ? (u64)(s64)*(s32*)src : (u64)*(u32*)src;
+					break;
+			}
+			return;
+		}
+
 		_eeOnLoadWrite(_Rt_);
 		_deleteEEreg(_Rt_, 0);
 
@@ -192,6 +278,25 @@ void recStore(u32 bits)
         // Load EDX first with the value being written, or the address of the value
         // being written (64/128 bit modes).
 
+        if (bits == 128 && GPR_IS_CONST1(_Rs_))
+        {
+                u32 dstadr = (g_cpuConstRegs[_Rs_].UL[0] + _Imm_) & ~0x0f;
+
+                if (void* dst = vtlb_DynGenDirectPtr_Const(dstadr))
+                {
+                        // If the quadword is already XMM-resident, store it from the
+                        // register directly; the generic path below would flush it to
+                        // cpuRegs first and then copy it back out through a temporary.
+                        int rtreg = _checkXMMreg(XMMTYPE_GPRREG, _Rt_, 0);
+                        if (rtreg >= 0)
+                        {
+                                xMOVDQA(ptr[dst], xRegisterSSE(rtreg));
+                                _clearNeededXMMregs();
+                                return;
+                        }
+                }
+        }
+
         if (bits < 64)
         {
                 _eeMoveGPRtoR(arg2regd, _Rt_);
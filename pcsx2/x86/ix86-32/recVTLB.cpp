@@ -256,11 +256,23 @@ static u8* GetIndirectDispatcherPtr( int mode, int operandsize, int sign = 0 )
 	// 7*64? 5 widths with two sign extension modes for 8 and 16 bit reads
 
 	// Gregory: a 32 bytes alignment is likely enough and more cache friendly
-	const int A = 32;
+	// (bumped back to 64 to make room for the xmm spill/reload calls)
+	const int A = 64;
 
 	return &m_IndirectDispatchers[(mode*(7*A)) + (sign*5*A) + (operandsize*A)];
 }
 
+// ------------------------------------------------------------------------
+// The indirect handlers are plain C++ functions and are free to clobber the
+// whole xmm register file, so the dispatchers spill it around the handler
+// call (see below).  The two naked spill/reload subroutines live in the same
+// executable page as the dispatchers, past the dispatcher slots.
+//
+static u8* GetXmmSpillerPtr( int restore )
+{
+	return &m_IndirectDispatchers[0x400 + (restore * 0x100)];
+}
+
 // ------------------------------------------------------------------------
 // Generates a JS instruction that targets the appropriate templated instance of
 // the vtlb Indirect Dispatcher.
@@ -290,6 +302,11 @@ static void DynGen_IndirectTlbDispatcher( int mode, int bits, bool sign )
 	if (wordsize != 8) xSUB( arg1regd, 0x80000000 );
 	xSUB( arg1regd, eax );
 
+	// The recompiler keeps its xmm register cache live across the direct
+	// path of a memory access, so the rarely-taken handler path has to
+	// preserve the file itself before handing control to C++ code.
+	xCALL( (void*)GetXmmSpillerPtr( 0 ) );
+
 	// jump to the indirect handler, which is a __fastcall C++ function.
 	// [ecx is address, edx is data]
 	sptr table = (sptr)vtlbdata.RWFT[bits][mode];
@@ -300,6 +317,8 @@ static void DynGen_IndirectTlbDispatcher( int mode, int bits, bool sign )
 		xFastCall(ptrNative[(rax*wordsize) + arg3reg], arg1reg, arg2reg);
 	}
 
+	xCALL( (void*)GetXmmSpillerPtr( 1 ) );
+
 	if (!mode)
 	{
 		if (bits == 0)
@@ -336,6 +355,23 @@ void vtlb_dynarec_init()
 	// clear the buffer to 0xcc (easier debugging).
 	memset( m_IndirectDispatchers, 0xcc, __pagesize);
 
+	// Generate the xmm spill/reload subroutines the dispatchers call around
+	// their handler invocation.  They're plain leaf functions (movdqa's and a
+	// ret), so they don't disturb the stack alignment set up by the caller.
+	for( int restore=0; restore<2; ++restore )
+	{
+		xSetPtr( GetXmmSpillerPtr( restore ) );
+
+		for( uint reg=0; reg<iREGCNT_XMM; ++reg )
+		{
+			if (restore)
+				xRestoreReg( xRegisterSSE( reg ) );
+			else
+				xStoreReg( xRegisterSSE( reg ) );
+		}
+		xRET();
+	}
+
 	for( int mode=0; mode<2; ++mode )
 	{
 		for( int bits=0; bits<5; ++bits )
@@ -394,6 +430,20 @@ void vtlb_DynGenRead32(u32 bits, bool sign)
 	vtlb_SetWriteback(writeback);
 }
 
+// ------------------------------------------------------------------------
+// Resolves a constant address to its host pointer when the page is direct-mapped,
+// or NULL when the access has to go through a handler.  Lets the load/store
+// recompiler keep 128 bit values XMM-resident instead of bouncing them through
+// the cpuRegs struct when the target is plain memory.  Same TLB assumption as
+// the other _Const generators: the recompiler is cleared on TLB changes.
+void* vtlb_DynGenDirectPtr_Const( u32 addr_const )
+{
+	auto vmv = vtlbdata.vmap[addr_const>>VTLB_PAGE_BITS];
+	if( vmv.isHandler(addr_const) )
+		return NULL;
+	return (void*)vmv.assumePtr(addr_const);
+}
+
 // ------------------------------------------------------------------------
 // TLB lookup is performed in const, with the assumption that the COP0/TLB will clear the
 // recompiler if the TLB is changed.
@@ -428,11 +478,30 @@ void vtlb_DynGenRead64_Const( u32 bits, u32 addr_const )
 			case 128:	szidx=4;	break;
 		}
 
-		iFlushCall(FLUSH_FULLVTLB);
+		// handler is called directly here (no dispatcher spill), so the xmm
+		// file really does need to be freed, not just written back.
+		iFlushCall(FLUSH_NOCONST);
 		xFastCall( vmv.assumeHandlerGetRaw(szidx, 0), paddr, arg2reg );
 	}
 }
 
+// ------------------------------------------------------------------------
+// Returns true when a read of the given hardware register address is trivially
+// decoded -- the handler chain bottoms out at the psHu backing store with no
+// side effects, so the recompiler can load it inline.  Pages 0x08-0x0e of the
+// HW map (the DMA channel registers plus the DMAC/INTC control block) qualify:
+// _hwRead32 has no case for them and falls straight through to psHu32.  The
+// one exception is the VIF FIFO game fix, which synthesizes a QWC-adjusted
+// value for reads of D1_CHCR+0x10, so that word stays on the handler path.
+//
+static bool hwConstRead_IsDirect( u32 paddr )
+{
+	if( (paddr < D0_CHCR) || (paddr >= 0x1000f000) )
+		return false;
+
+	return (paddr & ~0x03) != (D1_CHCR + 0x10);
+}
+
 // ------------------------------------------------------------------------
 // Recompiled input registers:
 //   ecx - source address to read from
@@ -486,9 +555,34 @@ void vtlb_DynGenRead32_Const( u32 bits, bool sign, u32 addr_const )
 		{
 			xMOV( eax, ptr[&psHu32( INTC_STAT )] );
 		}
+		else if( hwConstRead_IsDirect( paddr ) )
+		{
+			// Trivially-decoded hardware register (DMA channel status polls and
+			// the like): skip the handler chain and read the backing store.
+			switch( bits )
+			{
+				case 8:
+					if( sign )
+						xMOVSX( eax, ptr8[&psHu8( paddr )] );
+					else
+						xMOVZX( eax, ptr8[&psHu8( paddr )] );
+				break;
+
+				case 16:
+					if( sign )
+						xMOVSX( eax, ptr16[&psHu16( paddr )] );
+					else
+						xMOVZX( eax, ptr16[&psHu16( paddr )] );
+				break;
+
+				case 32:
+					xMOV( eax, ptr32[&psHu32( paddr )] );
+				break;
+			}
+		}
 		else
 		{
-			iFlushCall(FLUSH_FULLVTLB);
+			iFlushCall(FLUSH_NOCONST);
 			xFastCall( vmv.assumeHandlerGetRaw(szidx, false), paddr );
 
 			// perform sign extension on the result:
@@ -578,7 +672,7 @@ void vtlb_DynGenWrite_Const( u32 bits, u32 addr_const )
 			case 128:   szidx=4; break;
 		}
 
-		iFlushCall(FLUSH_FULLVTLB);
+		iFlushCall(FLUSH_NOCONST);
 		xFastCall( vmv.assumeHandlerGetRaw(szidx, true), paddr, arg2reg );
 	}
 }
@@ -17,6 +17,7 @@
 
 #include "PrecompiledHeader.h"
 #include "microVU.h"
+#include "PerfStats.h"
 
 
 //------------------------------------------------------------------
@@ -60,6 +61,7 @@ void mVUinit(microVU& mVU, uint vuIndex) {
 	mVU.dispCache		= NULL;
 	mVU.startFunct		= NULL;
 	mVU.exitFunct		= NULL;
+	mVU.tierFullOpt		= 0;
 
 	mVUreserveCache(mVU);
 
@@ -99,6 +101,8 @@ void mVUreset(microVU& mVU, bool resetReserve) {
 	mVU.prog.isSame		= -1;
 	mVU.prog.cur		= NULL;
 	mVU.prog.total		=  0;
+	mVU.prog.count		=  0;
+	mVU.prog.lruClock	=  0;
 	mVU.prog.curFrame	=  0;
 
 	// Setup Dynarec Cache Limits for Each Program
@@ -170,13 +174,58 @@ __ri void mVUdeleteProg(microVU& mVU, microProgram*& prog) {
 	safe_aligned_free(prog);
 }
 
+// Evicts the least-recently-executed programs once the resident population
+// exceeds mVUprogBudget. Only the program metadata (block managers, program
+// image) is reclaimed -- emitted code stays in the bump arena until the next
+// cache reset -- but a bounded population keeps program searches short and
+// keeps the teardown cost of that reset from growing without limit on titles
+// that stream many microprograms.
+__ri void mVUevictProgs(microVU& mVU) {
+	while (mVU.prog.count >= (int)mVUprogBudget) {
+		microProgram* victim = NULL;
+		u32 victimPC = 0;
+		u32 oldest   = 0xffffffff;
+		for (u32 i = 0; i < (mVU.progSize / 2); i++) {
+			microProgramList* list = mVU.prog.prog[i];
+			if (!list) continue;
+			std::deque<microProgram*>::iterator it(list->begin());
+			for ( ; it != list->end(); ++it) {
+				microProgram* p = it[0];
+				// The running program and the one the quick reference points
+				// to can still be entered without a search; leave them alone.
+				if ((p == mVU.prog.cur) || (p == mVU.prog.quick[i].prog)) continue;
+				if (p->lastUse < oldest) {
+					oldest   = p->lastUse;
+					victim   = p;
+					victimPC = i;
+				}
+			}
+		}
+		if (!victim) return; // everything resident is pinned
+		microProgramList* list = mVU.prog.prog[victimPC];
+		std::deque<microProgram*>::iterator it(list->begin());
+		for ( ; it != list->end(); ++it) {
+			if (it[0] == victim) { list->erase(it); break; }
+		}
+#ifndef NDEBUG
+		log_cb(RETRO_LOG_DEBUG, "microVU%d: Evicted Prog = [%03d] [PC=%04x] (%d resident)\n",
+					   mVU.index, victim->idx, victimPC*8, mVU.prog.count - 1);
+#endif
+		mVUdeleteProg(mVU, victim);
+		mVU.prog.count--;
+	}
+}
+
 // Creates a new Micro Program
 __ri microProgram* mVUcreateProg(microVU& mVU, int startPC) {
+	mVUevictProgs(mVU);
 	microProgram* prog = (microProgram*)_aligned_malloc(sizeof(microProgram), 64);
 	memset(prog, 0, sizeof(microProgram));
 	prog->idx     = mVU.prog.total++;
+	prog->lastUse = ++mVU.prog.lruClock;
 	prog->ranges  = new std::deque<microRange>();
 	prog->startPC = startPC;
+	mVU.prog.count++;
 	mVUcacheProg(mVU, *prog); // Cache Micro Program
 #ifndef NDEBUG
 	double cacheSize = (double)((uptr)mVU.prog.x86end - (uptr)mVU.prog.x86start);
@@ -273,6 +322,7 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState) {
 			if (b) {
 				quick.block = it[0]->block[startPC/8];
 				quick.prog  = it[0];
+				quick.prog->lastUse = ++mVU.prog.lruClock;
 				list->erase(it);
 				list->push_front(quick.prog);
 				// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
@@ -300,6 +350,7 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState) {
 	// If list.quick, then we've already found and recompiled the program ;)
 	mVU.prog.isSame = -1;
 	mVU.prog.cur = quick.prog;
+	mVU.prog.cur->lastUse = ++mVU.prog.lruClock;
 	// Because the VU's can now run in sections and not whole programs at once
 	// we need to set the current block so it gets the right program back
 	quick.block = mVU.prog.cur->block[startPC / 8];
@@ -369,7 +420,10 @@ void recMicroVU0::Execute(u32 cycles) {
 	// Sometimes games spin on vu0, so be careful with this value
 	// woody hangs if too high on sVU (untested on mVU)
 	// Edit: Need to test this again, if anyone ever has a "Woody" game :p
-	((mVUrecCall)microVU0.startFunct)(VU0.VI[REG_TPC].UL, cycles);
+	{
+		PerfStats::Scope scope(Subsys_VU);
+		((mVUrecCall)microVU0.startFunct)(VU0.VI[REG_TPC].UL, cycles);
+	}
 	VU0.VI[REG_TPC].UL >>= 3;
 	if(microVU0.regs().flags & 0x4)
 	{
@@ -390,7 +444,10 @@ void recMicroVU1::Execute(u32 cycles) {
 		if(!(VU0.VI[REG_VPU_STAT].UL & 0x100)) return;
 	}
 	VU1.VI[REG_TPC].UL <<= 3;
-	((mVUrecCall)microVU1.startFunct)(VU1.VI[REG_TPC].UL, cycles);
+	{
+		PerfStats::Scope scope(Subsys_VU);
+		((mVUrecCall)microVU1.startFunct)(VU1.VI[REG_TPC].UL, cycles);
+	}
 	VU1.VI[REG_TPC].UL >>= 3;
 	if(microVU1.regs().flags & 0x4)
 	{
@@ -92,6 +92,13 @@ public:
 			memcpy(&newBlock->block, pBlock, sizeof(microBlock));
 			thisBlock =  &newBlock->block;
 		}
+		else if (pBlock->fullOpt && !thisBlock->fullOpt) {
+			// Tier promotion: repoint the existing entry at the code about to be
+			// emitted. Stale links into the old baseline code stay valid; only new
+			// entries through the dispatcher pick up the optimized version.
+			thisBlock->x86ptrStart = pBlock->x86ptrStart;
+			thisBlock->fullOpt     = 1;
+		}
 		return thisBlock;
 	}
 	__ri microBlock* search(microRegInfo* pState) {
@@ -145,6 +152,7 @@ struct microProgram {
 	std::deque<microRange>* ranges;			   // The ranges of the microProgram that have already been recompiled
 	u32 startPC; // Start PC of this program
 	int idx;	 // Program index
+	u32 lastUse; // Eviction clock value at last execution (LRU ranking, see mVUevictProgs)
 };
 
 typedef std::deque<microProgram*> microProgramList;
@@ -160,6 +168,8 @@ struct microProgManager {
 	microProgramQuick	quick[mProgSize/2];	// Quick reference to valid microPrograms for current execution
 	microProgram*		cur;				// Pointer to currently running MicroProgram
 	int					total;				// Total Number of valid MicroPrograms
+	int					count;				// Number of currently resident MicroPrograms
+	u32					lruClock;			// Monotonic use counter driving LRU eviction
 	int					isSame;				// Current cached microProgram is Exact Same program as mVU.regs().Micro (-1 = unknown, 0 = No, 1 = Yes)
 	int					cleared;			// Micro Program is Indeterminate so must be searched for (and if no matches are found then recompile a new one)
 	u32					curFrame;			// Frame Counter
@@ -172,6 +182,7 @@ struct microProgManager {
 static const uint mVUdispCacheSize	= __pagesize; // Dispatcher Cache Size (in bytes)
 static const uint mVUcacheSafeZone	= 3;		  // Safe-Zone for program recompilation (in megabytes)
 static const uint mVUcacheReserve = 64; // mVU0, mVU1 Reserve Cache Size (in megabytes)
+static const uint mVUprogBudget   = 512; // Max resident microPrograms per VU before cold ones are evicted
 
 struct microVU {
 
@@ -201,6 +212,7 @@ struct microVU {
 	u8*		exitFunctXG;  // Function Ptr to the recompiler dispatcher (xgkick exit)
 	u8*		resumePtrXG;  // Ptr to recompiled code position to resume xgkick
 	u32		code;		  // Contains the current Instruction
+	u32		tierFullOpt;  // Current compilation emits the promoted (fully analyzed) tier
 	u32		divFlag;	  // 1 instance of I/D flags
 	u32		VIbackup;	  // Holds a backup of a VI reg if modified before a branch
 	u32		VIxgkick;	  // Holds a backup of a VI reg used for xgkick-delays
@@ -243,6 +255,7 @@ mVUop(mVUopL);
 // Private Functions
 extern void  mVUcacheProg (microVU& mVU, microProgram&  prog);
 extern void  mVUdeleteProg(microVU& mVU, microProgram*& prog);
+extern void  mVUevictProgs(microVU& mVU);
 _mVUt extern void* mVUsearchProg(u32 startPC, uptr pState);
 extern void* __fastcall mVUexecuteVU0(u32 startPC, u32 cycles);
 extern void* __fastcall mVUexecuteVU1(u32 startPC, u32 cycles);
@@ -439,6 +439,8 @@ __fi void mVUinitFirstPass(microVU& mVU, uptr pState, u8* thisPtr) {
 		memcpy((u8*)&mVU.prog.lpState, (u8*)pState, sizeof(microRegInfo));
 	}
 	mVUblock.x86ptrStart	= thisPtr;
+	mVUblock.execCount		= 0;
+	mVUblock.fullOpt		= doTieredComp ? mVU.tierFullOpt : 1;
 	mVUpBlock				= mVUblocks[mVUstartPC/2]->add(&mVUblock); // Add this block to block manager
 	mVUregs.needExactMatch	= (mVUpBlock->pState.blockType)?7:0; // ToDo: Fix 1-Op block flag linking (MGS2:Demo/Sly Cooper)
 	mVUregs.blockType		= 0;
@@ -663,6 +665,11 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 	mVUsetFlags(mVU, mFC);           // Sets Up Flag instances
 	mVUoptimizePipeState(mVU);       // Optimize the End Pipeline State for nicer Block Linking
 	mVUdebugPrintBlocks(mVU, false); // Prints Start/End PC of blocks executed, for debugging...
+
+	// Baseline-tier blocks count their executions so mVUentryGet() knows when to promote
+	if (doTieredComp && !mVU.tierFullOpt)
+		xADD(ptr32[&mVUpBlock->execCount], 1);
+
 	mVUtestCycles(mVU, mFC);              // Update VU Cycles and Exit Early if Necessary
 
 	// Second Pass
@@ -778,7 +785,18 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 // Returns the entry point of the block (compiles it if not found)
 __fi void* mVUentryGet(microVU& mVU, microBlockManager* block, u32 startPC, uptr pState) {
 	microBlock* pBlock = block->search((microRegInfo*)pState);
-	if (pBlock) return pBlock->x86ptrStart;
+	if (pBlock) {
+		if (doTieredComp && !pBlock->fullOpt && pBlock->execCount >= mVUtierHotCount) {
+			// Hot baseline block: recompile it (and the blocks it links to) with the
+			// full flag analysis. Promotion happens on the fetch path rather than on
+			// a separate thread; a fetch is already a compile boundary.
+			mVU.tierFullOpt = 1;
+			void* thisPtr = mVUcompile(mVU, startPC, pState);
+			mVU.tierFullOpt = 0;
+			return thisPtr;
+		}
+		return pBlock->x86ptrStart;
+	}
 	else	 {  return mVUcompile(mVU, startPC, pState);}
 }
 
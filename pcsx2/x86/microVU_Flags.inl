@@ -156,7 +156,7 @@ __fi void mVUsetFlags(mV, microFlagCycles& mFC) {
 	u32 xCount	= mVUcount; // Backup count
 	iPC			= mVUstartPC;
 	for(mVUcount = 0; mVUcount < xCount; mVUcount++) {
-		if (mVUlow.isFSSET && !noFlagOpts) {
+		if (mVUlow.isFSSET && !mVUflagOptsOff(mVU)) {
 			if (__Status) { // Don't Optimize out on the last ~4+ instructions
 				if ((xCount - mVUcount) > aCount) { mVUstatusFlagOp(mVU); }
 			}
@@ -181,7 +181,7 @@ __fi void mVUsetFlags(mV, microFlagCycles& mFC) {
 		}
 
 		if (sFLAG.doFlag) {
-			if(noFlagOpts) {
+			if(mVUflagOptsOff(mVU)) {
 				sFLAG.doNonSticky = true;
 				mFLAG.doFlag = true;
 			}
@@ -335,7 +335,7 @@ void mVUflagPass(mV, u32 startPC, u32 sCount = 0, u32 found = 0) {
 
 // Checks if the first ~4 instructions of a block will read flags
 void mVUsetFlagInfo(mV) {
-	if (noFlagOpts) {
+	if (mVUflagOptsOff(mVU)) {
 		mVUregs.needExactMatch  = 0x7;
 		mVUregs.flagInfo		= 0x0;
 		return;
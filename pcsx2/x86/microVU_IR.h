@@ -75,6 +75,8 @@ struct __aligned16 microBlock {
 	microRegInfo	pStateEnd;	 // Detailed State of Pipeline at End of Block (needed by JR/JALR opcodes)
 	u8*				x86ptrStart; // Start of code (Entry point for block)
 	microJumpCache* jumpCache;	 // Will point to an array of entry points of size [16k/8] if block ends in JR/JALR
+	u32				execCount;	 // Baseline-tier execution counter (incremented by the emitted code)
+	u32				fullOpt;	 // Block was compiled with full flag analysis (promoted tier)
 };
 
 struct microTempRegInfo {
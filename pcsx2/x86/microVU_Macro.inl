@@ -28,14 +28,91 @@ using namespace R5900::Dynarec;
 
 #define printCOP2(...) (void)0
 
+// COP2 macro-op fusion: consecutive COP2 macro instructions are compiled as one
+// fused run.  The first op of a run flushes the EE state and denormalizes the
+// VU0 status flags into gprF0; subsequent ops inherit that context, skipping
+// the per-instruction flush/normalize/write-back round trips.  The run is
+// closed by mVUmacroClose() as soon as the recompiler reaches an instruction
+// that doesn't fuse (see recompileNextInstruction), or from iFlushCall() when
+// a branch or call path ends the block with a run still open.
+bool g_cop2MacroRunOpen = false;
+static bool cop2MacroFlagsLive  = false; // status flags are denormalized in gprF0
+static bool cop2MacroFlagsDirty = false; // flag instances need re-broadcast on close
+
+// Transfer bursts: consecutive non-interlocked COP2 transfers (the standard
+// matrix-upload idiom, four QMTC2s back to back) used to re-emit the VU0
+// activity guard for every register.  The first transfer of a straight-line
+// run keeps the guard and runs VU0 up to date; its immediate successors skip
+// it, since the couple of EE cycles that accrue between them are well inside
+// the 8-cycle tolerance the guard applies anyway.  A mid-run jump target is
+// recompiled as its own block (marker reset below), so a skipping transfer
+// can only ever execute behind its guarded predecessor.
+static u32 cop2TransferRunEnd = 0;
+
+// Discards fused-run state without emitting code (used when starting a fresh block).
+void mVUmacroReset() {
+	g_cop2MacroRunOpen  = false;
+	cop2MacroFlagsLive  = false;
+	cop2MacroFlagsDirty = false;
+	cop2TransferRunEnd  = 0;
+	microVU0.regAlloc->reset();
+}
+
+// Closes the current fused run: normalizes the live status flags back into
+// VI[REG_STATUS_FLAG], writes back all cached VF regs, and re-broadcasts the
+// micro status/mac flag instances so micro programs see the current state.
+void mVUmacroClose() {
+	if (!g_cop2MacroRunOpen) return;
+	g_cop2MacroRunOpen = false;
+	if (cop2MacroFlagsLive) {
+		cop2MacroFlagsLive = false;
+		// Normalize
+		mVUallocSFLAGc(eax, gprF0, 0);
+		xMOV(ptr32[&vu0Regs.VI[REG_STATUS_FLAG].UL], eax);
+	}
+	microVU0.regAlloc->flushAll();
+
+	if (cop2MacroFlagsDirty) { // Update VU0 Status/Mac instances after flush to avoid corrupting anything
+		cop2MacroFlagsDirty = false;
+		mVUallocSFLAGd(&vu0Regs.VI[REG_STATUS_FLAG].UL);
+		xMOVDZX(xmmT1, eax);
+		xSHUF.PS(xmmT1, xmmT1, 0);
+		xMOVAPS(ptr128[&microVU0.regs().micro_statusflags], xmmT1);
+
+		xMOVDZX(xmmT1, ptr32[&vu0Regs.VI[REG_MAC_FLAG].UL]);
+		xSHUF.PS(xmmT1, xmmT1, 0);
+		xMOVAPS(ptr128[&microVU0.regs().micro_macflags], xmmT1);
+	}
+}
+
+// True if this COP2 opcode compiles into a fused macro run.  The transfer and
+// branch forms (_Rs_ < 0x10) synchronize VU0 state on their own, and
+// VCALLMS/VCALLMSR fall back to the interpreter, so those all break a run.
+bool mVUmacroCanFuse(u32 code) {
+	if ((code >> 26) != 18)       return false;
+	if (!((code >> 21) & 0x10))   return false;
+	const u32 funct = code & 0x3f;
+	if (funct == 0x38 || funct == 0x39) return false; // VCALLMS / VCALLMSR
+	return true;
+}
+
 void setupMacroOp(int mode, const char* opName) {
 	printCOP2(opName);
 	microVU0.cop2 = 1;
 	microVU0.prog.IRinfo.curPC = 0;
 	microVU0.code = cpuRegs.code;
 	memset(&microVU0.prog.IRinfo.info[0], 0, sizeof(microVU0.prog.IRinfo.info[0]));
-	iFlushCall(FLUSH_EVERYTHING);
-	microVU0.regAlloc->reset();
+	if (!g_cop2MacroRunOpen) {
+		iFlushCall(FLUSH_EVERYTHING);
+		microVU0.regAlloc->reset();
+		g_cop2MacroRunOpen = true;
+	}
+	else if (mode & 0x08) {
+		// Clip ops broadcast micro_clipflags through a temp reg from the EE-side
+		// xmm allocator, which doesn't know which regs the mVU regalloc has
+		// cached; write them back first so the temp can't clobber one.
+		microVU0.regAlloc->flushAll();
+	}
 	if (mode & 0x01) { // Q-Reg will be Read
 		xMOVSSZX(xmmPQ, ptr32[&vu0Regs.VI[REG_Q].UL]);
 	}
@@ -50,10 +127,14 @@ void setupMacroOp(int mode, const char* opName) {
 		microVU0.prog.IRinfo.info[0].sFlag.lastWrite   = 0;
 		microVU0.prog.IRinfo.info[0].mFlag.doFlag      = true;
 		microVU0.prog.IRinfo.info[0].mFlag.write       = 0xff;
-		//Denormalize
-		mVUallocSFLAGd(&vu0Regs.VI[REG_STATUS_FLAG].UL);
+		if (!cop2MacroFlagsLive) {
+			//Denormalize
+			mVUallocSFLAGd(&vu0Regs.VI[REG_STATUS_FLAG].UL);
 
-		xMOV(gprF0, eax);
+			xMOV(gprF0, eax);
+			cop2MacroFlagsLive = true;
+		}
+		cop2MacroFlagsDirty = true;
 	}
 }
 
@@ -61,23 +142,8 @@ void endMacroOp(int mode) {
 	if (mode & 0x02) { // Q-Reg was Written To
 		xMOVSS(ptr32[&vu0Regs.VI[REG_Q].UL], xmmPQ);
 	}
-	if (mode & 0x10) { // Status/Mac Flags were Updated
-		// Normalize
-		mVUallocSFLAGc(eax, gprF0, 0);
-		xMOV(ptr32[&vu0Regs.VI[REG_STATUS_FLAG].UL], eax);
-	}
-	microVU0.regAlloc->flushAll();
-
-	if (mode & 0x10) { // Update VU0 Status/Mac instances after flush to avoid corrupting anything
-		mVUallocSFLAGd(&vu0Regs.VI[REG_STATUS_FLAG].UL);
-		xMOVDZX(xmmT1, eax);
-		xSHUF.PS(xmmT1, xmmT1, 0);
-		xMOVAPS(ptr128[&microVU0.regs().micro_statusflags], xmmT1);
-
-		xMOVDZX(xmmT1, ptr32[&vu0Regs.VI[REG_MAC_FLAG].UL]);
-		xSHUF.PS(xmmT1, xmmT1, 0);
-		xMOVAPS(ptr128[&microVU0.regs().micro_macflags], xmmT1);
-	}
+	// Flag normalization, VF write-back and flag instance updates are deferred
+	// until the fused run closes (mVUmacroClose).
 	microVU0.cop2 = 0;
 }
 
@@ -373,20 +439,31 @@ static void recCTC2() {
 
 	iFlushCall(FLUSH_EVERYTHING);
 
-	if (!(cpuRegs.code & 1)) {;
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
-		xMOV(eax, ptr32[&cpuRegs.cycle]);
-		xADD(eax, scaleblockcycles_clear());
-		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
-		xSUB(eax, ptr32[&vu0Regs.cycle]);
-		xSUB(eax, ptr32[&vu0Regs.nextBlockCycles]);
-		xCMP(eax, 8);
-		xForwardJL32 skip;
-		xLoadFarAddr(arg1reg, CpuVU0);
-		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
-		skip.SetTarget();
-		skipvuidle.SetTarget();
+	// Only plain VI moves (the switch's default case) may join a transfer
+	// burst; the special registers below run VU programs or touch flag
+	// state and keep their own guard.
+	const bool plainMove = _Rd_ != REG_STATUS_FLAG && _Rd_ != REG_MAC_FLAG
+		&& _Rd_ != REG_R && _Rd_ != REG_TPC && _Rd_ != REG_FBRST
+		&& _Rd_ != REG_VPU_STAT && _Rd_ != REG_CMSAR1;
+
+	if (!(cpuRegs.code & 1)) {
+		if (!plainMove || cop2TransferRunEnd != pc - 4) {
+			xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
+			xForwardJZ32 skipvuidle;
+			xMOV(eax, ptr32[&cpuRegs.cycle]);
+			xADD(eax, scaleblockcycles_clear());
+			xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
+			xSUB(eax, ptr32[&vu0Regs.cycle]);
+			xSUB(eax, ptr32[&vu0Regs.nextBlockCycles]);
+			xCMP(eax, 8);
+			xForwardJL32 skip;
+			xLoadFarAddr(arg1reg, CpuVU0);
+			xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
+			skip.SetTarget();
+			skipvuidle.SetTarget();
+		}
+		if (plainMove)
+			cop2TransferRunEnd = pc;
 	}
 
 	switch(_Rd_) {
@@ -486,18 +563,21 @@ static void recQMTC2() {
 	iFlushCall(FLUSH_EVERYTHING);
 
 	if (!(cpuRegs.code & 1)) {
-		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-		xForwardJZ32 skipvuidle;
-		xMOV(eax, ptr32[&cpuRegs.cycle]);
-		xADD(eax, scaleblockcycles_clear());
-		xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
-		xSUB(eax, ptr32[&vu0Regs.cycle]);
-		xCMP(eax, 8);
-		xForwardJL32 skip;
-		xLoadFarAddr(arg1reg, CpuVU0);
-		xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
-		skip.SetTarget();
-		skipvuidle.SetTarget();
+		if (cop2TransferRunEnd != pc - 4) {
+			xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
+			xForwardJZ32 skipvuidle;
+			xMOV(eax, ptr32[&cpuRegs.cycle]);
+			xADD(eax, scaleblockcycles_clear());
+			xMOV(ptr32[&cpuRegs.cycle], eax); // update cycles
+			xSUB(eax, ptr32[&vu0Regs.cycle]);
+			xCMP(eax, 8);
+			xForwardJL32 skip;
+			xLoadFarAddr(arg1reg, CpuVU0);
+			xFastCall((void*)BaseVUmicroCPU::ExecuteBlockJIT, arg1reg);
+			skip.SetTarget();
+			skipvuidle.SetTarget();
+		}
+		cop2TransferRunEnd = pc;
 	}
 
 	xMOVAPS(xmmT1, ptr128[&cpuRegs.GPR.r[_Rt_]]);
@@ -566,12 +646,15 @@ namespace Dynarec {
 namespace OpcodeImpl { void recCOP2() { recCOP2t[_Rs_](); }}}}
 void recCOP2_BC2  () { recCOP2_BC2t[_Rt_](); }
 void recCOP2_SPEC1() {
-	iFlushCall(FLUSH_EVERYTHING);
-	xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
-	xForwardJZ32 skipvuidle;
-	xFastCall((void*)_vu0FinishMicro);
-	skipvuidle.SetTarget();
-
+	if (!g_cop2MacroRunOpen) {
+		// First op of a (potential) fused run: make sure VU0 isn't mid-program.
+		// Nothing can start a micro program inside a run, so later ops skip this.
+		iFlushCall(FLUSH_EVERYTHING);
+		xTEST(ptr32[&VU0.VI[REG_VPU_STAT].UL], 0x1);
+		xForwardJZ32 skipvuidle;
+		xFastCall((void*)_vu0FinishMicro);
+		skipvuidle.SetTarget();
+	}
 	recCOP2SPECIAL1t[_Funct_]();
 }
 void recCOP2_SPEC2() { recCOP2SPECIAL2t[(cpuRegs.code&3)|((cpuRegs.code>>4)&0x7c)](); }
@@ -288,6 +288,17 @@ static const bool noFlagOpts = false; // Set to true to disable all flag setting
 // an Upper Instruction updates them. It also always transfers the 4 possible
 // flag instances between blocks...
 
+// Tiered Compilation
+static const bool doTieredComp = true;  // Set to false to always compile fully analyzed blocks
+static const uint mVUtierHotCount = 32; // Baseline block executions before promotion
+// First-time compilation of a block skips the recursive mVUflagPass() analysis of
+// successor blocks and emits conservative flag handling instead (the same code the
+// noFlagOpts debug mode produces), which flattens the latency spike when games
+// upload new microcode mid-level. Baseline blocks count their own executions, and
+// once one turns hot its next fetch recompiles it (and whatever it links to) with
+// the full flag analysis.
+#define mVUflagOptsOff(mVU) (noFlagOpts || (doTieredComp && !(mVU).tierFullOpt))
+
 // Multiple Flag Instances
 static const bool doSFlagInsts = true; // Set to true to enable multiple status flag instances
 static const bool doMFlagInsts = true; // Set to true to enable multiple mac    flag instances
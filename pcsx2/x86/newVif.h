@@ -67,6 +67,12 @@ struct nVifStruct {
 
 	HashBucket				vifBlocks;		// Vif Blocks
 
+	// Copy of the most recently executed block, so back-to-back identical
+	// unpacks skip the bucket walk entirely (startPtr == 0 when invalid).
+	// It's a copy rather than a pointer because HashBucket::add reallocs
+	// its chains.
+	nVifBlock				lastBlock;
+
 	nVifStruct() = default;
 };
 
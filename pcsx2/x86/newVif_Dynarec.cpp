@@ -23,6 +23,7 @@
 
 static void recReset(int idx) {
 	nVif[idx].vifBlocks.reset();
+	nVif[idx].lastBlock.startPtr = 0;
 
 	nVif[idx].recReserve->Reset();
 
@@ -342,10 +343,20 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill) {
 			);
 #endif
 
-	// Seach in cache before trying to compile the block
-	nVifBlock*  b = v.vifBlocks.find(block);
-	if (unlikely(b == nullptr))
-		b = dVifCompile<idx>(block, isFill);
+	// Monomorphic fast path: geometry streaming issues long runs of
+	// identical unpacks, so check the last block executed on this channel
+	// before walking the hash bucket.
+	nVifBlock*  b = &v.lastBlock;
+	if (unlikely(b->key0 != key0 || b->key1 != key1 || b->hash_key != (u16)hash_key || b->startPtr == 0))
+	{
+		// Seach in cache before trying to compile the block
+		b = v.vifBlocks.find(block);
+		if (unlikely(b == nullptr))
+			b = dVifCompile<idx>(block, isFill);
+
+		v.lastBlock = *b;
+		b = &v.lastBlock;
+	}
 
 	{ // Execute the block
 		const VURegs& VU         = vuRegs[idx];
@@ -21,6 +21,7 @@
 
 #include "GS.h"
 #include "GSUtil.h"
+#include "GSDump.h"
 #include "Renderers/SW/GSRendererSW.h"
 #include "Renderers/Null/GSRendererNull.h"
 #include "Renderers/Null/GSDeviceNull.h"
@@ -34,9 +35,42 @@
 
 #include "options_tools.h"
 
+#include <chrono>
+
 static bool is_d3d                  = false;
 static GSRenderer* s_gs             = NULL;
 static u8* s_basemem             = NULL;
+static GSDump s_dump;
+static bool s_dump_pending          = false;
+static std::string s_dump_name;
+static int s_dump_frames            = 0;
+
+// Automatic hot-frame capture ("autodump"): time spent inside the GS entry
+// points for the current frame, checked against a budget at vsync.  Only
+// accumulated while the option is on, refreshed once per frame.
+static bool s_autodump_on           = false;
+static u64 s_frame_gs_us            = 0;
+static int s_autodump_over          = 0;
+static int s_autodump_count         = 0;
+static std::chrono::steady_clock::time_point s_autodump_last;
+
+struct GSAutodumpTimer
+{
+	std::chrono::steady_clock::time_point start;
+
+	GSAutodumpTimer()
+	{
+		if(s_autodump_on)
+			start = std::chrono::steady_clock::now();
+	}
+
+	~GSAutodumpTimer()
+	{
+		if(s_autodump_on)
+			s_frame_gs_us += std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now() - start).count();
+	}
+};
 
 GSdxApp theApp;
 
@@ -134,6 +168,16 @@ static int _GSopen(const char* title, GSRendererType renderer, int threads = -1)
 		threads = theApp.GetConfigI("extrathreads");
 	}
 
+	// More rasterizer workers than the processors left over after the persistent
+	// emulation threads just preempt each other (and the EE/MTGS threads).
+	const int thread_budget = Threading::GetWorkerThreadBudget();
+
+	if (threads > thread_budget)
+	{
+		log_cb(RETRO_LOG_INFO, "GS: clamping extrathreads %d -> %d (worker thread budget)\n", threads, thread_budget);
+		threads = thread_budget;
+	}
+
 	if (theApp.GetCurrentRendererType() != renderer)
 	{
 		// Emulator has made a render change request, which requires a completely
@@ -325,6 +369,11 @@ EXPORT_C GSinitReadFIFO(u8* mem)
 
 EXPORT_C GSreadFIFO(u8* mem)
 {
+	GSAutodumpTimer t;
+
+	if(s_dump)
+		s_dump.ReadFIFO(1);
+
 	s_gs->ReadFIFO(mem, 1);
 }
 
@@ -335,32 +384,125 @@ EXPORT_C GSinitReadFIFO2(u8* mem, u32 size)
 
 EXPORT_C GSreadFIFO2(u8* mem, u32 size)
 {
+	GSAutodumpTimer t;
+
+	if(s_dump)
+		s_dump.ReadFIFO(size);
+
 	s_gs->ReadFIFO(mem, size);
 }
 
 EXPORT_C GSgifTransfer(const u8* mem, u32 size)
 {
+	GSAutodumpTimer t;
+
+	if(s_dump)
+		s_dump.Transfer(3, mem, size * 16);
+
 	s_gs->Transfer<3>(mem, size);
 }
 
 EXPORT_C GSgifTransfer1(u8* mem, u32 addr)
 {
+	GSAutodumpTimer t;
+
+	if(s_dump)
+		s_dump.Transfer(0, mem + addr, 0x4000 - addr);
+
 	s_gs->Transfer<0>(const_cast<u8*>(mem) + addr, (0x4000 - addr) / 16);
 }
 
 EXPORT_C GSgifTransfer2(u8* mem, u32 size)
 {
+	GSAutodumpTimer t;
+
+	if(s_dump)
+		s_dump.Transfer(1, mem, size * 16);
+
 	s_gs->Transfer<1>(const_cast<u8*>(mem), size);
 }
 
 EXPORT_C GSgifTransfer3(u8* mem, u32 size)
 {
+	GSAutodumpTimer t;
+
+	if(s_dump)
+		s_dump.Transfer(2, mem, size * 16);
+
 	s_gs->Transfer<2>(const_cast<u8*>(mem), size);
 }
 
+// Automatic hot-frame capture: once the GS has spent more than its budget on
+// a few consecutive frames, arm a short capture in the regular dump format
+// (GSDump.h), named GS_<crc>_hotNN.gs.  The slow section is still running
+// when the capture opens on the next vsync, so the recorded frames are the
+// ones blowing the budget.  Rate limited so a consistently slow game produces
+// a handful of files per session, not thousands.
+static void AutodumpFrameEnd()
+{
+	if(s_dump || s_dump_pending)
+		return;
+
+	if(s_frame_gs_us < (u64)theApp.GetConfigI("autodump_budget_ms") * 1000)
+	{
+		s_autodump_over = 0;
+		return;
+	}
+
+	if(++s_autodump_over < 3)
+		return;
+
+	s_autodump_over = 0;
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+	if(s_autodump_count >= theApp.GetConfigI("autodump_max"))
+		return;
+	if(s_autodump_count && std::chrono::duration_cast<std::chrono::seconds>(now - s_autodump_last).count() < 30)
+		return;
+
+	s_autodump_last = now;
+
+	s_dump_name = format("GS_%08X_hot%02d.gs", s_gs->m_crc, ++s_autodump_count);
+	s_dump_frames = theApp.GetConfigI("autodump_frames");
+	s_dump_pending = true;
+}
+
 EXPORT_C GSvsync(int field)
 {
-   s_gs->VSync(field);
+	if(s_dump_pending)
+	{
+		// Start the capture on a frame boundary so the frozen state really is
+		// the start-of-frame state the replay tool defrosts from.
+		s_dump_pending = false;
+
+		GSFreezeData fd = {0, NULL};
+		s_gs->Freeze(&fd, true);
+		fd.data = new u8[fd.size];
+		s_gs->Freeze(&fd, false);
+
+		s_dump.Open(s_dump_name, s_gs->m_crc, fd, s_gs->m_regs, s_dump_frames);
+
+		delete[] fd.data;
+	}
+	else if(s_dump)
+		s_dump.VSync(field, s_gs->m_regs);
+
+	{
+		GSAutodumpTimer t;
+		s_gs->VSync(field);
+	}
+
+	if(s_autodump_on)
+		AutodumpFrameEnd();
+
+	s_frame_gs_us = 0;
+	s_autodump_on = theApp.GetConfigB("autodump");
+}
+
+EXPORT_C_(u32) GSgetGPUTimeUs()
+{
+	return s_gs ? s_gs->GetGPUTimeUs() : 0;
 }
 
 EXPORT_C_(int) GSfreeze(int mode, GSFreezeData* data)
@@ -381,6 +523,13 @@ EXPORT_C_(int) GSfreeze(int mode, GSFreezeData* data)
 EXPORT_C GSsetGameCRC(u32 crc, int options)
 {
 	s_gs->SetGameCRC(crc, options);
+
+	if(theApp.GetConfigB("dump") && !s_dump)
+	{
+		s_dump_name = format("GS_%08X.gs", crc);
+		s_dump_frames = theApp.GetConfigI("dump_frames");
+		s_dump_pending = true;
+	}
 }
 
 EXPORT_C GSsetFrameSkip(int frameskip)
@@ -417,6 +566,12 @@ void vmfree(void* ptr, size_t size)
 	VirtualFree(ptr, 0, MEM_RELEASE);
 }
 
+void vm_hint_hugepages(void* ptr, size_t size)
+{
+	// Explicit large pages need SeLockMemoryPrivilege on Windows; not worth
+	// the privilege dance for a hint.
+}
+
 static HANDLE s_fh = NULL;
 static u8* s_Next[8];
 
@@ -513,6 +668,20 @@ void vmfree(void* ptr, size_t size)
 	munmap(ptr, size);
 }
 
+// Asks the kernel to back an already-mapped region with transparent huge
+// pages.  The GS swizzle paths walk the 4MB local memory and the multi-MB
+// page offset LUTs together per block, which blows through 4k dTLB reach;
+// 2M pages cover both with a handful of entries.  Best effort - the hint is
+// ignored when THP is unavailable, and shared mappings (fifo_alloc) can't
+// use it at all.
+void vm_hint_hugepages(void* ptr, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	size_t mask = getpagesize() - 1;
+	madvise(ptr, (size + mask) & ~mask, MADV_HUGEPAGE);
+#endif
+}
+
 static int s_shm_fd = -1;
 
 void* fifo_alloc(size_t size, size_t repeat)
@@ -593,6 +762,7 @@ void GSdxApp::Init()
 
 	// Avoid to clutter the ini file with useless options
 #ifdef _WIN32
+	m_current_configuration["dx11_deferred_context"]                      = "0";
 	m_current_configuration["dx_break_on_severity"]                       = "0";
 	// D3D Blending option
 	m_current_configuration["accurate_blending_unit_d3d11"]               = "1";
@@ -601,6 +771,10 @@ void GSdxApp::Init()
 	m_current_configuration["accurate_date"]                              = "1";
 	m_current_configuration["accurate_blending_unit"]                     = "1";
 	m_current_configuration["AspectRatio"]                                = "1";
+	m_current_configuration["autodump"]                                   = "0";
+	m_current_configuration["autodump_budget_ms"]                         = "25";
+	m_current_configuration["autodump_frames"]                            = "30";
+	m_current_configuration["autodump_max"]                               = "8";
 	m_current_configuration["autoflush_sw"]                               = "1";
 	m_current_configuration["clut_load_before_draw"]                      = "0";
 	m_current_configuration["crc_hack_level"]                             = std::to_string(static_cast<s8>(CRCHackLevel::Automatic));
@@ -610,6 +784,7 @@ void GSdxApp::Init()
 	m_current_configuration["disable_hw_gl_draw"]                         = "0";
 	m_current_configuration["dithering_ps2"]                              = "2";
 	m_current_configuration["dump"]                                       = "0";
+	m_current_configuration["dump_frames"]                                = "600";
 	m_current_configuration["extrathreads"]                               = "2";
 	m_current_configuration["extrathreads_height"]                        = "4";
 	m_current_configuration["filter"]                                     = std::to_string(static_cast<s8>(BiFiltering::PS2));
@@ -651,6 +826,7 @@ void GSdxApp::Init()
 	m_current_configuration["shaderfx"]                                   = "0";
 	m_current_configuration["shaderfx_conf"]                              = "shaders/GSdx_FX_Settings.ini";
 	m_current_configuration["shaderfx_glsl"]                              = "shaders/GSdx.fx";
+	m_current_configuration["shared_lut_segment"]                         = "0";
 	m_current_configuration["TVShader"]                                   = "0";
 	m_current_configuration["upscale_multiplier"]                         = "1";
 	m_current_configuration["UserHacks"]                                  = "0";
@@ -663,6 +839,7 @@ void GSdxApp::Init()
 	m_current_configuration["UserHacks_Half_Bottom_Override"]             = "-1";
 	m_current_configuration["UserHacks_HalfPixelOffset"]                  = "0";
 	m_current_configuration["UserHacks_merge_pp_sprite"]                  = "0";
+	m_current_configuration["UserHacks_predictive_readback"]              = "0";
 	m_current_configuration["UserHacks_round_sprite_offset"]              = "0";
 	m_current_configuration["UserHacks_SkipDraw"]                         = "0";
 	m_current_configuration["UserHacks_SkipDraw_Offset"]                  = "0";
@@ -35,6 +35,7 @@ GSClut::GSClut(GSLocalMemory* mem)
 	m_buff64 = (u64*)&p[4096]; // 2k
 	m_write.dirty = true;
 	m_read.dirty = true;
+	m_snapshot_len = 0;
 
 	for (int i = 0; i < 16; i++)
 	{
@@ -164,12 +165,74 @@ bool GSClut::WriteTest(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 
 void GSClut::Write(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 {
+	writeCLUT wc = m_wc[TEX0.CSM][TEX0.CPSM][TEX0.PSM];
+
+	// CSM1 loads read the palette from a fixed layout at CBP, so a reload of
+	// unchanged data with unchanged clut registers can be caught by comparing
+	// the source against a copy of the previous load. Games commonly set
+	// CLD=1 on every TEX0 write and re-upload an identical palette per draw,
+	// and WriteState::IsDirty also trips on non-clut TEX0 bits.
+	if (TEX0.CSM == 0 && wc != &GSClut::WriteCLUT_NULL)
+	{
+		const u8* src;
+
+		switch (TEX0.CPSM)
+		{
+			case PSM_PSMCT32:
+			case PSM_PSMCT24:
+				src = m_mem->BlockPtr32(0, 0, TEX0.CBP, 1);
+				break;
+			case PSM_PSMCT16:
+				src = m_mem->BlockPtr16(0, 0, TEX0.CBP, 1);
+				break;
+			default: // PSM_PSMCT16S, the only other format with a valid handler
+				src = m_mem->BlockPtr16S(0, 0, TEX0.CBP, 1);
+				break;
+		}
+
+		const int entries = ((TEX0.PSM & 0x7) == 0x4) ? 16 : 256;
+		const int len = entries * (TEX0.CPSM < PSM_PSMCT16 ? 4 : 2);
+
+		bool same = m_snapshot_len == len
+			&& m_write.TEX0.CBP == TEX0.CBP
+			&& m_write.TEX0.CPSM == TEX0.CPSM
+			&& m_write.TEX0.CSM == TEX0.CSM
+			&& m_write.TEX0.CSA == TEX0.CSA
+			&& (m_write.TEX0.PSM & 0x7) == (TEX0.PSM & 0x7);
+
+		if (same)
+		{
+			GSVector4i eq = GSVector4i::xffffffff();
+
+			for (int i = 0; i < len; i += 16)
+				eq &= GSVector4i::load<true>(&src[i]).eq8(GSVector4i::load<true>(&m_snapshot[i]));
+
+			same = eq.alltrue();
+		}
+
+		if (same)
+		{
+			// The expanded clut (and the read buffers) still match.
+			m_write.TEX0 = TEX0;
+			m_write.TEXCLUT = TEXCLUT;
+			m_write.dirty = false;
+			return;
+		}
+
+		memcpy(m_snapshot, src, len);
+		m_snapshot_len = len;
+	}
+	else
+	{
+		m_snapshot_len = 0;
+	}
+
 	m_write.TEX0 = TEX0;
 	m_write.TEXCLUT = TEXCLUT;
 	m_write.dirty = false;
 	m_read.dirty = true;
 
-	(this->*m_wc[TEX0.CSM][TEX0.CPSM][TEX0.PSM])(TEX0, TEXCLUT);
+	(this->*wc)(TEX0, TEXCLUT);
 }
 
 void GSClut::WriteCLUT32_I8_CSM1(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
@@ -49,6 +49,12 @@ class alignas(32) GSClut : public GSAlignedClass<32>
 		bool IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT);
 	} m_write;
 
+	// Copy of the source data of the last CSM1 load, so Write can detect a
+	// game re-uploading an identical palette and skip the re-expansion.
+	// m_snapshot_len is 0 when the copy is not valid (e.g. after a CSM2 load).
+	alignas(32) u8 m_snapshot[1024];
+	int m_snapshot_len;
+
 	struct alignas(32) ReadState
 	{
 		GIFRegTEX0 TEX0;
@@ -0,0 +1,107 @@
+/*
+ *	Copyright (C) 2007-2009 Gabest
+ *	http://www.gabest.org
+ *
+ *  This Program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This Program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GNU Make; see the file COPYING.  If not, write to
+ *  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA USA.
+ *  http://www.gnu.org/copyleft/gpl.html
+ *
+ */
+
+#include "stdafx.h"
+#include "GSDump.h"
+
+GSDump::GSDump()
+	: m_gs(NULL)
+	, m_frames(0)
+{
+}
+
+GSDump::~GSDump()
+{
+	Close();
+}
+
+void GSDump::Open(const std::string& fn, u32 crc, const GSFreezeData& fd, const GSPrivRegSet* regs, int frames)
+{
+	Close();
+
+	m_gs = fopen(fn.c_str(), "wb");
+	m_frames = frames;
+
+	if(m_gs == NULL)
+		return;
+
+	u32 header[4] = {GS_DUMP_MAGIC, GS_DUMP_VERSION, crc, (u32)fd.size};
+
+	fwrite(header, sizeof(header), 1, m_gs);
+	fwrite(fd.data, fd.size, 1, m_gs);
+	fwrite(regs, sizeof(*regs), 1, m_gs);
+}
+
+void GSDump::Close()
+{
+	if(m_gs == NULL)
+		return;
+
+	fclose(m_gs);
+
+	m_gs = NULL;
+}
+
+void GSDump::Transfer(int index, const u8* mem, size_t size)
+{
+	if(m_gs == NULL || size == 0)
+		return;
+
+	u8 id = GS_DUMP_TRANSFER;
+	u8 path = (u8)index;
+	u32 bytes = (u32)size;
+
+	fwrite(&id, 1, 1, m_gs);
+	fwrite(&path, 1, 1, m_gs);
+	fwrite(&bytes, 4, 1, m_gs);
+	fwrite(mem, bytes, 1, m_gs);
+}
+
+void GSDump::ReadFIFO(u32 size)
+{
+	if(m_gs == NULL)
+		return;
+
+	u8 id = GS_DUMP_READFIFO;
+
+	fwrite(&id, 1, 1, m_gs);
+	fwrite(&size, 4, 1, m_gs);
+}
+
+void GSDump::VSync(int field, const GSPrivRegSet* regs)
+{
+	if(m_gs == NULL)
+		return;
+
+	u8 id = GS_DUMP_REGS;
+
+	fwrite(&id, 1, 1, m_gs);
+	fwrite(regs, sizeof(*regs), 1, m_gs);
+
+	id = GS_DUMP_VSYNC;
+	u8 fld = (u8)field;
+
+	fwrite(&id, 1, 1, m_gs);
+	fwrite(&fld, 1, 1, m_gs);
+
+	if(m_frames > 0 && --m_frames == 0)
+		Close();
+}
@@ -0,0 +1,70 @@
+/*
+ *	Copyright (C) 2007-2009 Gabest
+ *	http://www.gabest.org
+ *
+ *  This Program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This Program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GNU Make; see the file COPYING.  If not, write to
+ *  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA USA.
+ *  http://www.gnu.org/copyleft/gpl.html
+ *
+ */
+
+#pragma once
+
+#include "GS.h"
+#include <cstdio>
+#include <string>
+
+// Dump file layout:
+//
+//   u32 magic ("GSD0"), u32 version, u32 crc, u32 state_size
+//   state_size bytes of frozen GSState (includes local memory and clut)
+//   sizeof(GSPrivRegSet) bytes of privileged registers
+//
+// followed by a stream of records, each introduced by a one byte id:
+//
+//   GS_DUMP_TRANSFER : u8 path, u32 bytes, data  (raw GIF packet)
+//   GS_DUMP_VSYNC    : u8 field
+//   GS_DUMP_READFIFO : u32 qwords
+//   GS_DUMP_REGS     : sizeof(GSPrivRegSet) bytes of privileged registers
+//
+// All values are little endian. Replayed by the gs_replay benchmark tool.
+
+#define GS_DUMP_MAGIC 0x30445347 // "GSD0"
+#define GS_DUMP_VERSION 1
+
+enum
+{
+	GS_DUMP_TRANSFER = 0,
+	GS_DUMP_VSYNC = 1,
+	GS_DUMP_READFIFO = 2,
+	GS_DUMP_REGS = 3,
+};
+
+class GSDump
+{
+	FILE* m_gs;
+	int m_frames;
+
+public:
+	GSDump();
+	~GSDump();
+
+	void Open(const std::string& fn, u32 crc, const GSFreezeData& fd, const GSPrivRegSet* regs, int frames);
+	void Close();
+	void Transfer(int index, const u8* mem, size_t size);
+	void ReadFIFO(u32 size);
+	void VSync(int field, const GSPrivRegSet* regs);
+
+	operator bool() { return m_gs != NULL; }
+};
@@ -46,20 +46,32 @@
 		for(int x = _r.left; x < _r.right; x += (w) >> 3) \
 		{ \
 			const u8* src = BlockPtr(_base + off->block.col[x]); \
+			if(x + ((w) >> 3) < _r.right) \
+			{ \
+				/* Swizzled blocks are 256 bytes but rarely contiguous, so the */ \
+				/* hardware prefetchers don't follow them; pull the next block in. */ \
+				const char* _next = (const char*)BlockPtr(_base + off->block.col[x + ((w) >> 3)]); \
+				_mm_prefetch(_next, _MM_HINT_T0); \
+				_mm_prefetch(_next + 64, _MM_HINT_T0); \
+				_mm_prefetch(_next + 128, _MM_HINT_T0); \
+				_mm_prefetch(_next + 192, _MM_HINT_T0); \
+			} \
 			u8* read_dst = &_dst[x * (bpp)]; \
 
 #define FOREACH_BLOCK_END }}
 
 //
 
-u32 GSLocalMemory::pageOffset32[32][32][64];
-u32 GSLocalMemory::pageOffset32Z[32][32][64];
-u32 GSLocalMemory::pageOffset16[32][64][64];
-u32 GSLocalMemory::pageOffset16S[32][64][64];
-u32 GSLocalMemory::pageOffset16Z[32][64][64];
-u32 GSLocalMemory::pageOffset16SZ[32][64][64];
-u32 GSLocalMemory::pageOffset8[32][64][128];
-u32 GSLocalMemory::pageOffset4[32][128][128];
+GSLocalMemory::PageOffsetLUT GSLocalMemory::s_pageOffsetLUT;
+
+u32 (&GSLocalMemory::pageOffset32)[32][32][64]   = GSLocalMemory::s_pageOffsetLUT.pageOffset32;
+u32 (&GSLocalMemory::pageOffset32Z)[32][32][64]  = GSLocalMemory::s_pageOffsetLUT.pageOffset32Z;
+u32 (&GSLocalMemory::pageOffset16)[32][64][64]   = GSLocalMemory::s_pageOffsetLUT.pageOffset16;
+u32 (&GSLocalMemory::pageOffset16S)[32][64][64]  = GSLocalMemory::s_pageOffsetLUT.pageOffset16S;
+u32 (&GSLocalMemory::pageOffset16Z)[32][64][64]  = GSLocalMemory::s_pageOffsetLUT.pageOffset16Z;
+u32 (&GSLocalMemory::pageOffset16SZ)[32][64][64] = GSLocalMemory::s_pageOffsetLUT.pageOffset16SZ;
+u32 (&GSLocalMemory::pageOffset8)[32][64][128]   = GSLocalMemory::s_pageOffsetLUT.pageOffset8;
+u32 (&GSLocalMemory::pageOffset4)[32][128][128]  = GSLocalMemory::s_pageOffsetLUT.pageOffset4;
 
 int GSLocalMemory::rowOffset32[4096];
 int GSLocalMemory::rowOffset32Z[4096];
@@ -85,9 +97,105 @@ GSLocalMemory::psm_t GSLocalMemory::m_psm[64];
 
 //
 
+#ifdef __linux__
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Shared read-only segment for the page offset LUTs (shared_lut_segment).
+// The tables are several MB of identical, deterministic data per process;
+// hosts running many instances can map them once from a named segment
+// instead of each dirtying its own copy.  The first process computes the
+// tables as usual, publishes them behind a ready flag in the header page,
+// and every process (creator included) then remaps the static block
+// read-only from the segment, so the inlined address computations are
+// untouched.  Any failure leaves the process on its private copy.
+static bool s_lut_shared = false;
+
+static bool SharedLUTAttach(void* tables, size_t size)
+{
+	const char* name = "/pcsx2-gs-lut-v1";
+
+	bool creator = true;
+
+	int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+
+	if(fd < 0)
+	{
+		creator = false;
+		fd = shm_open(name, O_RDWR, 0644);
+	}
+
+	if(fd < 0)
+		return false;
+
+	if(creator && ftruncate(fd, 4096 + size) < 0)
+	{
+		close(fd);
+		shm_unlink(name);
+		return false;
+	}
+
+	u32* header = (u32*)mmap(NULL, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	if(header == MAP_FAILED)
+	{
+		close(fd);
+		return false;
+	}
+
+	bool ready = false;
+
+	if(creator)
+	{
+		void* dst = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 4096);
+
+		if(dst != MAP_FAILED)
+		{
+			memcpy(dst, tables, size);
+			munmap(dst, size);
+
+			__atomic_store_n(header, 1, __ATOMIC_RELEASE);
+
+			ready = true;
+		}
+	}
+	else
+	{
+		// Bounded wait for the creator to finish filling the segment; a
+		// stale unpublished segment just drops us back to the private copy.
+		for(int i = 0; i < 500 && !ready; i++)
+		{
+			if(__atomic_load_n(header, __ATOMIC_ACQUIRE) == 1)
+				ready = true;
+			else
+				usleep(1000);
+		}
+	}
+
+	munmap(header, 4096);
+
+	// Replace the private, dirty table pages with the shared read-only ones.
+	if(ready && mmap(tables, size, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 4096) == MAP_FAILED)
+		ready = false;
+
+	close(fd);
+
+	return ready;
+}
+
+#endif
+
+//
+
 GSLocalMemory::GSLocalMemory()
 	: m_clut(this)
 {
+	memset(m_omap_mru, 0, sizeof(m_omap_mru));
+	memset(m_pomap_mru, 0, sizeof(m_pomap_mru));
+	memset(m_po4map_mru, 0, sizeof(m_po4map_mru));
+
 	m_use_fifo_alloc = theApp.GetConfigB("wrap_gs_mem");
 	switch (theApp.GetCurrentRendererType()) {
 		case GSRendererType::OGL_SW:
@@ -107,6 +215,11 @@ GSLocalMemory::GSLocalMemory()
 	{
 		m_vm8 = (u8*)vmalloc(m_vmsize * 4, false);
 		m_use_fifo_alloc = false;
+
+		// Huge pages put the whole 4MB vm in two dTLB entries.  Only useful
+		// on this path: the fifo_alloc mirroring is a shared mapping, which
+		// transparent huge pages don't back.
+		vm_hint_hugepages(m_vm8, m_vmsize * 4);
 	}
 
 	m_vm16 = (u16*)m_vm8;
@@ -114,31 +227,49 @@ GSLocalMemory::GSLocalMemory()
 
 	memset(m_vm8, 0, m_vmsize);
 
-	for(int bp = 0; bp < 32; bp++)
+	// Once the LUT block is remapped from the shared segment it is read-only,
+	// so later instances (renderer switches) must not refill it.
+#ifdef __linux__
+	if(!s_lut_shared)
+#endif
 	{
-		for(int y = 0; y < 32; y++) for(int x = 0; x < 64; x++)
-		{
-			pageOffset32[bp][y][x] = PixelAddressOrg32(x, y, bp, 0);
-			pageOffset32Z[bp][y][x] = PixelAddressOrg32Z(x, y, bp, 0);
-		}
+		// Hint before the fill below first-touches the pages, so they are
+		// allocated huge rather than collapsed later.
+		vm_hint_hugepages(&s_pageOffsetLUT, sizeof(s_pageOffsetLUT));
 
-		for(int y = 0; y < 64; y++) for(int x = 0; x < 64; x++)
+		for(int bp = 0; bp < 32; bp++)
 		{
-			pageOffset16[bp][y][x] = PixelAddressOrg16(x, y, bp, 0);
-			pageOffset16S[bp][y][x] = PixelAddressOrg16S(x, y, bp, 0);
-			pageOffset16Z[bp][y][x] = PixelAddressOrg16Z(x, y, bp, 0);
-			pageOffset16SZ[bp][y][x] = PixelAddressOrg16SZ(x, y, bp, 0);
-		}
+			for(int y = 0; y < 32; y++) for(int x = 0; x < 64; x++)
+			{
+				pageOffset32[bp][y][x] = PixelAddressOrg32(x, y, bp, 0);
+				pageOffset32Z[bp][y][x] = PixelAddressOrg32Z(x, y, bp, 0);
+			}
 
-		for(int y = 0; y < 64; y++) for(int x = 0; x < 128; x++)
-		{
-			pageOffset8[bp][y][x] = PixelAddressOrg8(x, y, bp, 0);
-		}
+			for(int y = 0; y < 64; y++) for(int x = 0; x < 64; x++)
+			{
+				pageOffset16[bp][y][x] = PixelAddressOrg16(x, y, bp, 0);
+				pageOffset16S[bp][y][x] = PixelAddressOrg16S(x, y, bp, 0);
+				pageOffset16Z[bp][y][x] = PixelAddressOrg16Z(x, y, bp, 0);
+				pageOffset16SZ[bp][y][x] = PixelAddressOrg16SZ(x, y, bp, 0);
+			}
 
-		for(int y = 0; y < 128; y++) for(int x = 0; x < 128; x++)
-		{
-			pageOffset4[bp][y][x] = PixelAddressOrg4(x, y, bp, 0);
+			for(int y = 0; y < 64; y++) for(int x = 0; x < 128; x++)
+			{
+				pageOffset8[bp][y][x] = PixelAddressOrg8(x, y, bp, 0);
+			}
+
+			for(int y = 0; y < 128; y++) for(int x = 0; x < 128; x++)
+			{
+				pageOffset4[bp][y][x] = PixelAddressOrg4(x, y, bp, 0);
+			}
 		}
+
+#ifdef __linux__
+		static_assert(sizeof(s_pageOffsetLUT) % 4096 == 0, "LUT block must be page sized");
+
+		if(theApp.GetConfigB("shared_lut_segment"))
+			s_lut_shared = SharedLUTAttach(&s_pageOffsetLUT, sizeof(s_pageOffsetLUT));
+#endif
 	}
 
 	for(size_t x = 0; x < countof(rowOffset32); x++)
@@ -507,20 +638,54 @@ GSLocalMemory::~GSLocalMemory()
 	}
 }
 
+// Checks the MRU array for hash before falling back to the map; hits are
+// moved to the front so alternating configurations stay resident.
+template<class T, size_t N> static T* mru_lookup(T* (&mru)[N], u32 hash)
+{
+	for(size_t i = 0; i < N; i++)
+	{
+		T* p = mru[i];
+
+		if(p && p->hash == hash)
+		{
+			for(; i > 0; i--) mru[i] = mru[i - 1];
+			mru[0] = p;
+			return p;
+		}
+	}
+
+	return nullptr;
+}
+
+template<class T, size_t N> static void mru_insert(T* (&mru)[N], T* p)
+{
+	for(size_t i = N - 1; i > 0; i--) mru[i] = mru[i - 1];
+	mru[0] = p;
+}
+
 GSOffset* GSLocalMemory::GetOffset(u32 bp, u32 bw, u32 psm)
 {
 	u32 hash = bp | (bw << 14) | (psm << 20);
 
+	if(GSOffset* off = mru_lookup(m_omap_mru, hash))
+		return off;
+
+	GSOffset* off;
+
 	auto i = m_omap.find(hash);
 
 	if(i != m_omap.end())
 	{
-		return i->second;
+		off = i->second;
 	}
+	else
+	{
+		off = new GSOffset(bp, bw, psm);
 
-	GSOffset* off = new GSOffset(bp, bw, psm);
+		m_omap[hash] = off;
+	}
 
-	m_omap[hash] = off;
+	mru_insert(m_omap_mru, off);
 
 	return off;
 }
@@ -542,10 +707,15 @@ GSPixelOffset* GSLocalMemory::GetPixelOffset(const GIFRegFRAME& FRAME, const GIF
 
 	u32 hash = (FRAME.FBP << 0) | (ZBUF.ZBP << 9) | (bw << 18) | (fpsm_hash << 24) | (zpsm_hash << 28);
 
+	if(GSPixelOffset* off = mru_lookup(m_pomap_mru, hash))
+		return off;
+
 	auto it = m_pomap.find(hash);
 
 	if(it != m_pomap.end())
 	{
+		mru_insert(m_pomap_mru, it->second);
+
 		return it->second;
 	}
 
@@ -578,6 +748,8 @@ GSPixelOffset* GSLocalMemory::GetPixelOffset(const GIFRegFRAME& FRAME, const GIF
 
 	m_pomap[hash] = off;
 
+	mru_insert(m_pomap_mru, off);
+
 	return off;
 }
 
@@ -598,10 +770,15 @@ GSPixelOffset4* GSLocalMemory::GetPixelOffset4(const GIFRegFRAME& FRAME, const G
 
 	u32 hash = (FRAME.FBP << 0) | (ZBUF.ZBP << 9) | (bw << 18) | (fpsm_hash << 24) | (zpsm_hash << 28);
 
+	if(GSPixelOffset4* off = mru_lookup(m_po4map_mru, hash))
+		return off;
+
 	auto it = m_po4map.find(hash);
 
 	if(it != m_po4map.end())
 	{
+		mru_insert(m_po4map_mru, it->second);
+
 		return it->second;
 	}
 
@@ -634,6 +811,8 @@ GSPixelOffset4* GSLocalMemory::GetPixelOffset4(const GIFRegFRAME& FRAME, const G
 
 	m_po4map[hash] = off;
 
+	mru_insert(m_po4map_mru, off);
+
 	return off;
 }
 
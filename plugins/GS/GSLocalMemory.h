@@ -135,14 +135,32 @@ public:
 protected:
 	bool m_use_fifo_alloc;
 
-	static u32 pageOffset32[32][32][64];
-	static u32 pageOffset32Z[32][32][64];
-	static u32 pageOffset16[32][64][64];
-	static u32 pageOffset16S[32][64][64];
-	static u32 pageOffset16Z[32][64][64];
-	static u32 pageOffset16SZ[32][64][64];
-	static u32 pageOffset8[32][64][128];
-	static u32 pageOffset4[32][128][128];
+	// The page offset LUTs live in one page-aligned block so the whole thing
+	// can be remapped from a named shared segment when several instances run
+	// on the same host (shared_lut_segment).  The reference aliases keep the
+	// address computations below identical either way.
+	struct alignas(4096) PageOffsetLUT
+	{
+		u32 pageOffset32[32][32][64];
+		u32 pageOffset32Z[32][32][64];
+		u32 pageOffset16[32][64][64];
+		u32 pageOffset16S[32][64][64];
+		u32 pageOffset16Z[32][64][64];
+		u32 pageOffset16SZ[32][64][64];
+		u32 pageOffset8[32][64][128];
+		u32 pageOffset4[32][128][128];
+	};
+
+	static PageOffsetLUT s_pageOffsetLUT;
+
+	static u32 (&pageOffset32)[32][32][64];
+	static u32 (&pageOffset32Z)[32][32][64];
+	static u32 (&pageOffset16)[32][64][64];
+	static u32 (&pageOffset16S)[32][64][64];
+	static u32 (&pageOffset16Z)[32][64][64];
+	static u32 (&pageOffset16SZ)[32][64][64];
+	static u32 (&pageOffset8)[32][64][128];
+	static u32 (&pageOffset4)[32][128][128];
 
 	static int rowOffset32[4096];
 	static int rowOffset32Z[4096];
@@ -183,6 +201,15 @@ protected:
 	std::unordered_map<u32, GSPixelOffset4*> m_po4map;
 	std::unordered_map<u64, std::vector<GSVector2i>*> m_p2tmap;
 
+	// Games ping-pong between a handful of context configurations thousands
+	// of times per frame, and every FRAME/ZBUF/TEX0 swap re-resolves its
+	// offset tables; a tiny MRU in front of the maps answers those swaps
+	// without a hash lookup.  Entries outlive the maps' content (nothing is
+	// freed before the destructor), so the cached pointers stay valid.
+	GSOffset* m_omap_mru[4];
+	GSPixelOffset* m_pomap_mru[2];
+	GSPixelOffset4* m_po4map_mru[2];
+
 public:
 	GSLocalMemory();
 	virtual ~GSLocalMemory();
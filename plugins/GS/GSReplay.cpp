@@ -0,0 +1,282 @@
+/*
+ *	Copyright (C) 2007-2009 Gabest
+ *	http://www.gabest.org
+ *
+ *  This Program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This Program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GNU Make; see the file COPYING.  If not, write to
+ *  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA USA.
+ *  http://www.gnu.org/copyleft/gpl.html
+ *
+ */
+
+// Standalone headless replay benchmark for GS dumps (see GSDump.h for the file
+// layout). Replays the recorded GIF packet stream through GSRendererSW (or the
+// Null renderer) at maximum speed and reports frame/draw timings, so renderer
+// performance can be regression-tested per commit without booting a game.
+//
+//   gs_replay <dump.gs> [-t threads] [-l loops] [-n]
+
+#include "stdafx.h"
+#include "GS.h"
+#include "GSDump.h"
+#include "GSToolShim.h"
+#include "Renderers/SW/GSRendererSW.h"
+#include "Renderers/Null/GSRendererNull.h"
+#include "Renderers/Null/GSDeviceNull.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+EXPORT_C_(int) GSinit();
+
+namespace
+{
+	struct ReplayPacket
+	{
+		u8 id;
+		u8 path;
+		int field;
+		u32 size; // transfer: bytes, readfifo: qwords
+		const u8* data;
+	};
+
+	alignas(32) static u8 s_regs_mem[sizeof(GSPrivRegSet)];
+
+	static std::vector<u8> s_file;
+	static std::vector<ReplayPacket> s_packets;
+	static GSFreezeData s_state = {0, NULL};
+	static const u8* s_regs_init = NULL;
+	static u32 s_crc = 0;
+
+	static bool load_dump(const char* fn)
+	{
+		FILE* fp = fopen(fn, "rb");
+
+		if(fp == NULL)
+		{
+			fprintf(stderr, "gs_replay: cannot open %s\n", fn);
+			return false;
+		}
+
+		fseek(fp, 0, SEEK_END);
+		long len = ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+
+		s_file.resize(len);
+
+		if(fread(s_file.data(), len, 1, fp) != 1)
+		{
+			fclose(fp);
+			return false;
+		}
+
+		fclose(fp);
+
+		const u8* p = s_file.data();
+		const u8* end = p + s_file.size();
+
+		if(s_file.size() < 16 || *(u32*)p != GS_DUMP_MAGIC || *(u32*)(p + 4) != GS_DUMP_VERSION)
+		{
+			fprintf(stderr, "gs_replay: %s is not a version %d GS dump\n", fn, GS_DUMP_VERSION);
+			return false;
+		}
+
+		s_crc = *(u32*)(p + 8);
+		s_state.size = *(u32*)(p + 12);
+		p += 16;
+
+		if(p + s_state.size + sizeof(GSPrivRegSet) > end)
+			return false;
+
+		s_state.data = const_cast<u8*>(p);
+		p += s_state.size;
+		s_regs_init = p;
+		p += sizeof(GSPrivRegSet);
+
+		while(p < end)
+		{
+			ReplayPacket pkt = {};
+			pkt.id = *p++;
+
+			switch(pkt.id)
+			{
+			case GS_DUMP_TRANSFER:
+				if(p + 5 > end) return false;
+				pkt.path = *p++;
+				pkt.size = *(u32*)p;
+				p += 4;
+				if(p + pkt.size > end) return false;
+				pkt.data = p;
+				p += pkt.size;
+				break;
+			case GS_DUMP_VSYNC:
+				if(p + 1 > end) return false;
+				pkt.field = *p++;
+				break;
+			case GS_DUMP_READFIFO:
+				if(p + 4 > end) return false;
+				pkt.size = *(u32*)p;
+				p += 4;
+				break;
+			case GS_DUMP_REGS:
+				if(p + sizeof(GSPrivRegSet) > end) return false;
+				pkt.data = p;
+				p += sizeof(GSPrivRegSet);
+				break;
+			default:
+				fprintf(stderr, "gs_replay: unknown record id %d\n", pkt.id);
+				return false;
+			}
+
+			s_packets.push_back(pkt);
+		}
+
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const char* fn = NULL;
+	int threads = -1;
+	int loops = 1;
+	bool null_renderer = false;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-t") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-l") == 0 && i + 1 < argc) loops = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-n") == 0) null_renderer = true;
+		else fn = argv[i];
+	}
+
+	if(fn == NULL)
+	{
+		fprintf(stderr, "usage: gs_replay <dump.gs> [-t threads] [-l loops] [-n (null renderer)]\n");
+		return 1;
+	}
+
+	if(GSinit() != 0)
+	{
+		fprintf(stderr, "gs_replay: GSinit failed\n");
+		return 1;
+	}
+
+	if(!load_dump(fn))
+		return 1;
+
+	if(threads == -1)
+		threads = theApp.GetConfigI("extrathreads");
+
+	threads = std::min(threads, Threading::GetWorkerThreadBudget());
+
+	GSRenderer* gs;
+
+	if(null_renderer)
+		gs = new GSRendererNull();
+	else
+		gs = new GSRendererSW(threads);
+
+	gs->SetRegsMem(s_regs_mem);
+
+	if(!gs->CreateDevice(new GSDeviceNull()))
+	{
+		fprintf(stderr, "gs_replay: CreateDevice failed\n");
+		return 1;
+	}
+
+	gs->SetGameCRC(s_crc, 0);
+
+	u64 frames = 0;
+	u64 draws = 0;
+	u64 prims = 0;
+	double total_ms = 0.0;
+	double min_ms = 1e9;
+	double max_ms = 0.0;
+
+	std::vector<u8> fifo_scratch;
+
+	for(int loop = 0; loop < loops; loop++)
+	{
+		memcpy(s_regs_mem, s_regs_init, sizeof(GSPrivRegSet));
+
+		gs->Defrost(&s_state);
+
+		auto frame_start = std::chrono::steady_clock::now();
+
+		for(const ReplayPacket& pkt : s_packets)
+		{
+			switch(pkt.id)
+			{
+			case GS_DUMP_TRANSFER:
+				switch(pkt.path)
+				{
+				case 0: gs->Transfer<0>(pkt.data, pkt.size / 16); break;
+				case 1: gs->Transfer<1>(pkt.data, pkt.size / 16); break;
+				case 2: gs->Transfer<2>(pkt.data, pkt.size / 16); break;
+				case 3: gs->Transfer<3>(pkt.data, pkt.size / 16); break;
+				}
+				break;
+			case GS_DUMP_VSYNC:
+			{
+				draws += gs->GetFrameDraws();
+				prims += gs->GetFramePrims();
+
+				gs->VSync(pkt.field);
+
+				auto now = std::chrono::steady_clock::now();
+				double ms = std::chrono::duration<double, std::milli>(now - frame_start).count();
+				frame_start = now;
+
+				frames++;
+				total_ms += ms;
+				if(ms < min_ms) min_ms = ms;
+				if(ms > max_ms) max_ms = ms;
+				break;
+			}
+			case GS_DUMP_READFIFO:
+				fifo_scratch.resize(pkt.size * 16);
+				gs->InitReadFIFO(fifo_scratch.data(), pkt.size);
+				gs->ReadFIFO(fifo_scratch.data(), pkt.size);
+				break;
+			case GS_DUMP_REGS:
+				memcpy(s_regs_mem, pkt.data, sizeof(GSPrivRegSet));
+				break;
+			}
+		}
+	}
+
+	if(frames == 0)
+	{
+		fprintf(stderr, "gs_replay: no frames in dump\n");
+		return 1;
+	}
+
+	printf("gs_replay: %s (%08X), %s renderer, %d threads\n",
+		fn, s_crc, null_renderer ? "null" : "sw", threads);
+	printf("  frames   : %llu in %.1f ms => %.2f fps\n",
+		(unsigned long long)frames, total_ms, frames * 1000.0 / total_ms);
+	printf("  frame ms : min %.3f / avg %.3f / max %.3f\n",
+		min_ms, total_ms / frames, max_ms);
+	printf("  draws    : %llu (%.1f/frame), %llu prims (%.1f/draw), %.1f us/draw\n",
+		(unsigned long long)draws, (double)draws / frames,
+		(unsigned long long)prims, draws ? (double)prims / draws : 0.0,
+		draws ? total_ms * 1000.0 / draws : 0.0);
+
+	delete gs->m_dev;
+	gs->m_dev = NULL;
+	delete gs;
+
+	return 0;
+}
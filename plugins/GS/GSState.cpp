@@ -60,6 +60,10 @@ GSState::GSState()
 	memset(&m_vertex, 0, sizeof(m_vertex));
 	memset(&m_index, 0, sizeof(m_index));
 
+	m_frame_prims = 0;
+	m_frame_draws = 0;
+	m_frame_vmem_dirty = true;
+
 	m_v.RGBAQ.Q = 1.0f;
 
 	GrowVertexBuffer();
@@ -200,6 +204,8 @@ void GSState::Reset()
 	m_vertex.tail = 0;
 	m_vertex.next = 0;
 	m_index.tail = 0;
+
+	m_frame_vmem_dirty = true;
 }
 
 void GSState::ResetHandlers()
@@ -1272,6 +1278,8 @@ void GSState::FlushWrite()
 
 	if(len <= 0) return;
 
+	m_frame_vmem_dirty = true;
+
 	GSVector4i r;
 
 	r.left = m_env.TRXPOS.DSAX;
@@ -1340,6 +1348,9 @@ void GSState::FlushPrim()
 
 			m_context->SaveReg();
 
+			m_frame_draws++;
+			m_frame_prims += (u32)(m_index.tail / GSUtil::GetVertexCount(PRIM->PRIM));
+
 			try {
 				Draw();
 			} catch (GSDXRecoverableError&) {
@@ -1485,6 +1496,8 @@ void GSState::Move()
 	int w = m_env.TRXREG.RRW;
 	int h = m_env.TRXREG.RRH;
 
+	m_frame_vmem_dirty = true;
+
 	InvalidateLocalMem(m_env.BITBLTBUF, GSVector4i(sx, sy, sx + w, sy + h));
 	InvalidateVideoMem(m_env.BITBLTBUF, GSVector4i(dx, dy, dx + w, dy + h));
 
@@ -1502,6 +1515,31 @@ void GSState::Move()
 	GSOffset* RESTRICT spo = m_mem.GetOffset(m_env.BITBLTBUF.SBP, m_env.BITBLTBUF.SBW, m_env.BITBLTBUF.SPSM);
 	GSOffset* RESTRICT dpo = m_mem.GetOffset(m_env.BITBLTBUF.DBP, m_env.BITBLTBUF.DBW, m_env.BITBLTBUF.DPSM);
 
+	// Block-aligned same-format moves (the common case: scrolling/blending
+	// tricks copy page or block aligned rects). Source and destination
+	// blocks share the same swizzle, so whole 256 byte blocks can be copied
+	// linearly without the per-pixel address lookups below. 24 bit formats
+	// are excluded as they must preserve the destination's upper byte.
+	if(m_env.BITBLTBUF.SPSM == m_env.BITBLTBUF.DPSM && spsm.trbpp != 24
+		&& xinc > 0 && yinc > 0
+		&& ((sx | dx | w) & (spsm.bs.x - 1)) == 0
+		&& ((sy | dy | h) & (spsm.bs.y - 1)) == 0)
+	{
+		for(int y = 0; y < h; y += spsm.bs.y)
+		{
+			for(int x = 0; x < w; x += spsm.bs.x)
+			{
+				u32 sbn = spsm.bn(sx + x, sy + y, m_env.BITBLTBUF.SBP, m_env.BITBLTBUF.SBW);
+				u32 dbn = spsm.bn(dx + x, dy + y, m_env.BITBLTBUF.DBP, m_env.BITBLTBUF.DBW);
+
+				if(sbn != dbn)
+					memcpy(m_mem.BlockPtr(dbn), m_mem.BlockPtr(sbn), 256);
+			}
+		}
+
+		return;
+	}
+
 	if(spsm.trbpp == dpsm.trbpp && spsm.trbpp >= 16)
 	{
 		int* RESTRICT scol = &spo->pixel.col[0][sx];
@@ -1824,22 +1862,69 @@ template<int index> void GSState::Transfer(const u8* mem, u32 size)
 
 			case GIF_FLG_REGLIST:
 
-				// TODO: do it similar to packed operation
-
-				size *= 2;
+				total = path.nloop * path.nreg; // in GIFReg (64 bit) units
 
-				do
+				if(path.reg == 0 && size * 2 >= total)
 				{
-					(this->*m_fpGIFRegHandlers[path.GetReg() & 0x7F])((GIFReg*)mem);
+					// All data available: resolve the descriptor run once and
+					// process whole loops without StepReg bookkeeping, the
+					// same idea as the packed batch above. nreg == 1 (a run
+					// of a single register) is by far the most common layout.
+
+					GIFRegHandler handlers[16];
+
+					for(u32 i = 0; i < path.nreg; i++)
+					{
+						handlers[i] = m_fpGIFRegHandlers[path.regs.U8[i] & 0x7F];
+					}
+
+					if(path.nreg == 1)
+					{
+						GIFRegHandler handler = handlers[0];
+
+						for(u32 i = 0; i < total; i++)
+						{
+							(this->*handler)((GIFReg*)mem);
+
+							mem += sizeof(GIFReg);
+						}
+					}
+					else
+					{
+						for(u32 i = 0; i < path.nloop; i++)
+						{
+							for(u32 j = 0; j < path.nreg; j++)
+							{
+								(this->*handlers[j])((GIFReg*)mem);
+
+								mem += sizeof(GIFReg);
+							}
+						}
+					}
 
-					mem += sizeof(GIFReg);
-					size--;
+					if(total & 1) mem += sizeof(GIFReg); // data is qword aligned
+
+					size -= (total + 1) / 2;
+
+					path.nloop = 0;
 				}
-				while(path.StepReg() && size > 0);
+				else
+				{
+					size *= 2;
+
+					do
+					{
+						(this->*m_fpGIFRegHandlers[path.GetReg() & 0x7F])((GIFReg*)mem);
+
+						mem += sizeof(GIFReg);
+						size--;
+					}
+					while(path.StepReg() && size > 0);
 
-				if(size & 1) mem += sizeof(GIFReg);
+					if(size & 1) mem += sizeof(GIFReg);
 
-				size /= 2;
+					size /= 2;
+				}
 
 				break;
 
@@ -2164,10 +2249,18 @@ void GSState::UpdateVertexKick()
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFPackedRegHandlerSTQRGBAXYZ2[prim];
 }
 
+// Session high-water mark of the vertex buffer.  A renderer switch or reopen
+// creates a fresh GSState; starting from the largest size any instance
+// reached means a title only pays for the mid-frame growth steps once.
+static int s_vb_highwater = 0;
+
 void GSState::GrowVertexBuffer()
 {
 	int maxcount = std::max<int>(m_vertex.maxcount * 3 / 2, 10000);
 
+	maxcount = std::max<int>(maxcount, s_vb_highwater);
+	s_vb_highwater = maxcount;
+
 	GSVertex* vertex = (GSVertex*)_aligned_malloc(sizeof(GSVertex) * maxcount, 32);
 	u32* index = (u32*)_aligned_malloc(sizeof(u32) * maxcount * 3, 32); // worst case is slightly less than vertex number * 3
 
@@ -176,10 +176,22 @@ protected:
 
 	struct
 	{
-		u32* buff; 
+		u32* buff;
 		size_t tail;
 	} m_index;
 
+	// Per-frame counts of primitives kicked and the device draws they were
+	// merged into (register handlers only flush on a real state change), so
+	// the merge rate can be checked per title. Reset by GSRenderer::VSync.
+	u32 m_frame_prims;
+	u32 m_frame_draws;
+
+	// Set whenever local memory is written (host transfers, local copies,
+	// savestate loads); together with m_frame_draws this tells the merge
+	// path whether anything could have changed the displayed frame since
+	// the last vsync. Latched and cleared by GSRenderer::VSync.
+	bool m_frame_vmem_dirty;
+
 	void UpdateContext();
 	void UpdateScissor();
 
@@ -257,5 +269,10 @@ public:
 	virtual void SetGameCRC(u32 crc, int options);
 	void SetFrameSkip(int skip);
 	void SetRegsMem(u8* basemem);
+
+	// Read-only access to the per-frame counters (reset by GSRenderer::VSync),
+	// used by the gs_replay benchmark to report per-draw timings.
+	u32 GetFramePrims() const {return m_frame_prims;}
+	u32 GetFrameDraws() const {return m_frame_draws;}
 };
 
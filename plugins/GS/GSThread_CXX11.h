@@ -29,6 +29,18 @@
 #include "GS.h"
 #include "Utilities/boost_spsc_queue.hpp"
 
+namespace Threading
+{
+	// Implemented in the core's Utilities (stubbed in GSToolShim for the
+	// standalone tools): groups the calling thread onto the configured NUMA
+	// node, or does nothing when no placement is configured.
+	extern void SetNumaAffinityForSelf();
+
+	// Also from the core's Utilities: how many logical processors are left for
+	// worker pools once the persistent emulation threads are accounted for.
+	extern int GetWorkerThreadBudget();
+}
+
 template<class T, int CAPACITY> class GSJobQueue final
 {
 private:
@@ -43,6 +55,8 @@ private:
 	std::condition_variable m_notempty;
 
 	void ThreadProc() {
+		Threading::SetNumaAffinityForSelf();
+
 		std::unique_lock<std::mutex> l(m_lock);
 
 		while (true) {
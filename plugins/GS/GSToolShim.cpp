@@ -0,0 +1,76 @@
+/*
+ *	Copyright (C) 2007-2009 Gabest
+ *	http://www.gabest.org
+ *
+ *  This Program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This Program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GNU Make; see the file COPYING.  If not, write to
+ *  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA USA.
+ *  http://www.gnu.org/copyleft/gpl.html
+ *
+ */
+
+#include "stdafx.h"
+#include "GSToolShim.h"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+static void shim_log(enum retro_log_level level, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	vfprintf(stderr, fmt, args);
+	va_end(args);
+}
+
+static bool shim_environ(unsigned cmd, void* data)
+{
+	return false;
+}
+
+retro_log_printf_t log_cb = shim_log;
+retro_environment_t environ_cb = shim_environ;
+retro_hw_render_callback hw_render;
+
+int option_upscale_mult = 1;
+int option_pad_left_deadzone = 0;
+int option_pad_right_deadzone = 0;
+bool option_palette_conversion = false;
+bool hack_fb_conversion = false;
+bool hack_AutoFlush = false;
+bool hack_fast_invalidation = false;
+
+std::string sel_bios_path;
+std::string retroarch_system_path;
+
+void ResetContentStuffs()
+{
+}
+
+namespace Threading
+{
+	// The tools run single-instance with no placement configured.
+	void SetNumaAffinityForSelf()
+	{
+	}
+
+	// The tools have no persistent emulation threads, only the replay loop.
+	int GetWorkerThreadBudget()
+	{
+		int cores = (int)std::thread::hardware_concurrency();
+		return std::max(1, cores - 1);
+	}
+}
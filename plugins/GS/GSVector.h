@@ -101,6 +101,7 @@ class GSVector8i;
 #include "GSVector4.h"
 #include "GSVector8i.h"
 #include "GSVector8.h"
+#include "GSVector16i.h"
 
 // conversion
 
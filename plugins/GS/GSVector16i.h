@@ -0,0 +1,123 @@
+/*
+ *	Copyright (C) 2007-2009 Gabest
+ *	http://www.gabest.org
+ *
+ *  This Program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This Program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GNU Make; see the file COPYING.  If not, write to
+ *  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA USA.
+ *  http://www.gnu.org/copyleft/gpl.html
+ *
+ */
+
+#include "Pcsx2Types.h"
+
+#include "stdafx.h"
+
+#if GS_AVX512
+
+// 512-bit integer vector. Unlike GSVector4i/GSVector8i this is not a full
+// blown vector class: the scanline code generators top out at AVX2, so the
+// only consumers are the plain C++ kernels (block fills and similar
+// memory-bound loops) that just need wide loads, stores and logic ops with
+// masking. Grow it as those kernels grow.
+class alignas(64) GSVector16i
+{
+public:
+	union
+	{
+		int v[16];
+		float F32[16];
+		s8    I8[64];
+		s16 I16[32];
+		s32 I32[16];
+		s64 I64[8];
+		u8  U8[64];
+		u16 U16[32];
+		u32 U32[16];
+		u64 U64[8];
+		__m512i m;
+	};
+
+	__forceinline GSVector16i() {}
+
+	__forceinline explicit GSVector16i(int i)
+	{
+		m = _mm512_set1_epi32(i);
+	}
+
+	__forceinline GSVector16i(__m512i m)
+	{
+		this->m = m;
+	}
+
+	__forceinline void operator = (__m512i m)
+	{
+		this->m = m;
+	}
+
+	__forceinline operator __m512i() const
+	{
+		return m;
+	}
+
+	// Repeats the 128-bit pattern across all four lanes.
+	__forceinline static GSVector16i broadcast128(const GSVector4i& v)
+	{
+		return GSVector16i(_mm512_broadcast_i32x4(v.m));
+	}
+
+#if _M_SSE >= 0x501
+
+	// Repeats the 256-bit pattern across both halves.
+	__forceinline static GSVector16i broadcast256(const GSVector8i& v)
+	{
+		return GSVector16i(_mm512_broadcast_i64x4(v.m));
+	}
+
+#endif
+
+	// The fill kernels walk swizzled block offsets, which are only guaranteed
+	// to be 32-byte aligned, so loads/stores go through the unaligned forms
+	// (same cost on aligned addresses with AVX-512).
+	__forceinline static GSVector16i load(const void* p)
+	{
+		return GSVector16i(_mm512_loadu_si512(p));
+	}
+
+	__forceinline static void store(void* p, const GSVector16i& v)
+	{
+		_mm512_storeu_si512(p, v.m);
+	}
+
+	__forceinline GSVector16i andnot(const GSVector16i& v) const
+	{
+		return GSVector16i(_mm512_andnot_si512(v.m, m));
+	}
+
+	__forceinline friend GSVector16i operator & (const GSVector16i& v1, const GSVector16i& v2)
+	{
+		return GSVector16i(_mm512_and_si512(v1.m, v2.m));
+	}
+
+	__forceinline friend GSVector16i operator | (const GSVector16i& v1, const GSVector16i& v2)
+	{
+		return GSVector16i(_mm512_or_si512(v1.m, v2.m));
+	}
+
+	__forceinline friend GSVector16i operator ^ (const GSVector16i& v1, const GSVector16i& v2)
+	{
+		return GSVector16i(_mm512_xor_si512(v1.m, v2.m));
+	}
+};
+
+#endif
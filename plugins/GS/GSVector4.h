@@ -308,7 +308,7 @@ public:
 
 	__forceinline GSVector4 madd(const GSVector4& a, const GSVector4& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector4(_mm_fmadd_ps(m, a, b));
 		
@@ -321,7 +321,7 @@ public:
 
 	__forceinline GSVector4 msub(const GSVector4& a, const GSVector4& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector4(_mm_fmsub_ps(m, a, b));
 		
@@ -334,7 +334,7 @@ public:
 
 	__forceinline GSVector4 nmadd(const GSVector4& a, const GSVector4& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector4(_mm_fnmadd_ps(m, a, b));
 		
@@ -347,7 +347,7 @@ public:
 
 	__forceinline GSVector4 nmsub(const GSVector4& a, const GSVector4& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector4(_mm_fnmsub_ps(m, a, b));
 		
@@ -23,6 +23,8 @@
 
 #include "stdafx.h"
 
+#include "Utilities/Crc32.h"
+
 class alignas(16) GSVector4i
 {
 	static GSVector4i m_xff[17];
@@ -1969,6 +1971,13 @@ public:
 		return true;
 	}
 
+	// CRC-32C page hasher companion to the compare kernels above; hardware
+	// crc32 when the build targets SSE4.2, table fallback otherwise.
+	__forceinline static u32 crc32c(u32 crc, const void* data, size_t size)
+	{
+		return crc32c_update(crc, data, size);
+	}
+
 	__forceinline static bool update(const void* dst, const void* src, size_t size)
 	{
 		ASSERT((size & 15) == 0);
@@ -266,7 +266,7 @@ public:
 
 	__forceinline GSVector8 madd(const GSVector8& a, const GSVector8& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector8(_mm256_fmadd_ps(m, a, b));
 		
@@ -279,7 +279,7 @@ public:
 
 	__forceinline GSVector8 msub(const GSVector8& a, const GSVector8& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector8(_mm256_fmsub_ps(m, a, b));
 		
@@ -292,7 +292,7 @@ public:
 
 	__forceinline GSVector8 nmadd(const GSVector8& a, const GSVector8& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector8(_mm256_fnmadd_ps(m, a, b));
 		
@@ -305,7 +305,7 @@ public:
 
 	__forceinline GSVector8 nmsub(const GSVector8& a, const GSVector8& b) const
 	{
-		#if 0//_M_SSE >= 0x501
+		#if defined(__FMA__)
 
 		return GSVector8(_mm256_fnmsub_ps(m, a, b));
 		
@@ -25,7 +25,8 @@
 #include "fxaa_shader.h"
 
 GSDevice::GSDevice()
-	: m_rbswapped(false)
+	: m_pool_mem(0)
+	, m_rbswapped(false)
 	, m_backbuffer(NULL)
 	, m_merge(NULL)
 	, m_weavebob(NULL)
@@ -60,6 +61,7 @@ bool GSDevice::Reset(int w, int h)
 	for(auto t : m_pool) delete t;
 
 	m_pool.clear();
+	m_pool_mem = 0;
 
 	delete m_backbuffer;
 	delete m_merge;
@@ -124,6 +126,8 @@ GSTexture* GSDevice::FetchSurface(int type, int w, int h, int format)
 
 		if(t->GetType() == type && t->GetFormat() == format && t->GetSize() == size)
 		{
+			m_pool_mem -= t->GetMemUsage();
+
 			m_pool.erase(i);
 
 			return t;
@@ -154,11 +158,17 @@ void GSDevice::Recycle(GSTexture* t)
 		t->last_frame_used = m_frame;
 
 		m_pool.push_front(t);
+		m_pool_mem += t->GetMemUsage();
 
 		//printf("%d\n",m_pool.size());
 
-		while(m_pool.size() > 300)
+		// Trim the oldest entries by byte budget as well as by count; a
+		// count-only cap lets a few hundred upscaled render targets pin
+		// gigabytes of VRAM, which then evicts live cache content instead.
+		while(m_pool.size() > 300 || (m_pool_mem > MAX_POOL_MEM && m_pool.size() > 40))
 		{
+			m_pool_mem -= m_pool.back()->GetMemUsage();
+
 			delete m_pool.back();
 
 			m_pool.pop_back();
@@ -172,6 +182,8 @@ void GSDevice::AgePool()
 
 	while(m_pool.size() > 40 && m_frame - m_pool.back()->last_frame_used > 10)
 	{
+		m_pool_mem -= m_pool.back()->GetMemUsage();
+
 		delete m_pool.back();
 
 		m_pool.pop_back();
@@ -187,6 +199,8 @@ void GSDevice::PurgePool()
 
 		m_pool.pop_back();
 	}
+
+	m_pool_mem = 0;
 }
 
 GSTexture* GSDevice::CreateSparseRenderTarget(int w, int h, int format)
@@ -111,6 +111,12 @@ class GSDevice : public GSAlignedClass<32>
 {
 private:
 	FastList<GSTexture*> m_pool;
+	// Total GetMemUsage() of the textures parked in m_pool.  The pool is
+	// trimmed by this byte budget rather than only by entry count: at high
+	// upscale factors 300 parked render targets can hold gigabytes of VRAM
+	// hostage, which is exactly the pressure that causes eviction churn.
+	size_t m_pool_mem;
+	static const size_t MAX_POOL_MEM = 256 * 1024 * 1024;
 	static std::array<HWBlend, 3*3*3*3 + 1> m_blendMap;
 
 protected:
@@ -163,6 +169,11 @@ public:
 	virtual void Present(GSTexture* sTex, GSTexture* dTex, const GSVector4& dRect, int shader = 0);
 	virtual void Flip() {  }
 
+	// Called once per frame from VSync: closes the current GPU timing
+	// interval and returns the newest interval whose result has landed, in
+	// microseconds.  Backends without timer queries return 0.
+	virtual u32 GetGPUTimeUs() { return 0; }
+
 	virtual void BeginScene() {}
 	virtual void DrawPrimitive() {};
 	virtual void DrawIndexedPrimitive() {}
@@ -43,11 +43,21 @@ protected:
 
 	ActivePtr* m_active;
 
+	// Selectors repeat heavily between consecutive draws, so remember the
+	// last lookup and skip the hash probe when the key matches.  BeginDraw
+	// hits these maps up to three times per draw on every worker thread.
+	KEY m_last_key;
+	VALUE m_last_value;
+	bool m_last_valid;
+
 	virtual VALUE GetDefaultFunction(KEY key) = 0;
 
 public:
 	GSFunctionMap()
 		: m_active(NULL)
+		, m_last_key(KEY())
+		, m_last_value(NULL)
+		, m_last_valid(false)
 	{
 	}
 
@@ -58,6 +68,9 @@ public:
 
 	VALUE operator [] (KEY key)
 	{
+		if(m_last_valid && m_last_key == key)
+			return m_last_value;
+
 		m_active = NULL;
 
 		auto it = m_map_active.find(key);
@@ -74,14 +87,18 @@ public:
 
 			memset(p, 0, sizeof(*p));
 
-			p->f = (i != m_map.end()) 
-				? i->second 
+			p->f = (i != m_map.end())
+				? i->second
 				: GetDefaultFunction(key);
 
 			m_active = m_map_active[key] = p;
 		}
 
-		return m_active->f;
+		m_last_key = key;
+		m_last_value = m_active->f;
+		m_last_valid = true;
+
+		return m_last_value;
 	}
 };
 
@@ -20,12 +20,19 @@
  */
 
 #include "GSRenderer.h"
+#include "options_tools.h"
 
 GSRenderer::GSRenderer()
 	: m_texture_shuffle(false)
 	, m_real_size(0,0)
+	, m_merge_stat_frames(0)
+	, m_merge_stat_prims(0)
+	, m_merge_stat_draws(0)
+	, m_gpu_time_us(0)
+	, m_merge_inputs_dirty(true)
 	, m_dev(NULL)
 {
+	memset(&m_last_merge, 0, sizeof(m_last_merge));
 	const unsigned int s_interlace_nb = 8;
 	m_interlace   = theApp.GetConfigI("interlace") % s_interlace_nb;
 	m_aa1         = theApp.GetConfigB("aa1");
@@ -77,6 +84,36 @@ bool GSRenderer::Merge(int field)
 	if(!en[0] && !en[1])
 		return false;
 
+	// If nothing touched local memory and no draw was kicked since the last
+	// vsync, and the PCRTC is scanning out the same frame the same way, the
+	// merged (and deinterlaced) output from the previous vsync is still
+	// exact - skip straight to presenting it. 30fps titles that idle every
+	// other vsync and paused/menu screens hit this a lot. The field parity
+	// in the snapshot keeps field-dependent interlace modes honest: their
+	// inputs change every vsync, so they never match.
+	MergeInputs inputs;
+
+	memset(&inputs, 0, sizeof(inputs));
+
+	inputs.pmode      = m_regs->PMODE.U64;
+	inputs.smode2     = m_regs->SMODE2.U64;
+	inputs.bgcolor    = m_regs->BGCOLOR.U64;
+	inputs.extbuf     = m_regs->EXTBUF.U64;
+	inputs.extwrite   = m_regs->EXTWRITE.U64;
+	inputs.dispfb[0]  = en[0] ? m_regs->DISP[0].DISPFB.U64 : 0;
+	inputs.dispfb[1]  = en[1] ? m_regs->DISP[1].DISPFB.U64 : 0;
+	inputs.display[0] = en[0] ? m_regs->DISP[0].DISPLAY.U64 : 0;
+	inputs.display[1] = en[1] ? m_regs->DISP[1].DISPLAY.U64 : 0;
+	inputs.field      = field;
+	inputs.interlace  = m_interlace;
+	inputs.fxaa       = m_fxaa;
+
+	if(!m_merge_inputs_dirty && m_dev->GetCurrent() && memcmp(&inputs, &m_last_merge, sizeof(inputs)) == 0)
+		return true;
+
+	m_last_merge = inputs;
+	m_merge_inputs_dirty = false;
+
 	for(int i = 0; i < 2; i++)
 	{
 		if(en[i])
@@ -271,6 +308,37 @@ void GSRenderer::VSync(int field)
 {
 	Flush();
 
+	// Close this frame's GPU timing interval and open the next one; runs
+	// even on skipped frames so the intervals stay frame-aligned.
+	m_gpu_time_us = m_dev->GetGPUTimeUs();
+
+	// The register handlers only flush on a real state change, so the
+	// prims-per-draw ratio shows how well consecutive draws merged.
+	m_merge_stat_prims  += m_frame_prims;
+	m_merge_stat_draws  += m_frame_draws;
+	m_merge_stat_frames += 1;
+
+	// Anything that could have changed the displayed frame since the last
+	// vsync invalidates the cached merge output (checked in Merge below).
+	m_merge_inputs_dirty |= m_frame_vmem_dirty || m_frame_draws != 0;
+	m_frame_vmem_dirty = false;
+
+	m_frame_prims = 0;
+	m_frame_draws = 0;
+
+	if(m_merge_stat_frames == 600)
+	{
+		if(m_merge_stat_draws > 0)
+			log_cb(RETRO_LOG_DEBUG, "GS: %llu prims in %llu draws over %u frames (%.1f prims/draw, %.1f draws/frame)\n",
+				(unsigned long long)m_merge_stat_prims, (unsigned long long)m_merge_stat_draws, m_merge_stat_frames,
+				(double)m_merge_stat_prims / (double)m_merge_stat_draws,
+				(double)m_merge_stat_draws / (double)m_merge_stat_frames);
+
+		m_merge_stat_frames = 0;
+		m_merge_stat_prims  = 0;
+		m_merge_stat_draws  = 0;
+	}
+
 	if(!Merge(field ? 1 : 0))
 		return;
 
@@ -288,4 +356,7 @@ void GSRenderer::PurgePool()
 
 void GSRenderer::UpdateRendererOptions()
 {
+	// Renderer options can change what the merge output looks like without
+	// any register or memory traffic, so drop the cached merge.
+	m_merge_inputs_dirty = true;
 }
@@ -36,6 +36,31 @@ protected:
 	bool m_texture_shuffle;
 	GSVector2i m_real_size;
 
+	// Accumulated draw-merge statistics, reported periodically from VSync().
+	u32 m_merge_stat_frames;
+	u64 m_merge_stat_prims;
+	u64 m_merge_stat_draws;
+
+	// Newest completed whole-frame GPU time from the device's timer
+	// queries, refreshed once per VSync().
+	u32 m_gpu_time_us;
+
+	// Snapshot of the PCRTC state that produced the last merge. When it
+	// matches and nothing wrote local memory or drew since the previous
+	// vsync, the device still holds the merged output and Merge() can
+	// re-present it without running the merge/interlace passes again.
+	// The field parity is part of the snapshot, so field-dependent
+	// deinterlacing modes (weave/bob) never take the shortcut.
+	struct MergeInputs
+	{
+		u64 pmode, smode2, bgcolor, extbuf, extwrite;
+		u64 dispfb[2], display[2];
+		int field, interlace, fxaa;
+	};
+
+	MergeInputs m_last_merge;
+	bool m_merge_inputs_dirty;
+
 	virtual GSTexture* GetOutput(int i, int& y_offset) = 0;
 	virtual GSTexture* GetFeedbackOutput() { return nullptr; }
 
@@ -55,6 +80,7 @@ public:
 	virtual int GetUpscaleMultiplier() {return 1;}
 	virtual GSVector2i GetCustomResolution() {return GSVector2i(0,0);}
 	GSVector2i GetInternalResolution();
+	u32 GetGPUTimeUs() const { return m_gpu_time_us; }
 
 	void PurgePool();
 };
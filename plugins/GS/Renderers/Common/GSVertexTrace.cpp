@@ -39,8 +39,10 @@ GSVertexTrace::GSVertexTrace(const GSState* state)
 	memset(&m_alpha, 0, sizeof(m_alpha));
 
 	#define InitUpdate3(P, IIP, TME, FST, COLOR) \
-		m_fmm[0][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 0>; \
-		m_fmm[1][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 1>; \
+		m_fmm[0][0][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 0, 0>; \
+		m_fmm[0][1][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 1, 0>; \
+		m_fmm[1][0][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 0, 1>; \
+		m_fmm[1][1][COLOR][FST][TME][IIP][P] = &GSVertexTrace::FindMinMax<P, IIP, TME, FST, COLOR, 1, 1>; \
 
 	#define InitUpdate2(P, IIP, TME) \
 		InitUpdate3(P, IIP, TME, 0, 0) \
@@ -69,7 +71,34 @@ void GSVertexTrace::Update(const void* vertex, const u32* index, int v_count, in
 	u32 fst = m_state->PRIM->FST;
 	u32 color = !(m_state->PRIM->TME && m_state->m_context->TEX0.TFX == TFX_DECAL && m_state->m_context->TEX0.TCC);
 
-	(this->*m_fmm[m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
+	// List prims emit a strictly sequential index stream (VertexKick rolls
+	// the tail back on skipped prims), in which case FindMinMax can drop the
+	// indirection and stream the vertex buffer linearly. Verifying reads 4
+	// bytes per index against the 32 per vertex the scan touches.
+	u32 linear = 0;
+
+	if(i_count > 0 && index[i_count - 1] == (u32)(i_count - 1))
+	{
+		const GSVector4i four(4, 4, 4, 4);
+
+		GSVector4i seq(0, 1, 2, 3);
+		GSVector4i eq = GSVector4i::xffffffff();
+
+		int i = 0;
+
+		for(; i < (i_count & ~3); i += 4)
+		{
+			eq &= GSVector4i::load<false>(&index[i]).eq32(seq);
+			seq = seq.add32(four);
+		}
+
+		linear = eq.alltrue();
+
+		for(; i < i_count; i++)
+			linear &= index[i] == (u32)i;
+	}
+
+	(this->*m_fmm[linear][m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
 
 	// Potential float overflow detected. Better uses the slower division instead
 	// Note: If Q is too big, 1/Q will end up as 0. 1e30 is a random number
@@ -79,7 +108,7 @@ void GSVertexTrace::Update(const void* vertex, const u32* index, int v_count, in
 		log_cb(RETRO_LOG_ERROR, "Vertex Trace: float overflow detected ! min %e max %e\n", m_min.t.z, m_max.t.z);
 #endif
 		m_accurate_stq = true;
-		(this->*m_fmm[m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
+		(this->*m_fmm[linear][m_accurate_stq][color][fst][tme][iip][primclass])(vertex, index, i_count);
 	}
 
 	m_eq.value = (m_min.c == m_max.c).mask() | ((m_min.p == m_max.p).mask() << 16) | ((m_min.t == m_max.t).mask() << 20);
@@ -157,9 +186,13 @@ void GSVertexTrace::Update(const void* vertex, const u32* index, int v_count, in
 	}
 }
 
-template<GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, u32 accurate_stq>
+template<GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, u32 accurate_stq, u32 linear>
 void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 {
+	// When linear, Update verified the index stream is the identity, so the
+	// vertex buffer can be streamed directly without the indirection.
+	#define VTX(o) v[linear ? (size_t)(i + (o)) : (size_t)index[i + (o)]]
+
 	const GSDrawingContext* context = m_state->m_context;
 
 	int n = 1;
@@ -201,7 +234,7 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 	{
 		if(primclass == GS_POINT_CLASS)
 		{
-			GSVector4i c(v[index[i]].m[0]);
+			GSVector4i c(VTX(0).m[0]);
 
 			if(color)
 			{
@@ -227,7 +260,7 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 				else
 				{
-					GSVector4i uv(v[index[i]].m[1]);
+					GSVector4i uv(VTX(0).m[1]);
 
 					GSVector4 st = GSVector4(uv.uph16()).xyxy();
 
@@ -236,7 +269,7 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 			}
 
-			GSVector4i xyzf(v[index[i]].m[1]);
+			GSVector4i xyzf(VTX(0).m[1]);
 
 			GSVector4i xy = xyzf.upl16();
 			GSVector4i z = xyzf.yyyy();
@@ -259,8 +292,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 		}
 		else if(primclass == GS_LINE_CLASS)
 		{
-			GSVector4i c0(v[index[i + 0]].m[0]);
-			GSVector4i c1(v[index[i + 1]].m[0]);
+			GSVector4i c0(VTX(0).m[0]);
+			GSVector4i c1(VTX(1).m[0]);
 
 			if(color)
 			{
@@ -303,8 +336,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 				else
 				{
-					GSVector4i uv0(v[index[i + 0]].m[1]);
-					GSVector4i uv1(v[index[i + 1]].m[1]);
+					GSVector4i uv0(VTX(0).m[1]);
+					GSVector4i uv1(VTX(1).m[1]);
 
 					GSVector4 st0 = GSVector4(uv0.uph16()).xyxy();
 					GSVector4 st1 = GSVector4(uv1.uph16()).xyxy();
@@ -314,8 +347,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 			}
 
-			GSVector4i xyzf0(v[index[i + 0]].m[1]);
-			GSVector4i xyzf1(v[index[i + 1]].m[1]);
+			GSVector4i xyzf0(VTX(0).m[1]);
+			GSVector4i xyzf1(VTX(1).m[1]);
 
 			GSVector4i xy0 = xyzf0.upl16();
 			GSVector4i z0 = xyzf0.yyyy();
@@ -342,9 +375,9 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 		}
 		else if(primclass == GS_TRIANGLE_CLASS)
 		{
-			GSVector4i c0(v[index[i + 0]].m[0]);
-			GSVector4i c1(v[index[i + 1]].m[0]);
-			GSVector4i c2(v[index[i + 2]].m[0]);
+			GSVector4i c0(VTX(0).m[0]);
+			GSVector4i c1(VTX(1).m[0]);
+			GSVector4i c2(VTX(2).m[0]);
 
 			if(color)
 			{
@@ -390,9 +423,9 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 				else
 				{
-					GSVector4i uv0(v[index[i + 0]].m[1]);
-					GSVector4i uv1(v[index[i + 1]].m[1]);
-					GSVector4i uv2(v[index[i + 2]].m[1]);
+					GSVector4i uv0(VTX(0).m[1]);
+					GSVector4i uv1(VTX(1).m[1]);
+					GSVector4i uv2(VTX(2).m[1]);
 
 					GSVector4 st0 = GSVector4(uv0.uph16()).xyxy();
 					GSVector4 st1 = GSVector4(uv1.uph16()).xyxy();
@@ -403,9 +436,9 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 			}
 
-			GSVector4i xyzf0(v[index[i + 0]].m[1]);
-			GSVector4i xyzf1(v[index[i + 1]].m[1]);
-			GSVector4i xyzf2(v[index[i + 2]].m[1]);
+			GSVector4i xyzf0(VTX(0).m[1]);
+			GSVector4i xyzf1(VTX(1).m[1]);
+			GSVector4i xyzf2(VTX(2).m[1]);
 
 			GSVector4i xy0 = xyzf0.upl16();
 			GSVector4i z0 = xyzf0.yyyy();
@@ -436,8 +469,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 		}
 		else if(primclass == GS_SPRITE_CLASS)
 		{
-			GSVector4i c0(v[index[i + 0]].m[0]);
-			GSVector4i c1(v[index[i + 1]].m[0]);
+			GSVector4i c0(VTX(0).m[0]);
+			GSVector4i c1(VTX(1).m[0]);
 
 			if(color)
 			{
@@ -480,8 +513,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 				else
 				{
-					GSVector4i uv0(v[index[i + 0]].m[1]);
-					GSVector4i uv1(v[index[i + 1]].m[1]);
+					GSVector4i uv0(VTX(0).m[1]);
+					GSVector4i uv1(VTX(1).m[1]);
 
 					GSVector4 st0 = GSVector4(uv0.uph16()).xyxy();
 					GSVector4 st1 = GSVector4(uv1.uph16()).xyxy();
@@ -491,8 +524,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 				}
 			}
 
-			GSVector4i xyzf0(v[index[i + 0]].m[1]);
-			GSVector4i xyzf1(v[index[i + 1]].m[1]);
+			GSVector4i xyzf0(VTX(0).m[1]);
+			GSVector4i xyzf1(VTX(1).m[1]);
 
 			GSVector4i xy0 = xyzf0.upl16();
 			GSVector4i z0 = xyzf0.yyyy();
@@ -567,6 +600,8 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 		m_min.c = GSVector4i::zero();
 		m_max.c = GSVector4i::zero();
 	}
+
+	#undef VTX
 }
 
 void GSVertexTrace::CorrectDepthTrace(const void* vertex, int count)
@@ -417,8 +417,12 @@ const char interlace_shader_raw[] =
 "}\n"
 "#endif\n";
 
+GSDevice11* g_gs_device11 = nullptr;
+
 GSDevice11::GSDevice11()
 {
+	m_deferred = false;
+
 	memset(&m_state, 0, sizeof(m_state));
 
 	m_state.topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
@@ -500,10 +504,30 @@ bool GSDevice11::Create()
 
 	m_dev = d3d11->device;
 	m_ctx = d3d11->context;
+	m_ctx_imm = m_ctx;
+
+	// Optionally record draws and uploads on a deferred context and replay
+	// them on the frontend's immediate context at flip time. This keeps the
+	// GS thread out of the driver for most of the frame.
+	if(theApp.GetConfigB("dx11_deferred_context"))
+	{
+		CComPtr<ID3D11DeviceContext> deferred;
+
+		if(SUCCEEDED(m_dev->CreateDeferredContext(0, &deferred)))
+		{
+			m_ctx = deferred;
+			m_deferred = true;
+		}
+	}
+
+	g_gs_device11 = this;
+
 	D3D_FEATURE_LEVEL level = d3d11->featureLevel;
 	if(!SetFeatureLevel(level, true))
 		return false;
 
+	LoadShaderCache();
+
 	// Set maximum texture size limit based on supported feature level.
 	if (level >= D3D_FEATURE_LEVEL_11_0)
 		m_d3d_texsize = D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION;
@@ -730,16 +754,35 @@ bool GSDevice11::Reset(int w, int h)
 	return true;
 }
 
+void GSDevice11::ExecuteDeferred()
+{
+	if(!m_deferred)
+		return;
+
+	CComPtr<ID3D11CommandList> cl;
+
+	// TRUE keeps the recorded pipeline state on m_ctx, so the state restore
+	// below and the next frame's draws carry on from where we left off.
+	if(SUCCEEDED(m_ctx->FinishCommandList(TRUE, &cl)) && cl)
+		m_ctx_imm->ExecuteCommandList(cl, FALSE);
+}
+
 void GSDevice11::Flip()
 {
 //	if(!m_current)
 //		return;
 
+	// Replay the frame's recorded commands before handing the backbuffer to
+	// the frontend. The frontend reads the texture we bind to PS slot 0 on
+	// the immediate context, and ExecuteCommandList clears immediate state,
+	// so these two binds must go to m_ctx_imm after the replay.
+	ExecuteDeferred();
+
 	ID3D11RenderTargetView *nullView = nullptr;
-	m_ctx->OMSetRenderTargets(1, &nullView, nullptr);
+	m_ctx_imm->OMSetRenderTargets(1, &nullView, nullptr);
 
 	ID3D11ShaderResourceView* srv = *(GSTexture11*)m_backbuffer;
-	m_ctx->PSSetShaderResources(0, 1, &srv);
+	m_ctx_imm->PSSetShaderResources(0, 1, &srv);
 
 	extern retro_video_refresh_t video_cb;
 	video_cb(RETRO_HW_FRAME_BUFFER_VALID, m_backbuffer->GetWidth(), m_backbuffer->GetHeight(), 0);
@@ -1560,6 +1603,127 @@ void GSDevice11::OMSetRenderTargets(GSTexture* rt, GSTexture* ds, const GSVector
 	}
 }
 
+// --------------------------------------------------------------------------------------
+//  On-disk shader bytecode cache
+// --------------------------------------------------------------------------------------
+// D3DCompile of a new tfx permutation is slow enough to drop several frames the first
+// time a scene hits it.  Compiled bytecode is stable for a given source, macro set and
+// compile flags, so results are persisted under the frontend's system directory and
+// replayed on the next run; with a warm cache a SetupPS miss is just a CreateBlob plus
+// a memcpy.  Records are appended as they compile, so the cache warms up incrementally
+// and covers exactly the permutations the user's games actually need.
+
+struct ShaderCacheHeader
+{
+	u32 magic;
+	u32 version;
+	u32 flags;
+	u32 reserved;
+};
+
+static const u32 ShaderCacheMagic = 0x47535843; // 'GSXC'
+static const u32 ShaderCacheVersion = 1;
+
+static u64 ShaderCacheHash(u64 h, const void* data, size_t size)
+{
+	const u8* p = (const u8*)data;
+
+	for(size_t i = 0; i < size; i++)
+	{
+		h = (h ^ p[i]) * 0x100000001b3ull;
+	}
+
+	return h;
+}
+
+static u64 ShaderCacheKey(const std::vector<char>& source, const char* entry, const D3D_SHADER_MACRO* macro, const std::string& shader_model)
+{
+	u64 h = 0xcbf29ce484222325ull;
+
+	h = ShaderCacheHash(h, source.data(), source.size());
+	h = ShaderCacheHash(h, entry, strlen(entry) + 1);
+	h = ShaderCacheHash(h, shader_model.c_str(), shader_model.size() + 1);
+
+	for(; macro && macro->Name; macro++)
+	{
+		h = ShaderCacheHash(h, macro->Name, strlen(macro->Name) + 1);
+		h = ShaderCacheHash(h, macro->Definition, strlen(macro->Definition) + 1);
+	}
+
+	return h;
+}
+
+void GSDevice11::LoadShaderCache()
+{
+	m_shader_cache.clear();
+
+	if(retroarch_system_path.empty())
+		return;
+
+	m_shader_cache_path = retroarch_system_path + "/pcsx2/dx11_shaders.cache";
+
+	u32 flags = 0;
+
+#ifdef _DEBUG
+	flags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_AVOID_FLOW_CONTROL;
+#endif
+
+	if(FILE* fp = fopen(m_shader_cache_path.c_str(), "rb"))
+	{
+		ShaderCacheHeader hdr;
+
+		bool valid = fread(&hdr, sizeof(hdr), 1, fp) == 1
+			&& hdr.magic == ShaderCacheMagic
+			&& hdr.version == ShaderCacheVersion
+			&& hdr.flags == flags;
+
+		while(valid)
+		{
+			u64 key;
+			u32 size;
+
+			if(fread(&key, sizeof(key), 1, fp) != 1)
+				break;
+
+			if(fread(&size, sizeof(size), 1, fp) != 1 || size == 0 || size > (4u << 20))
+			{
+				valid = false;
+				break;
+			}
+
+			std::vector<u8> blob(size);
+
+			if(fread(blob.data(), 1, size, fp) != size)
+			{
+				valid = false;
+				break;
+			}
+
+			m_shader_cache[key] = std::move(blob);
+		}
+
+		fclose(fp);
+
+		if(valid)
+		{
+			log_cb(RETRO_LOG_INFO, "D3D11 shader cache: loaded %zu precompiled permutations\n", m_shader_cache.size());
+			return;
+		}
+
+		// Stale or truncated cache (different compile flags, changed shader source,
+		// or an interrupted write) - start over rather than replay untrusted bytecode.
+		m_shader_cache.clear();
+	}
+
+	if(FILE* fp = fopen(m_shader_cache_path.c_str(), "wb"))
+	{
+		const ShaderCacheHeader hdr = {ShaderCacheMagic, ShaderCacheVersion, flags, 0};
+
+		fwrite(&hdr, sizeof(hdr), 1, fp);
+		fclose(fp);
+	}
+}
+
 GSDevice11::ShaderMacro::ShaderMacro(std::string& smodel)
 {
 	mlist.emplace_back("SHADER_MODEL", smodel);
@@ -1646,6 +1810,20 @@ void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn,
 	flags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_AVOID_FLOW_CONTROL;
 #endif
 
+	const u64 key = ShaderCacheKey(source, entry, macro, shader_model);
+
+	const auto i = m_shader_cache.find(key);
+
+	if (i != m_shader_cache.end())
+	{
+		if (SUCCEEDED(D3DCreateBlob(i->second.size(), shader)))
+		{
+			memcpy((*shader)->GetBufferPointer(), i->second.data(), i->second.size());
+
+			return;
+		}
+	}
+
 	const HRESULT hr = D3DCompile(
 		source.data(), source.size(), fn, macro,
 		include, entry, shader_model.c_str(),
@@ -1657,6 +1835,24 @@ void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn,
 
 	if (FAILED(hr))
 		throw GSDXRecoverableError();
+
+	// Persist the fresh bytecode so the next run skips D3DCompile entirely.
+
+	const u8* data = (const u8*)(*shader)->GetBufferPointer();
+	const u32 size = (u32)(*shader)->GetBufferSize();
+
+	m_shader_cache[key] = std::vector<u8>(data, data + size);
+
+	if (!m_shader_cache_path.empty())
+	{
+		if (FILE* fp = fopen(m_shader_cache_path.c_str(), "ab"))
+		{
+			fwrite(&key, sizeof(key), 1, fp);
+			fwrite(&size, sizeof(size), 1, fp);
+			fwrite(data, 1, size, fp);
+			fclose(fp);
+		}
+	}
 }
 
 u16 GSDevice11::ConvertBlendEnum(u16 generic)
@@ -391,6 +391,8 @@ private:
 	CComPtr<IDXGIFactory2> m_factory;
 	CComPtr<ID3D11Device> m_dev;
 	CComPtr<ID3D11DeviceContext> m_ctx;
+	CComPtr<ID3D11DeviceContext> m_ctx_imm; // immediate context; m_ctx may be a deferred recording context
+	bool m_deferred;
 	CComPtr<ID3D11Buffer> m_vb;
 	CComPtr<ID3D11Buffer> m_vb_old;
 	CComPtr<ID3D11Buffer> m_ib;
@@ -477,6 +479,13 @@ private:
 	std::unordered_map<u32, CComPtr<ID3D11DepthStencilState>> m_om_dss;
 	std::unordered_map<u32, CComPtr<ID3D11BlendState>> m_om_bs;
 
+	// Compiled bytecode persisted across runs, keyed by a hash of the shader
+	// source, entry point, model and macro set.  See LoadShaderCache().
+	std::unordered_map<u64, std::vector<u8>> m_shader_cache;
+	std::string m_shader_cache_path;
+
+	void LoadShaderCache();
+
 	VSConstantBuffer m_vs_cb_cache;
 	GSConstantBuffer m_gs_cb_cache;
 	PSConstantBuffer m_ps_cb_cache;
@@ -548,6 +557,13 @@ public:
 	operator ID3D11Device*() {return m_dev;}
 	operator ID3D11DeviceContext*() {return m_ctx;}
 
+	// Deferred recording support (dx11_deferred_context). Draws and uploads
+	// are recorded on m_ctx and executed on the immediate context at the
+	// frame flip, or earlier when a staging readback needs the results.
+	bool IsDeferred() const {return m_deferred;}
+	ID3D11DeviceContext* RecordingContext() {return m_ctx;}
+	void ExecuteDeferred();
+
 	void CreateShader(const std::vector<char>& source, const char* fn, ID3DInclude* include, const char* entry, D3D_SHADER_MACRO* macro, ID3D11VertexShader** vs, D3D11_INPUT_ELEMENT_DESC* layout, int count, ID3D11InputLayout** il);
 	void CreateShader(const std::vector<char> &source, const char* fn, ID3DInclude* include, const char* entry, D3D_SHADER_MACRO* macro, ID3D11GeometryShader** gs);
 	void CreateShader(const std::vector<char> &source, const char* fn, ID3DInclude *include, const char* entry, D3D_SHADER_MACRO* macro, ID3D11PixelShader** ps);
@@ -555,3 +571,7 @@ public:
 	void CompileShader(const std::vector<char> &source, const char* fn, ID3DInclude *include, const char* entry, D3D_SHADER_MACRO* macro, ID3DBlob** shader, std::string shader_model);
 };
 
+// The current device, so GSTexture11 can route uploads to the recording
+// context and flush it before staging readbacks.
+extern GSDevice11* g_gs_device11;
+
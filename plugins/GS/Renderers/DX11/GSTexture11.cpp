@@ -22,6 +22,7 @@
 #include "Pcsx2Types.h"
 
 #include "GSTexture11.h"
+#include "GSDevice11.h"
 
 GSTexture11::GSTexture11(ID3D11Texture2D* texture)
 	: m_texture(texture), m_layer(0)
@@ -33,6 +34,12 @@ GSTexture11::GSTexture11(ID3D11Texture2D* texture)
 
 	m_dev->GetImmediateContext(&m_ctx);
 
+	// Uploads have to keep their ordering against draws, so they go to the
+	// device's recording context when deferred recording is enabled. Staging
+	// readbacks stay on the immediate context (a deferred context cannot
+	// service a Map for reading).
+	m_ctx_rec = (g_gs_device11 && g_gs_device11->IsDeferred()) ? g_gs_device11->RecordingContext() : m_ctx.p;
+
 	m_size.x = (int)m_desc.Width;
 	m_size.y = (int)m_desc.Height;
 
@@ -56,7 +63,7 @@ bool GSTexture11::Update(const GSVector4i& r, const void* data, int pitch, int l
 		D3D11_BOX box = { (UINT)r.left, (UINT)r.top, 0U, (UINT)r.right, (UINT)r.bottom, 1U };
 		UINT subresource = layer; // MipSlice + (ArraySlice * MipLevels).
 
-		m_ctx->UpdateSubresource(m_texture, subresource, &box, data, pitch, 0);
+		m_ctx_rec->UpdateSubresource(m_texture, subresource, &box, data, pitch, 0);
 
 		return true;
 	}
@@ -77,6 +84,11 @@ bool GSTexture11::Map(GSMap& m, const GSVector4i* r, int layer)
 		D3D11_MAPPED_SUBRESOURCE map;
 		UINT subresource = layer;
 
+		// Flush pending recorded commands, the copy feeding this readback
+		// may still be sitting on the deferred context.
+		if(g_gs_device11 && g_gs_device11->IsDeferred())
+			g_gs_device11->ExecuteDeferred();
+
 		if(SUCCEEDED(m_ctx->Map(m_texture, subresource, D3D11_MAP_READ_WRITE, 0, &map)))
 		{
 			m.bits  = (u8*)map.pData;
@@ -29,6 +29,7 @@ class GSTexture11 : public GSTexture
 {
 	CComPtr<ID3D11Device> m_dev;
 	CComPtr<ID3D11DeviceContext> m_ctx;
+	CComPtr<ID3D11DeviceContext> m_ctx_rec; // context uploads are issued on; the device's recording context when deferred
 	CComPtr<ID3D11Texture2D> m_texture;
 	D3D11_TEXTURE2D_DESC m_desc;
 	CComPtr<ID3D11ShaderResourceView> m_srv;
@@ -34,6 +34,11 @@ GSRendererHW::GSRendererHW(GSTextureCache* tc)
 	, m_custom_height(1024)
 	, m_reset(false)
 	, m_userhacks_ts_half_bottom(-1)
+	, m_overdraw_skip(false)
+	, m_od_frame(0)
+	, m_od_stat_draws(0)
+	, m_od_stat_skipped(0)
+	, m_od_readback(false)
 	, m_tc(tc)
 	, m_src(nullptr)
 	, m_userhacks_tcoffset(false)
@@ -77,6 +82,7 @@ GSRendererHW::GSRendererHW(GSTextureCache* tc)
 
 	m_userhacks_ts_half_bottom		= option_value(INT_PCSX2_OPT_USERHACK_HALFSCREEN_FIX, KeyOptionInt::return_type);
 	m_userhacks_auto_flush			= option_value(BOOL_PCSX2_OPT_USERHACK_AUTO_FLUSH, KeyOptionBool::return_type);
+	m_overdraw_skip					= option_value(BOOL_PCSX2_OPT_USERHACK_OVERDRAW_SKIP, KeyOptionBool::return_type);
 
 	//theApp.SetConfig("UserHacks_AutoFlush", m_userhacks_auto_flush);
 	
@@ -113,6 +119,8 @@ GSRendererHW::GSRendererHW(GSTextureCache* tc)
 
 void GSRendererHW::UpdateRendererOptions()
 {
+	GSRenderer::UpdateRendererOptions();
+
 	m_large_framebuffer = !option_value(BOOL_PCSX2_OPT_CONSERVATIVE_BUFFER, KeyOptionBool::return_type);
 	m_mipmap = option_value(INT_PCSX2_OPT_MIPMAPPING, KeyOptionInt::return_type);
 	m_accurate_date = option_value(BOOL_PCSX2_OPT_ACCURATE_DATE, KeyOptionBool::return_type);
@@ -142,6 +150,14 @@ void GSRendererHW::UpdateRendererOptions()
 	m_userhacks_wildhack				= option_value(BOOL_PCSX2_OPT_USERHACK_WILDARMS_OFFSET, KeyOptionBool::return_type);
 	m_userhacks_ts_half_bottom			= option_value(INT_PCSX2_OPT_USERHACK_HALFSCREEN_FIX, KeyOptionInt::return_type);
 	m_userhacks_auto_flush				= option_value(BOOL_PCSX2_OPT_USERHACK_AUTO_FLUSH, KeyOptionBool::return_type);
+	m_overdraw_skip						= option_value(BOOL_PCSX2_OPT_USERHACK_OVERDRAW_SKIP, KeyOptionBool::return_type);
+
+	if (!m_overdraw_skip)
+	{
+		m_od_draws.clear();
+		m_od_seen.clear();
+		m_od_skip.clear();
+	}
 
 	//theApp.SetConfig("UserHacks_AutoFlush", m_userhacks_auto_flush);
 	//theApp.SetConfig("UserHacks", true);
@@ -366,6 +382,34 @@ void GSRendererHW::Reset()
 
 void GSRendererHW::VSync(int field)
 {
+	// Runtime internal-resolution switch (dynamic performance scaling). Only
+	// the scale-dependent targets get dropped: sources uploaded from GS
+	// memory are native resolution and therefore valid at any multiplier, so
+	// the texture cache survives and re-materializes targets lazily at the
+	// new scale. Custom resolution mode (multiplier 0) is excluded.
+	if (option_upscale_mult >= 1 && m_upscale_multiplier >= 1 && option_upscale_mult != m_upscale_multiplier)
+	{
+		m_upscale_multiplier = option_upscale_mult;
+		theApp.SetConfig("upscale_multiplier", m_upscale_multiplier);
+
+		m_userhacks_align_sprite_X      = option_value(BOOL_PCSX2_OPT_USERHACK_ALIGN_SPRITE, KeyOptionBool::return_type);
+		m_userHacks_merge_sprite        = option_value(BOOL_PCSX2_OPT_USERHACK_MERGE_SPRITE, KeyOptionBool::return_type);
+		m_userhacks_round_sprite_offset = option_value(INT_PCSX2_OPT_USERHACK_ROUND_SPRITE, KeyOptionInt::return_type);
+
+		if (m_upscale_multiplier == 1) { // hacks are only needed for upscaling issues.
+			m_userhacks_round_sprite_offset = 0;
+			m_userhacks_align_sprite_X      = false;
+			m_userHacks_merge_sprite        = false;
+		}
+
+		m_tc->RemovePartial();
+
+		// Shrink back to the defaults so SetScaling() below resizes to what
+		// the new multiplier actually needs.
+		m_width  = default_rt_size.x;
+		m_height = default_rt_size.y;
+	}
+
 	//Check if the frame buffer width or display width has changed
 	SetScaling();
 
@@ -376,6 +420,9 @@ void GSRendererHW::VSync(int field)
 		m_reset = false;
 	}
 
+	if (m_overdraw_skip)
+		OverdrawAnalyze();
+
 	GSRenderer::VSync(field);
 
 	m_tc->IncAge();
@@ -384,6 +431,118 @@ void GSRendererHW::VSync(int field)
 	m_skip_offset = 0;
 }
 
+// Log the current draw for the end-of-frame overdraw analysis, and tell the
+// caller whether last frame proved its output is fully overwritten before
+// ever being sampled.  One frame in eight every draw runs regardless, so a
+// stale prediction only survives until the next validation frame.
+bool GSRendererHW::OverdrawRecord(u32 fm, u32 zm)
+{
+	const GSDrawingContext* context = m_context;
+	const GSLocalMemory::psm_t& frame_psm = GSLocalMemory::m_psm[context->FRAME.PSM];
+
+	OverdrawDraw d;
+
+	d.fbp = context->FRAME.Block();
+	d.psm = context->FRAME.PSM;
+	d.fbw = context->FRAME.FBW;
+	d.r = m_r;
+
+	// Coarse upper bound of the blocks the draw can touch, used for the
+	// feedback test below.  Overestimating only costs skip opportunities.
+	const u32 rows = (m_r.w + frame_psm.pgs.y - 1) / frame_psm.pgs.y;
+	d.fbp_end = d.fbp + (d.fbw * (rows + 1)) * 32;
+
+	d.tex_tbp0 = PRIM->TME ? (u32)context->TEX0.TBP0 : ~0u;
+
+	// A single opaque sprite which writes every pixel of its rect hides
+	// whatever was drawn below it earlier in the frame.
+	d.covers = (m_vt.m_primclass == GS_SPRITE_CLASS) && (m_vertex.next == 2)
+		&& (fm == 0)
+		&& (!PRIM->ABE || context->ALPHA.IsOpaque())
+		&& !context->TEST.ATE && !context->TEST.DATE
+		&& (!context->TEST.ZTE || context->TEST.ZTST == ZTST_ALWAYS);
+
+	// Only color-only draws are skip candidates; dropping a depth write
+	// would leak into later depth-tested draws.
+	d.safe = (zm == 0xffffffff) && (fm != 0xffffffff);
+
+	// The same draw sequence maps to the same key next frame; the occurrence
+	// counter keeps identical back-to-back draws apart.
+	u64 key = context->FRAME.U64 ^ (context->ZBUF.U64 << 1) ^ (context->TEX0.U64 << 2)
+		^ ((u64)(u16)m_r.x << 32) ^ ((u64)(u16)m_r.y << 48)
+		^ ((u64)(u16)m_r.z << 8) ^ ((u64)(u16)m_r.w << 16)
+		^ ((u64)m_vt.m_primclass << 60);
+	key ^= (u64)m_od_seen[key]++ << 40;
+	d.key = key;
+
+	m_od_draws.push_back(d);
+	m_od_stat_draws++;
+
+	const bool validate = (m_od_frame & 7) == 0;
+
+	if (!validate && d.safe && m_od_skip.find(key) != m_od_skip.end())
+	{
+		m_od_stat_skipped++;
+		return true;
+	}
+
+	return false;
+}
+
+// Walk this frame's draw log and collect the draws whose output another draw
+// opaquely overwrites with no read of the buffer in between; those are safe
+// to skip next frame.  The set is rebuilt from scratch every frame, so a
+// draw which stops being covered stops being skipped one frame later.
+void GSRendererHW::OverdrawAnalyze()
+{
+	m_od_skip.clear();
+
+	// A local memory readback means the CPU saw the buffers this frame;
+	// don't predict anything from it.  Huge frames aren't worth the O(n^2)
+	// scan either.
+	if (!m_od_readback && m_od_draws.size() <= 2048)
+	{
+		for (size_t i = 0; i < m_od_draws.size(); i++)
+		{
+			const OverdrawDraw& d = m_od_draws[i];
+
+			if (!d.safe)
+				continue;
+
+			for (size_t j = i + 1; j < m_od_draws.size(); j++)
+			{
+				const OverdrawDraw& o = m_od_draws[j];
+
+				// Feedback: the buffer gets sampled before being overwritten.
+				if (o.tex_tbp0 >= d.fbp && o.tex_tbp0 < d.fbp_end)
+					break;
+
+				if (o.covers && o.fbp == d.fbp && o.psm == d.psm && o.fbw == d.fbw
+					&& o.r.rintersect(d.r).eq(d.r))
+				{
+					m_od_skip.insert(d.key);
+					break;
+				}
+			}
+		}
+	}
+
+	m_od_draws.clear();
+	m_od_seen.clear();
+	m_od_readback = false;
+	m_od_frame++;
+
+#ifndef NDEBUG
+	if ((m_od_frame % 600) == 0 && m_od_stat_draws)
+	{
+		log_cb(RETRO_LOG_DEBUG, "Overdraw skip: %u of %u draws over the last 600 frames\n",
+			m_od_stat_skipped, m_od_stat_draws);
+		m_od_stat_draws = 0;
+		m_od_stat_skipped = 0;
+	}
+#endif
+}
+
 void GSRendererHW::ResetDevice()
 {
 	m_tc->RemoveAll();
@@ -774,6 +933,10 @@ void GSRendererHW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 {
 	if(clut) return; // FIXME
 
+	// The CPU is reading GS memory back; whatever the overdraw analysis
+	// would prove this frame may be observed, so don't prove anything.
+	m_od_readback = true;
+
 	m_tc->InvalidateLocalMem(m_mem.GetOffset(BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM), r);
 }
 
@@ -1447,7 +1610,16 @@ void GSRendererHW::Draw()
 
 	//
 
-	DrawPrims(rt_tex, ds_tex, m_src);
+	if (m_overdraw_skip && rt && OverdrawRecord(fm, zm))
+	{
+		// Last frame proved the output of this draw is fully overwritten
+		// before being sampled; drop the GPU work but keep the target
+		// validity/invalidation bookkeeping below as if it had run.
+	}
+	else
+	{
+		DrawPrims(rt_tex, ds_tex, m_src);
+	}
 
 	//
 
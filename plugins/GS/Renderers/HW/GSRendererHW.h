@@ -27,6 +27,10 @@
 #include "../Common/GSFunctionMap.h"
 #include "../../GSState.h"
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 class GSRendererHW : public GSRenderer
 {
 private:
@@ -136,6 +140,34 @@ private:
 
 	#pragma endregion
 
+	// Overdraw elimination: end-of-frame analysis of the draw log finds
+	// draws whose output is provably overwritten before being sampled, so
+	// the same draws can be skipped the next frame.
+	struct OverdrawDraw
+	{
+		u64 key;        // stable identity of the draw across frames
+		u32 fbp;        // first block of the frame buffer
+		u32 fbp_end;    // coarse upper bound of the blocks touched
+		u32 psm;
+		u32 fbw;
+		GSVector4i r;   // draw rectangle (scissored)
+		u32 tex_tbp0;   // sampled texture base, ~0u when untextured
+		bool covers;    // opaque write of every pixel of r
+		bool safe;      // color-only output, candidate for skipping
+	};
+
+	bool m_overdraw_skip;
+	std::vector<OverdrawDraw> m_od_draws;
+	std::unordered_map<u64, u16> m_od_seen;
+	std::unordered_set<u64> m_od_skip;
+	u32 m_od_frame;
+	u32 m_od_stat_draws;
+	u32 m_od_stat_skipped;
+	bool m_od_readback;
+
+	bool OverdrawRecord(u32 fm, u32 zm);
+	void OverdrawAnalyze();
+
 	u16 Interpolate_UV(float alpha, int t0, int t1);
 	float alpha0(int L, int X0, int X1);
 	float alpha1(int L, int X0, int X1);
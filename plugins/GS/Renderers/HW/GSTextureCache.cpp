@@ -24,11 +24,101 @@
 #include "GSTextureCache.h"
 #include "GSRendererHW.h"
 #include "../../GSUtil.h"
+#include "../../GSThread_CXX11.h"
 #include "options_tools.h"
 
+#include <thread>
+
 bool GSTextureCache::m_disable_partial_invalidation = false;
 bool GSTextureCache::m_wrap_gs_mem = false;
 
+// Large texture cache misses convert swizzled local memory serially on the GS
+// thread, producing single-frame spikes of several milliseconds.  Big
+// block-aligned conversions are split into page-row strips across a small
+// worker pool built on the same GSJobQueue the SW rasterizer workers use (in
+// HW mode those threads do not exist, so the cache owns its own pool, created
+// on first use and torn down with the cache).
+
+struct ConvertJob
+{
+	GSLocalMemory* mem;
+	GSLocalMemory::readTexture rtx;
+	const GSOffset* off;
+	GSVector4i r;
+	u8* dst;
+	int pitch;
+	GIFRegTEXA texa;
+};
+
+class ConvertWorkerPool
+{
+	using GSWorker = GSJobQueue<ConvertJob, 256>;
+
+	std::vector<std::unique_ptr<GSWorker>> m_workers;
+
+public:
+	ConvertWorkerPool(int threads)
+	{
+		for(int i = 0; i < threads; i++)
+		{
+			m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
+				[](ConvertJob& job) { (job.mem->*job.rtx)(job.off, job.r, job.dst, job.pitch, job.texa); })));
+		}
+	}
+
+	int GetThreadCount() const { return (int)m_workers.size(); }
+
+	void Queue(int i, const ConvertJob& job) { m_workers[i]->Push(job); }
+
+	void Sync()
+	{
+		for(auto& w : m_workers)
+			w->Wait();
+	}
+};
+
+static std::unique_ptr<ConvertWorkerPool> s_convert_pool;
+
+// Converts the block-aligned rect r into dst, splitting by page rows across
+// the worker pool when the conversion is large enough to be worth the fan-out.
+// The strips write to disjoint destination rows and only share read-only state
+// (vm, swizzle tables, CLUT), so they are independent.
+static void ReadTextureParallel(GSLocalMemory& mem, GSLocalMemory::readTexture rtx, const GSOffset* off,
+	const GSVector4i& r, u8* dst, int pitch, const GIFRegTEXA& texa, const GSVector2i& pgs, u32 psm)
+{
+	// ReadTextureGPU24 runs a packed RGB fixup pass over the whole rect and
+	// cannot be split; small rects aren't worth the queueing overhead.
+	if(psm == PSM_PSGPU24 || r.width() * r.height() < 512 * 512 || r.height() < pgs.y * 2)
+	{
+		(mem.*rtx)(off, r, dst, pitch, texa);
+		return;
+	}
+
+	if(!s_convert_pool)
+	{
+		int threads = std::min<int>(3, Threading::GetWorkerThreadBudget());
+		s_convert_pool.reset(new ConvertWorkerPool(threads));
+	}
+
+	// The GS thread converts the tail strip itself while the workers run.
+	int shares = s_convert_pool->GetThreadCount() + 1;
+	int rows = (r.height() + pgs.y - 1) / pgs.y;
+	int chunk = (rows + shares - 1) / shares * pgs.y;
+
+	int y = r.top;
+
+	for(int i = 0; i < shares - 1 && y + chunk < r.bottom; i++, y += chunk)
+	{
+		ConvertJob job = {&mem, rtx, off, GSVector4i(r.left, y, r.right, y + chunk), dst + (y - r.top) * pitch, pitch, texa};
+
+		s_convert_pool->Queue(i, job);
+	}
+
+	(mem.*rtx)(off, GSVector4i(r.left, y, r.right, r.bottom), dst + (y - r.top) * pitch, pitch, texa);
+
+	s_convert_pool->Sync();
+}
+
 GSTextureCache::GSTextureCache(GSRenderer* r)
 	: m_renderer(r)
 	, m_palette_map(r)
@@ -56,6 +146,8 @@ GSTextureCache::GSTextureCache(GSRenderer* r)
 
 GSTextureCache::~GSTextureCache()
 {
+	s_convert_pool.reset();
+
 	RemoveAll();
 
 	m_texture_inside_rt_cache.clear();
@@ -776,6 +868,13 @@ void GSTextureCache::InvalidateVideoMem(GSOffset* off, const GSVector4i& rect, b
 	{
 		u32 page = *p;
 
+		// Occupancy bitmap check: no source overlaps this page, so the list
+		// walk (and the cache miss into its separately allocated buffer) can
+		// be skipped entirely.  Uploads into pages nothing is texturing from
+		// are the common case for streaming games.
+		if(!(m_src.m_pages[page >> 5] & (1U << (page & 31))))
+			continue;
+
 		auto& list = m_src.m_map[page];
 		for(auto i = list.begin(); i != list.end(); )
 		{
@@ -834,6 +933,33 @@ void GSTextureCache::InvalidateVideoMem(GSOffset* off, const GSVector4i& rect, b
 
 	if(!target) return;
 
+	// Page-interval summary of the write, used below to reject unrelated
+	// targets with a couple of compares instead of evaluating every dirty
+	// heuristic against every target.
+	u32 wpage_min = 0;
+	u32 wpage_max = MAX_PAGES - 1;
+
+	if(*pages != GSOffset::EOP)
+	{
+		wpage_min = MAX_PAGES;
+		wpage_max = 0;
+
+		for(const u32* p = pages; *p != GSOffset::EOP; p++)
+		{
+			wpage_min = std::min(wpage_min, *p);
+			wpage_max = std::max(wpage_max, *p);
+		}
+
+		// A transfer that wraps past the end of GS memory produces page
+		// numbers below its own base; ordering is meaningless then, so keep
+		// the full range and let every target go through the slow path.
+		if(wpage_min < (bp >> 5))
+		{
+			wpage_min = 0;
+			wpage_max = MAX_PAGES - 1;
+		}
+	}
+
 	for(int type = 0; type < 2; type++)
 	{
 		auto& list = m_dst[type];
@@ -842,6 +968,19 @@ void GSTextureCache::InvalidateVideoMem(GSOffset* off, const GSVector4i& rect, b
 			auto j = i++;
 			Target* t = *j;
 
+			// Quick reject on the page interval of the write. Every case below
+			// requires the write to reach the first page of the target: shared
+			// or equal BP means the start page itself is written, "Dirty After
+			// Target" only fires when the rect rows reach down to TBP0, and
+			// Inside() implies containment. Conversely a write located wholly
+			// after the end of the target can only matter when it starts at or
+			// before TBP0 (equal BP / "Dirty After Target" again).
+			const u32 tpage_first = t->m_TEX0.TBP0 >> 5;
+			const u32 tpage_last = (t->m_end_block < t->m_TEX0.TBP0) ? MAX_PAGES - 1 : (t->m_end_block >> 5);
+
+			if(tpage_first > wpage_max || (bp > t->m_TEX0.TBP0 && wpage_min > tpage_last))
+				continue;
+
 			// GH: (I think) this code is completely broken. Typical issue:
 			// EE write an alpha channel into 32 bits texture
 			// Results: the target is deleted (because HasCompatibleBits is false)
@@ -1788,7 +1927,7 @@ void GSTextureCache::Source::Flush(u32 count, int layer)
 
 		if((r > tr).mask() & 0xff00)
 		{
-			(mem.*rtx)(off, r, buff, pitch, m_TEXA);
+			ReadTextureParallel(mem, rtx, off, r, buff, pitch, m_TEXA, psm.pgs, m_TEX0.PSM);
 
 			m_texture->Update(r.rintersect(tr), buff, pitch, layer);
 		}
@@ -1798,13 +1937,13 @@ void GSTextureCache::Source::Flush(u32 count, int layer)
 
 			if(m_texture->Map(m, &r, layer))
 			{
-				(mem.*rtx)(off, r, m.bits, m.pitch, m_TEXA);
+				ReadTextureParallel(mem, rtx, off, r, m.bits, m.pitch, m_TEXA, psm.pgs, m_TEX0.PSM);
 
 				m_texture->Unmap();
 			}
 			else
 			{
-				(mem.*rtx)(off, r, buff, pitch, m_TEXA);
+				ReadTextureParallel(mem, rtx, off, r, buff, pitch, m_TEXA, psm.pgs, m_TEX0.PSM);
 
 				m_texture->Update(r, buff, pitch, layer);
 			}
@@ -1953,6 +2092,8 @@ void GSTextureCache::SourceMap::Add(Source* s, const GIFRegTEX0& TEX0, GSOffset*
 		// GH: I don't know why but it seems we only consider the first page for a render target
 		size_t page = TEX0.TBP0 >> 5;
 
+		m_pages[page >> 5] |= 1U << (page & 31);
+
 		s->m_erase_it[page] = m_map[page].InsertFront(s);
 
 		return;
@@ -1963,6 +2104,8 @@ void GSTextureCache::SourceMap::Add(Source* s, const GIFRegTEX0& TEX0, GSOffset*
 	{
 		if(u32 p = s->m_pages_as_bit[i])
 		{
+			m_pages[i] |= p;
+
 			auto* m = &m_map[i << 5];
 			auto* e = &s->m_erase_it[i << 5];
 
@@ -1991,6 +2134,8 @@ void GSTextureCache::SourceMap::RemoveAll()
 	{
 		m_map[i].clear();
 	}
+
+	memset(m_pages, 0, sizeof(m_pages));
 }
 
 void GSTextureCache::SourceMap::RemoveAt(Source* s)
@@ -2007,6 +2152,9 @@ void GSTextureCache::SourceMap::RemoveAt(Source* s)
 	{
 		const size_t page = s->m_TEX0.TBP0 >> 5;
 		m_map[page].EraseIndex(s->m_erase_it[page]);
+
+		if(m_map[page].empty())
+			m_pages[page >> 5] &= ~(1U << (page & 31));
 	}
 	else
 	{
@@ -2027,6 +2175,9 @@ void GSTextureCache::SourceMap::RemoveAt(Source* s)
 					p ^= 1U << j;
 
 					m[j].EraseIndex(e[j]);
+
+					if(m[j].empty())
+						m_pages[i] &= ~(1U << j);
 				}
 			}
 		}
@@ -2084,41 +2235,13 @@ void GSTextureCache::Palette::InitializeTexture() {
 // GSTextureCache::PaletteKeyHash
 
 // Hashes the content of the clut.
-// The hashing function is implemented by taking two things into account:
-// 1) The clut can be an array of 16 or 256 u32 (depending on the pal parameter) and in order to speed up the computation of the hash
-//    the array is hashed in blocks of 16 u32, so for clut of size 16 u32 the hashing is computed in one pass and for clut of 256 u32
-//    it is computed in 16 passes,
-// 2) The clut can contain many 0s, so as a way to increase the spread of hashing values for small changes in the input clut the hashing function
-//    is using addition in combination with logical XOR operator; The addition constants are large prime numbers, which may help in achieving what intended.
+// CRC-32C through GSVector4i::crc32c: a single crc32 instruction per 8 bytes
+// on SSE4.2 hosts, and a much better spread over mostly-zero cluts than the
+// previous hand-rolled multiply/xor mix.
 std::size_t GSTextureCache::PaletteKeyHash::operator()(const PaletteKey &key) const {
-	u16 pal = key.pal;
-	const u32* clut = key.clut;
-
-	ASSERT((pal & 15) == 0);
-
-	size_t clut_hash = 3831179159;
-	for (u16 i = 0; i < pal; i += 16) {
-		clut_hash = (clut_hash + 1488000301) ^ (clut[i     ] +   33644011);
-		clut_hash = (clut_hash + 3831179159) ^ (clut[i +  1] +   47627467);
-		clut_hash = (clut_hash + 3659574209) ^ (clut[i +  2] +  577038523);
-		clut_hash = (clut_hash +   33644011) ^ (clut[i +  3] + 3491555267);
-
-		clut_hash = (clut_hash +  777771959) ^ (clut[i +  4] + 3301075993);
-		clut_hash = (clut_hash + 4019618579) ^ (clut[i +  5] + 4186992613);
-		clut_hash = (clut_hash + 3465668953) ^ (clut[i +  6] + 3043435883);
-		clut_hash = (clut_hash + 3494478943) ^ (clut[i +  7] + 3441897883);
-
-		clut_hash = (clut_hash + 3432010979) ^ (clut[i +  8] + 2167922789);
-		clut_hash = (clut_hash + 1570862863) ^ (clut[i +  9] + 3401920591);
-		clut_hash = (clut_hash + 1002648679) ^ (clut[i + 10] + 1293530519);
-		clut_hash = (clut_hash +  551381741) ^ (clut[i + 11] + 2539834039);
-
-		clut_hash = (clut_hash + 3768974459) ^ (clut[i + 12] +  169943507);
-		clut_hash = (clut_hash +  862380703) ^ (clut[i + 13] + 2906932549);
-		clut_hash = (clut_hash + 3433082137) ^ (clut[i + 14] + 4234384109);
-		clut_hash = (clut_hash + 2679083843) ^ (clut[i + 15] + 2719605247);
-	}
-	return clut_hash;
+	ASSERT((key.pal & 15) == 0);
+
+	return GSVector4i::crc32c(0, key.clut, key.pal * sizeof(key.clut[0]));
 };
 
 // GSTextureCache::PaletteKeyEqual
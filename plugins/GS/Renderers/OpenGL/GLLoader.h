@@ -102,7 +102,7 @@ typedef void (APIENTRYP PFNGLTEXTUREPAGECOMMITMENTEXTPROC) (GLuint texture, GLin
 // #define ENABLE_GL_ARB_gpu_shader_int64 1
 // #define ENABLE_GL_ARB_indirect_parameters 1
 // #define ENABLE_GL_ARB_instanced_arrays 1
-// #define ENABLE_GL_ARB_parallel_shader_compile 1
+#define ENABLE_GL_ARB_parallel_shader_compile 1
 // #define ENABLE_GL_ARB_robustness 1
 // #define ENABLE_GL_ARB_sample_locations 1
 // #define ENABLE_GL_ARB_sample_shading 1
@@ -111,7 +111,7 @@ typedef void (APIENTRYP PFNGLTEXTUREPAGECOMMITMENTEXTPROC) (GLuint texture, GLin
 #define ENABLE_GL_ARB_sparse_texture 1
 // #define ENABLE_GL_ARB_texture_buffer_object 1
 // #define ENABLE_GL_KHR_blend_equation_advanced 1
-// #define ENABLE_GL_KHR_parallel_shader_compile 1
+#define ENABLE_GL_KHR_parallel_shader_compile 1
 
 // Dark age of openGL. GL_10 and GL_11 are provided by opengl32.dll on windows.
 // Linux is a royal mess
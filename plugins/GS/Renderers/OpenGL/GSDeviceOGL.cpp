@@ -1719,7 +1719,7 @@ GSDeviceOGL::GSDeviceOGL()
 	memset(&m_fxaa, 0, sizeof(m_fxaa));
 	memset(&m_date, 0, sizeof(m_date));
 	memset(&m_om_dss, 0, sizeof(m_om_dss));
-	memset(&m_profiler, 0 , sizeof(m_profiler));
+	memset(&m_gpu_timer, 0, sizeof(m_gpu_timer));
 	GLState::Clear();
 
 	m_mipmap = theApp.GetConfigI("mipmap");
@@ -1761,6 +1761,9 @@ GSDeviceOGL::~GSDeviceOGL()
 	glDeleteFramebuffers(1, &m_fbo);
 	glDeleteFramebuffers(1, &m_fbo_read);
 
+	if (m_gpu_timer.queries[0])
+		glDeleteQueries(countof(m_gpu_timer.queries), m_gpu_timer.queries);
+
 	// Delete HW FX
 	delete m_vs_cb;
 	delete m_ps_cb;
@@ -1869,6 +1872,12 @@ bool GSDeviceOGL::Create()
 		glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo_read);
 		glReadBuffer(GL_COLOR_ATTACHMENT0);
 		glBindFramebuffer(GL_READ_FRAMEBUFFER, GL_DEFAULT_FRAMEBUFFER);
+
+		// Timer queries come from ARB_timer_query (core since 3.3) but the
+		// loader treats them as optional; leave the ring empty when the
+		// driver doesn't have them and GetGPUTimeUs() reports 0.
+		if (glQueryCounter && glGetQueryObjectui64v)
+			glGenQueries(countof(m_gpu_timer.queries), m_gpu_timer.queries);
 	}
 
 	// ****************************************************************
@@ -2050,8 +2059,11 @@ bool GSDeviceOGL::Create()
 
 void GSDeviceOGL::CreateTextureFX()
 {
-	m_vs_cb = new GSUniformBufferOGL("HW VS UBO", g_vs_cb_index, sizeof(VSConstantBuffer));
-	m_ps_cb = new GSUniformBufferOGL("HW PS UBO", g_ps_cb_index, sizeof(PSConstantBuffer));
+	// The per-draw constant buffers go through the persistent-mapped ring:
+	// an upload becomes a memcpy + glBindBufferRange instead of a
+	// glBufferSubData the driver may have to synchronize on.
+	m_vs_cb = new GSUniformBufferStorageOGL("HW VS UBO", g_vs_cb_index, sizeof(VSConstantBuffer));
+	m_ps_cb = new GSUniformBufferStorageOGL("HW PS UBO", g_ps_cb_index, sizeof(PSConstantBuffer));
 
 	// warning 1 sampler by image unit. So you cannot reuse m_ps_ss...
 	m_palette_ss = CreateSampler(PSSamplerSelector(0));
@@ -2100,6 +2112,42 @@ void GSDeviceOGL::Flip()
 	video_cb(RETRO_HW_FRAME_BUFFER_VALID, GSgetInternalResolution().x, GSgetInternalResolution().y, 0);
 }
 
+u32 GSDeviceOGL::GetGPUTimeUs()
+{
+	if (!m_gpu_timer.queries[0])
+		return 0;
+
+	if (m_gpu_timer.active)
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		m_gpu_timer.wr = (m_gpu_timer.wr + 1) % countof(m_gpu_timer.queries);
+	}
+
+	// Drain whatever results have landed; never block on one, they're
+	// typically a frame or two behind the CPU.
+	while (m_gpu_timer.rd != m_gpu_timer.wr)
+	{
+		GLuint available = 0;
+		glGetQueryObjectuiv(m_gpu_timer.queries[m_gpu_timer.rd], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break;
+
+		GLuint64 ns = 0;
+		glGetQueryObjectui64v(m_gpu_timer.queries[m_gpu_timer.rd], GL_QUERY_RESULT, &ns);
+		m_gpu_timer.last_us = (u32)(ns / 1000);
+		m_gpu_timer.rd = (m_gpu_timer.rd + 1) % countof(m_gpu_timer.queries);
+	}
+
+	// Open the next interval unless the ring is full (driver badly behind);
+	// then skip a frame of measurement rather than stall on the readback.
+	const int next = (m_gpu_timer.wr + 1) % countof(m_gpu_timer.queries);
+	m_gpu_timer.active = (next != m_gpu_timer.rd);
+	if (m_gpu_timer.active)
+		glBeginQuery(GL_TIME_ELAPSED, m_gpu_timer.queries[m_gpu_timer.wr]);
+
+	return m_gpu_timer.last_us;
+}
+
 void GSDeviceOGL::BeforeDraw()
 {
 }
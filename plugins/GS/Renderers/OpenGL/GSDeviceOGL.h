@@ -472,12 +472,15 @@ private:
 		GSTexture* t;
 	} m_date;
 
+	// Whole-frame GL_TIME_ELAPSED queries, read back a few frames late so
+	// the GPU is never drained for a result.
 	struct {
-		u16 last_query;
-		GLuint timer_query[1<<16];
-
-		GLuint timer() { return timer_query[last_query]; }
-	} m_profiler;
+		GLuint queries[4];
+		int wr;       // slot of the currently open query
+		int rd;       // oldest query not yet read back
+		bool active;  // a TIME_ELAPSED query is currently open
+		u32 last_us;  // newest completed frame time
+	} m_gpu_timer;
 
 	GLuint m_vs[1<<1];
 	GLuint m_gs[1<<3];
@@ -488,8 +491,8 @@ private:
 
 	GLuint m_palette_ss;
 
-	GSUniformBufferOGL* m_vs_cb;
-	GSUniformBufferOGL* m_ps_cb;
+	GSUniformBufferStorageOGL* m_vs_cb;
+	GSUniformBufferStorageOGL* m_ps_cb;
 
 	VSConstantBuffer m_vs_cb_cache;
 	PSConstantBuffer m_ps_cb_cache;
@@ -517,6 +520,8 @@ public:
 	bool Reset(int w, int h);
 	void Flip();
 
+	u32 GetGPUTimeUs() final;
+
 	void DrawPrimitive() final;
 	void DrawPrimitive(int offset, int count);
 	void DrawIndexedPrimitive() final;
@@ -22,6 +22,7 @@
 #include "../../stdafx.h"
 #include "GSShaderOGL.h"
 #include "GLState.h"
+#include "options_tools.h"
 
 /* Common shader */
 static const char common_glsl_shader_raw[] =
@@ -143,10 +144,207 @@ static const char common_glsl_shader_raw[] =
 "#endif\n"
 ;
 
-GSShaderOGL::GSShaderOGL() : 
+// --------------------------------------------------------------------------------------
+//  On-disk program binary cache
+// --------------------------------------------------------------------------------------
+// Separate shader objects mean tfx permutations are compiled individually on first use,
+// mid-frame.  Linked binaries are persisted under the frontend's system directory and
+// replayed with glProgramBinary on later runs, so a permutation only ever costs a real
+// GLSL compile once per driver.  Records are keyed by a hash of the complete GLSL
+// source (generated header + common header + shader body), which survives core updates
+// that leave the shaders untouched; the file header carries a hash of the driver
+// identity strings, since program binaries are only defined for the driver and GPU
+// that produced them, and a foreign or stale cache is discarded wholesale.
+
+struct ProgramCacheHeader
+{
+	u32 magic;
+	u32 version;
+	u64 driver;
+};
+
+static const u32 ProgramCacheMagic = 0x47535847; // 'GSXG'
+static const u32 ProgramCacheVersion = 1;
+
+static u64 ProgramCacheHash(u64 h, const void* data, size_t size)
+{
+	const u8* p = (const u8*)data;
+
+	for(size_t i = 0; i < size; i++)
+	{
+		h = (h ^ p[i]) * 0x100000001b3ull;
+	}
+
+	return h;
+}
+
+void GSShaderOGL::LoadProgramBinaryCache()
+{
+	m_binary_cache_enabled = false;
+
+	if(retroarch_system_path.empty())
+		return;
+
+	// Program binaries are optional: a driver may expose the entry points but
+	// support no binary format at all (GL_NUM_PROGRAM_BINARY_FORMATS == 0).
+	GLint formats = 0;
+	if(glGetProgramBinary && glProgramBinary && glProgramParameteri)
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if(formats <= 0)
+		return;
+
+	u64 driver = 0xcbf29ce484222325ull;
+
+	for(GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+	{
+		if(const char* s = (const char*)glGetString(name))
+			driver = ProgramCacheHash(driver, s, strlen(s) + 1);
+	}
+
+	m_binary_cache_enabled = true;
+	m_binary_cache_path = retroarch_system_path + "/pcsx2/ogl_programs.cache";
+
+	if(FILE* fp = fopen(m_binary_cache_path.c_str(), "rb"))
+	{
+		ProgramCacheHeader hdr;
+
+		bool valid = fread(&hdr, sizeof(hdr), 1, fp) == 1
+			&& hdr.magic == ProgramCacheMagic
+			&& hdr.version == ProgramCacheVersion
+			&& hdr.driver == driver;
+
+		while(valid)
+		{
+			u64 key;
+			u32 size;
+
+			if(fread(&key, sizeof(key), 1, fp) != 1)
+				break;
+
+			if(fread(&size, sizeof(size), 1, fp) != 1 || size <= sizeof(GLenum) || size > (8u << 20))
+			{
+				valid = false;
+				break;
+			}
+
+			std::vector<u8> blob(size);
+
+			if(fread(blob.data(), 1, size, fp) != size)
+			{
+				valid = false;
+				break;
+			}
+
+			m_binary_cache[key] = std::move(blob);
+		}
+
+		fclose(fp);
+
+		if(valid)
+		{
+			log_cb(RETRO_LOG_INFO, "GL program cache: loaded %zu prelinked programs\n", m_binary_cache.size());
+			return;
+		}
+
+		// Different driver, changed shader source or a truncated write - start
+		// over rather than hand the driver binaries it never produced.
+		m_binary_cache.clear();
+	}
+
+	if(FILE* fp = fopen(m_binary_cache_path.c_str(), "wb"))
+	{
+		const ProgramCacheHeader hdr = {ProgramCacheMagic, ProgramCacheVersion, driver};
+
+		fwrite(&hdr, sizeof(hdr), 1, fp);
+		fclose(fp);
+	}
+}
+
+GLuint GSShaderOGL::LoadCachedProgram(u64 key)
+{
+	auto it = m_binary_cache.find(key);
+	if(it == m_binary_cache.end())
+		return 0;
+
+	const std::vector<u8>& blob = it->second;
+
+	GLenum bin_format;
+	memcpy(&bin_format, blob.data(), sizeof(bin_format));
+
+	GLuint p = glCreateProgram();
+	glProgramParameteri(p, GL_PROGRAM_SEPARABLE, GL_TRUE);
+	glProgramBinary(p, bin_format, blob.data() + sizeof(bin_format), blob.size() - sizeof(bin_format));
+
+	// The driver is allowed to reject any binary (after an update for
+	// instance, even though the identity hash matched); fall back to a
+	// source compile.
+	GLint status = 0;
+	glGetProgramiv(p, GL_LINK_STATUS, &status);
+	if(!status)
+	{
+		glDeleteProgram(p);
+		return 0;
+	}
+
+	return p;
+}
+
+void GSShaderOGL::StoreProgramBinary(u64 key, GLuint program)
+{
+	GLint status = 0;
+	GLint length = 0;
+
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if(!status || length <= 0)
+		return;
+
+	std::vector<u8> blob(sizeof(GLenum) + length);
+
+	GLenum bin_format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(program, length, &written, &bin_format, blob.data() + sizeof(GLenum));
+
+	if(written <= 0)
+		return;
+
+	memcpy(blob.data(), &bin_format, sizeof(GLenum));
+	blob.resize(sizeof(GLenum) + written);
+
+	const u32 size = (u32)blob.size();
+
+	if(FILE* fp = fopen(m_binary_cache_path.c_str(), "ab"))
+	{
+		fwrite(&key, sizeof(key), 1, fp);
+		fwrite(&size, sizeof(size), 1, fp);
+		fwrite(blob.data(), 1, blob.size(), fp);
+		fclose(fp);
+	}
+
+	m_binary_cache[key] = std::move(blob);
+}
+
+GSShaderOGL::GSShaderOGL() :
 	  m_pipeline(0)
+	, m_binary_cache_enabled(false)
 	, m_common_header(common_glsl_shader_raw, common_glsl_shader_raw + sizeof(common_glsl_shader_raw)/sizeof(*common_glsl_shader_raw))
 {
+	LoadProgramBinaryCache();
+
+	// Ask the driver to compile shaders on its own worker threads where the
+	// extension is available.  Separate shader objects mean first-use
+	// permutations are compiled individually mid-frame, so moving the
+	// compiles off the render thread hides most of that hitch.
+#if defined(ENABLE_GL_KHR_parallel_shader_compile) && defined(GL_KHR_parallel_shader_compile)
+	if (GLExtension::Has("GL_KHR_parallel_shader_compile") && glMaxShaderCompilerThreadsKHR)
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+#endif
+#if defined(ENABLE_GL_ARB_parallel_shader_compile) && defined(GL_ARB_parallel_shader_compile)
+	if (GLExtension::Has("GL_ARB_parallel_shader_compile") && glMaxShaderCompilerThreadsARB)
+		glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+#endif
+
 	// Create a default pipeline
 	m_pipeline = LinkPipeline("HW pipe", 0, 0, 0);
 	BindPipeline(m_pipeline);
@@ -318,6 +516,50 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 	sources[1] = m_common_header.data();
 	sources[2] = glsl_h_code;
 
+	if(m_binary_cache_enabled)
+	{
+		// The generated header covers entry point, stage and macro selection,
+		// so hashing the three source strings identifies the permutation.
+		u64 key = 0xcbf29ce484222325ull;
+		key = ProgramCacheHash(key, sources[0], header.size() + 1);
+		key = ProgramCacheHash(key, sources[1], m_common_header.size());
+		key = ProgramCacheHash(key, sources[2], strlen(glsl_h_code) + 1);
+
+		program = LoadCachedProgram(key);
+
+		if(!program)
+		{
+			// Open-coded glCreateShaderProgramv so the retrievable hint can be
+			// set before the link, without which some drivers keep no binary.
+			GLuint shader = glCreateShader(type);
+			glShaderSource(shader, shader_nb, sources, NULL);
+			glCompileShader(shader);
+
+			program = glCreateProgram();
+			glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+			GLint compiled = 0;
+			glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+
+			if(compiled)
+				glAttachShader(program, shader);
+
+			glLinkProgram(program);
+
+			if(compiled)
+				glDetachShader(program, shader);
+
+			glDeleteShader(shader);
+
+			StoreProgramBinary(key, program);
+		}
+
+		m_prog_to_delete.push_back(program);
+
+		return program;
+	}
+
 	program = glCreateShaderProgramv(type, shader_nb, sources);
 
 	m_prog_to_delete.push_back(program);
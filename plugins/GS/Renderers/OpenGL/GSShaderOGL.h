@@ -36,6 +36,16 @@ class GSShaderOGL {
 	std::vector<GLuint> m_prog_to_delete;
 	std::vector<GLuint> m_pipe_to_delete;
 
+	// On-disk program binary cache, keyed by a hash of the GLSL sources.
+	// See the notes above LoadProgramBinaryCache in GSShaderOGL.cpp.
+	std::unordered_map<u64, std::vector<u8>> m_binary_cache;
+	std::string m_binary_cache_path;
+	bool m_binary_cache_enabled;
+
+	void LoadProgramBinaryCache();
+	GLuint LoadCachedProgram(u64 key);
+	void StoreProgramBinary(u64 key, GLuint program);
+
 	std::string GenGlslHeader(const std::string& entry, GLenum type, const std::string& macro);
 	std::vector<char> m_common_header;
 
@@ -25,6 +25,54 @@
 GSTextureCacheOGL::GSTextureCacheOGL(GSRenderer* r)
 	: GSTextureCache(r)
 {
+	m_predictive_readback = theApp.GetConfigB("UserHacks_predictive_readback");
+}
+
+GSTextureCacheOGL::~GSTextureCacheOGL()
+{
+	// Drop unresolved readbacks without waiting for their transfers.
+	for (AsyncRead& ar : m_async_reads)
+		m_renderer->m_dev->Recycle(ar.tex);
+}
+
+// Deswizzle a mapped offscreen copy back into GS local memory.
+void GSTextureCacheOGL::WriteToLocal(const GIFRegTEX0& TEX0, const GSVector4i& r, const u8* bits, int pitch)
+{
+	GSOffset* off = m_renderer->m_mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM);
+
+	switch(TEX0.PSM)
+	{
+		case PSM_PSMCT32:
+		case PSM_PSMZ32:
+			m_renderer->m_mem.WritePixel32(const_cast<u8*>(bits), pitch, off, r);
+			break;
+		case PSM_PSMCT24:
+		case PSM_PSMZ24:
+			m_renderer->m_mem.WritePixel24(const_cast<u8*>(bits), pitch, off, r);
+			break;
+		case PSM_PSMCT16:
+		case PSM_PSMCT16S:
+		case PSM_PSMZ16:
+		case PSM_PSMZ16S:
+			m_renderer->m_mem.WritePixel16(const_cast<u8*>(bits), pitch, off, r);
+			break;
+
+		default:
+			ASSERT(0);
+	}
+}
+
+void GSTextureCacheOGL::CompleteAsyncRead(size_t i)
+{
+	AsyncRead& ar = m_async_reads[i];
+
+	int pitch;
+	const u8* bits = static_cast<GSTextureOGL*>(ar.tex)->FinishReadback(pitch);
+
+	WriteToLocal(ar.TEX0, ar.r, bits, pitch);
+
+	m_renderer->m_dev->Recycle(ar.tex);
+	m_async_reads.erase(m_async_reads.begin() + i);
 }
 
 void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
@@ -69,6 +117,40 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 
 	GSVector4 src = GSVector4(r) * GSVector4(t->m_texture->GetScale()).xyxy() / GSVector4(t->m_texture->GetSize()).xyxy();
 
+	// Targets which get read back every frame (CLUT/texture feedback loops) are
+	// predicted from their own history: once a target has stalled the pipe a
+	// couple of times, its readbacks go asynchronous and local memory is served
+	// from the shadow copy resolved on the next visit - trading one round of
+	// latency for the glReadPixels drain.
+	const u32 readbacks = ++m_readback_count[TEX0.TBP0];
+
+	if (m_predictive_readback && readbacks > 2)
+	{
+		// Resolve the previous round for this target first, so the shadow copy
+		// in local memory is as fresh as possible before the game samples it.
+		for (size_t i = 0; i < m_async_reads.size(); i++)
+		{
+			if (m_async_reads[i].TEX0.TBP0 == TEX0.TBP0)
+			{
+				CompleteAsyncRead(i);
+				break;
+			}
+		}
+
+		if (GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader))
+		{
+			static_cast<GSTextureOGL*>(offscreen)->StartReadback(GSVector4i(0, 0, r.width(), r.height()));
+
+			m_async_reads.push_back({offscreen, TEX0, r});
+
+			// Don't let stale requests pile up if a target stops being revisited.
+			if (m_async_reads.size() > 8)
+				CompleteAsyncRead(0);
+		}
+
+		return;
+	}
+
 	if(GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader))
 	{
 		GSTexture::GSMap m;
@@ -78,28 +160,7 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 		{
 			// TODO: block level write
 
-			GSOffset* off = m_renderer->m_mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM);
-
-			switch(TEX0.PSM)
-			{
-				case PSM_PSMCT32:
-				case PSM_PSMZ32:
-					m_renderer->m_mem.WritePixel32(m.bits, m.pitch, off, r);
-					break;
-				case PSM_PSMCT24:
-				case PSM_PSMZ24:
-					m_renderer->m_mem.WritePixel24(m.bits, m.pitch, off, r);
-					break;
-				case PSM_PSMCT16:
-				case PSM_PSMCT16S:
-				case PSM_PSMZ16:
-				case PSM_PSMZ16S:
-					m_renderer->m_mem.WritePixel16(m.bits, m.pitch, off, r);
-					break;
-
-				default:
-					ASSERT(0);
-			}
+			WriteToLocal(TEX0, r, m.bits, m.pitch);
 
 			offscreen->Unmap();
 		}
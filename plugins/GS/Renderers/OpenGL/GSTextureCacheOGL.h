@@ -22,11 +22,29 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "../HW/GSTextureCache.h"
 #include "GSDeviceOGL.h"
 
 class GSTextureCacheOGL final : public GSTextureCache
 {
+	// An issued-but-not-resolved asynchronous readback of a predicted target.
+	struct AsyncRead
+	{
+		GSTexture* tex;
+		GIFRegTEX0 TEX0;
+		GSVector4i r;
+	};
+
+	std::unordered_map<u32, u32> m_readback_count;
+	std::vector<AsyncRead> m_async_reads;
+	bool m_predictive_readback;
+
+	void WriteToLocal(const GIFRegTEX0& TEX0, const GSVector4i& r, const u8* bits, int pitch);
+	void CompleteAsyncRead(size_t i);
+
 protected:
 	int Get8bitFormat() { return GL_R8;}
 
@@ -35,4 +53,5 @@ protected:
 
 public:
 	GSTextureCacheOGL(GSRenderer* r);
+	virtual ~GSTextureCacheOGL();
 };
@@ -31,23 +31,30 @@ extern u64 g_real_texture_upload_byte;
 #endif
 
 // FIXME OGL4: investigate, only 1 unpack buffer always bound
+//
+// Staging pool for texture uploads: one large persistent+coherent mapped PBO,
+// carved into small fenced segments.  The CPU streams pixel data into the next
+// free segment and only ever blocks when it laps the GPU inside a segment
+// still being read, so smaller segments mean shorter (and rarer) waits.  The
+// coherent mapping removes the per-upload glFlushMappedBufferRange; the copies
+// themselves use non-temporal stores (see GSTextureOGL::Update).
 namespace PboPool {
 
 	const  u32 m_pbo_size = 64*1024*1024;
-	const  u32 m_seg_size = 16*1024*1024;
+	const  u32 m_seg_size = 4*1024*1024;
 
 	GLuint m_buffer;
 	uptr   m_offset;
 	char*  m_map;
 	u32 m_size;
 	GLsync m_fence[m_pbo_size/m_seg_size];
+	u32 m_segment_dirty_base;
 
 	// Option for buffer storage
-	// XXX: actually does I really need coherent and barrier???
-	// As far as I understand glTexSubImage2D is a client-server transfer so no need to make
-	// the value visible to the server
-	const GLbitfield common_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
-	const GLbitfield map_flags = common_flags | GL_MAP_FLUSH_EXPLICIT_BIT;
+	// Coherent mapping: the driver guarantees visibility of our writes when the
+	// transfer command is issued, no explicit flush record per upload needed.
+	const GLbitfield common_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	const GLbitfield map_flags = common_flags;
 	const GLbitfield create_flags = common_flags | GL_CLIENT_STORAGE_BIT;
 
 	void Init() {
@@ -60,6 +67,7 @@ namespace PboPool {
 		glBufferStorage(GL_PIXEL_UNPACK_BUFFER, m_pbo_size, NULL, create_flags);
 		m_map    = (char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, m_pbo_size, map_flags);
 		m_offset = 0;
+		m_segment_dirty_base = 0;
 
 		for (size_t i = 0; i < countof(m_fence); i++) {
 			m_fence[i] = 0;
@@ -89,7 +97,9 @@ namespace PboPool {
 	}
 
 	void Unmap() {
-		glFlushMappedBufferRange(GL_PIXEL_UNPACK_BUFFER, m_offset, m_size);
+		// The mapping is coherent, but the non-temporal stores used to fill the
+		// segment must be globally visible before the GL reads from it.
+		_mm_sfence();
 	}
 
 	uptr Offset() {
@@ -116,29 +126,36 @@ namespace PboPool {
 		u32 segment_next    = (m_offset + m_size) / m_seg_size;
 
 		if (segment_current != segment_next) {
-			if (segment_next >= countof(m_fence)) {
+			// Number of segments the next transfer spans.  Generally 1; only
+			// huge Map() requests (upscaled targets) straddle several.
+			u32 segment_span = (m_size + m_seg_size - 1) / m_seg_size;
+			if (segment_span > countof(m_fence)) {
+				segment_span = countof(m_fence);
+			}
+
+			if (segment_next + segment_span > countof(m_fence)) {
 				segment_next = 0;
 			}
+
 			// Align current transfer on the start of the segment
 			m_offset = m_seg_size * segment_next;
 
-#if 0
-			if (m_size > m_seg_size) {
-				fprintf(stderr, "BUG: PBO Map size %u is bigger than a single segment %u. Crossing more than one fence is not supported yet, texture data may be corrupted.\n", m_size, m_seg_size);
-				// TODO Synchronize all crossed fences
+			// Protect everything written since the last crossing (a large
+			// transfer can leave more than one segment behind at once).
+			for (u32 i = m_segment_dirty_base; i <= segment_current; i++) {
+				m_fence[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 			}
-#endif
+			m_segment_dirty_base = segment_next;
 
-			// protect the left segment
-			m_fence[segment_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			// Check the segments we are going to write into are free
+			for (u32 i = segment_next; i < segment_next + segment_span; i++) {
+				if (m_fence[i]) {
+					glClientWaitSync(m_fence[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+					// Potentially it doesn't work on AMD driver which might always return GL_CONDITION_SATISFIED
 
-			// Check next segment is free
-			if (m_fence[segment_next]) {
-				GLenum status = glClientWaitSync(m_fence[segment_next], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
-				// Potentially it doesn't work on AMD driver which might always return GL_CONDITION_SATISFIED
-
-				glDeleteSync(m_fence[segment_next]);
-				m_fence[segment_next] = 0;
+					glDeleteSync(m_fence[i]);
+					m_fence[i] = 0;
+				}
 			}
 		}
 	}
@@ -153,7 +170,7 @@ namespace PboPool {
 }
 
 GSTextureOGL::GSTextureOGL(int type, int w, int h, int format, GLuint fbo_read, bool mipmap)
-	: m_clean(false), m_generate_mipmap(true), m_local_buffer(nullptr), m_r_x(0), m_r_y(0), m_r_w(0), m_r_h(0), m_layer(0)
+	: m_clean(false), m_generate_mipmap(true), m_local_buffer(nullptr), m_pack_pbo(0), m_pack_sync(0), m_r_x(0), m_r_y(0), m_r_w(0), m_r_h(0), m_layer(0)
 {
 	// OpenGL didn't like dimensions of size 0
 	m_size.x = std::max(1,w);
@@ -345,6 +362,11 @@ GSTextureOGL::~GSTextureOGL()
 
 	GLState::available_vram += m_mem_usage;
 
+	if (m_pack_sync)
+		glDeleteSync(m_pack_sync);
+	if (m_pack_pbo)
+		glDeleteBuffers(1, &m_pack_pbo);
+
 	if (m_local_buffer)
 		_aligned_free(m_local_buffer);
 }
@@ -399,17 +421,42 @@ bool GSTextureOGL::Update(const GSVector4i& r, const void* data, int pitch, int
 	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); // Restore default behavior
 #endif
 
+	// Uploads bigger than a staging segment would stall on several fences at
+	// once; hand those straight to the GL from client memory instead.
+	if (map_size > PboPool::m_seg_size) {
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, pitch >> m_int_shift);
+
+		glTextureSubImage2D(m_texture_id, layer, r.x, r.y, r.width(), r.height(), m_int_format, m_int_type, data);
+
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); // Restore default behavior
+
+		m_generate_mipmap = true;
+
+		return true;
+	}
+
 	// The complex solution with PBO
 #if 1
 	char* src = (char*)data;
 	char* map = PboPool::Map(map_size);
 
-	// PERF: slow path of the texture upload. Dunno if we could do better maybe check if TC can keep row_byte == pitch
-	// Note: row_byte != pitch
-	for (int h = 0; h < r.height(); h++) {
-		memcpy(map, src, row_byte);
-		map += row_byte;
-		src += pitch;
+	// Fill the write-combined staging segment with non-temporal stores so the
+	// pixel data (only ever read back by the GPU) doesn't wash out the cache.
+	if (row_byte == (u32)pitch && !((uptr)src & 0xF)) {
+		GSVector4i::storent(map, src, map_size);
+	} else if (!((row_byte | (u32)pitch | (uptr)src) & 0xF)) {
+		for (int h = 0; h < r.height(); h++) {
+			GSVector4i::storent(map, src, row_byte);
+			map += row_byte;
+			src += pitch;
+		}
+	} else {
+		// Note: row_byte != pitch
+		for (int h = 0; h < r.height(); h++) {
+			memcpy(map, src, row_byte);
+			map += row_byte;
+			src += pitch;
+		}
 	}
 
 	PboPool::Unmap();
@@ -508,6 +555,55 @@ void GSTextureOGL::Unmap()
 	}
 }
 
+void GSTextureOGL::StartReadback(const GSVector4i& r)
+{
+	ASSERT(m_type == GSTexture::Offscreen);
+
+	const u32 size = (r.width() * r.height()) << m_int_shift;
+
+	if (!m_pack_pbo)
+		glCreateBuffers(1, &m_pack_pbo);
+
+	// Same read setup as the synchronous Map path, except the destination is a
+	// pack pbo so glReadPixels queues the transfer instead of draining the pipe.
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo_read);
+	glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture_id, 0);
+
+	glPixelStorei(GL_PACK_ALIGNMENT, 1u << m_int_shift);
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pack_pbo);
+	glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+	glReadPixels(r.x, r.y, r.width(), r.height(), m_int_format, m_int_type, NULL);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, GL_DEFAULT_FRAMEBUFFER);
+
+	if (m_pack_sync)
+		glDeleteSync(m_pack_sync);
+	m_pack_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	m_r_w = r.width();
+	m_r_h = r.height();
+}
+
+u8* GSTextureOGL::FinishReadback(int& pitch)
+{
+	if (m_pack_sync) {
+		glClientWaitSync(m_pack_sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+		glDeleteSync(m_pack_sync);
+		m_pack_sync = 0;
+	}
+
+	const u32 size = (m_r_w * m_r_h) << m_int_shift;
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pack_pbo);
+	glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, size, m_local_buffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	pitch = m_r_w << m_int_shift;
+	return m_local_buffer;
+}
+
 void GSTextureOGL::GenerateMipmap()
 {
 	if (m_generate_mipmap && m_max_layer > 1) {
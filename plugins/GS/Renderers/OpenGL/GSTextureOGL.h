@@ -49,6 +49,9 @@ class GSTextureOGL final : public GSTexture
 		bool m_generate_mipmap;
 
 		u8* m_local_buffer;
+		// Async offscreen readback (pack pbo + fence), see StartReadback/FinishReadback
+		GLuint m_pack_pbo;
+		GLsync m_pack_sync;
 		// Avoid alignment constrain
 		//GSVector4i m_r;
 		int m_r_x;
@@ -75,6 +78,13 @@ class GSTextureOGL final : public GSTexture
 		void Unmap() final;
 		void GenerateMipmap() final;
 
+		// Non-blocking alternative to Map for Offscreen textures: StartReadback
+		// queues the pixel transfer into a pack pbo and returns immediately,
+		// FinishReadback (typically called much later) resolves it into the
+		// local buffer.
+		void StartReadback(const GSVector4i& r);
+		u8* FinishReadback(int& pitch);
+
 		bool IsBackbuffer() { return (m_type == GSTexture::Backbuffer); }
 		bool IsDss() { return (m_type == GSTexture::DepthStencil || m_type == GSTexture::SparseDepthStencil); }
 
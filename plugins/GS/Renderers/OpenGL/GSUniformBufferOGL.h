@@ -98,20 +98,30 @@ public:
 };
 
 #define UBO_BUFFER_SIZE (4*1024*1024)
+#define UBO_CHUNK_SHIFT (20) // 4 chunks of 1MB
 
+// Persistent-coherent ring, used for the per-draw VS/PS uniform streams. An
+// upload is a memcpy plus a glBindBufferRange; chunk fences keep the CPU from
+// overwriting data a frame still in flight.
 class GSUniformBufferStorageOGL {
 	GLuint m_buffer;		// data object
 	GLuint m_index;		// GLSL slot
 	u32 m_size;	    // size of the data
 	u8* m_buffer_ptr;
 	u32 m_offset;
+	size_t m_chunk;
+	GLsync m_fence[4];
 
 public:
-	GSUniformBufferStorageOGL(GLuint index, u32 size) : m_index(index)
-												  , m_size(size), m_offset(0)
+	GSUniformBufferStorageOGL(const std::string& pretty_name, GLuint index, u32 size) : m_index(index)
+												  , m_size(size), m_offset(0), m_chunk(0)
 	{
+		for (size_t i = 0; i < 4; i++)
+			m_fence[i] = 0;
+
 		glGenBuffers(1, &m_buffer);
 		bind();
+		glObjectLabel(GL_BUFFER, m_buffer, pretty_name.size(), pretty_name.c_str());
 		allocate();
 		attach();
 	}
@@ -126,9 +136,11 @@ public:
 
 	void allocate()
 	{
-		const GLbitfield common_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT /*| GL_MAP_COHERENT_BIT */;
-		const GLbitfield map_flags = common_flags | GL_MAP_FLUSH_EXPLICIT_BIT;
-		const GLbitfield create_flags = common_flags /*| GL_CLIENT_STORAGE_BIT */;
+		// Coherent mapping, same as the vertex/index rings: no explicit
+		// flush needed after a write.
+		const GLbitfield common_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLbitfield map_flags = common_flags;
+		const GLbitfield create_flags = common_flags;
 
 		GLsizei buffer_size = UBO_BUFFER_SIZE;
 		glBufferStorage(GL_UNIFORM_BUFFER, buffer_size, NULL, create_flags);
@@ -151,19 +163,36 @@ public:
 		g_uniform_upload_byte += m_size;
 #endif
 
+		if (m_offset + m_size > UBO_BUFFER_SIZE)
+			m_offset = 0;
+
+		// Same scheme as GSBufferOGL: when the write cursor enters a new
+		// chunk, fence the one it leaves and wait (normally already
+		// signaled) on the fence of the chunk about to be reused.
+		size_t chunk = m_offset >> UBO_CHUNK_SHIFT;
+		if (chunk != m_chunk) {
+			m_fence[m_chunk] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			if (m_fence[chunk]) {
+				glClientWaitSync(m_fence[chunk], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+				glDeleteSync(m_fence[chunk]);
+				m_fence[chunk] = 0;
+			}
+			m_chunk = chunk;
+		}
+
 		memcpy(m_buffer_ptr + m_offset, src, m_size);
 
 		attach();
-		glFlushMappedBufferRange(GL_UNIFORM_BUFFER, m_offset, m_size);
 
 		m_offset = (m_offset + m_size + 255u) & ~0xFF;
-		if (m_offset >= UBO_BUFFER_SIZE)
-			m_offset = 0;
 	}
 
 	~GSUniformBufferStorageOGL() {
+		for (size_t i = 0; i < 4; i++)
+			glDeleteSync(m_fence[i]);
 		glDeleteBuffers(1, &m_buffer);
 	}
 };
 
 #undef UBO_BUFFER_SIZE
+#undef UBO_CHUNK_SHIFT
@@ -75,9 +75,10 @@ class GSBufferOGL {
 		else
 			glObjectLabel(GL_BUFFER, m_buffer_name, -1, "VBO");
 
-		// coherency will be done by flushing
-		const GLbitfield common_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
-		const GLbitfield map_flags = common_flags | GL_MAP_FLUSH_EXPLICIT_BIT;
+		// Coherent mapping: writes hit GPU-visible memory directly, so no
+		// glFlushMappedBufferRange round-trip is needed after each upload.
+		const GLbitfield common_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLbitfield map_flags = common_flags;
 		const GLbitfield create_flags = common_flags | GL_CLIENT_STORAGE_BIT;
 
 		glBufferStorage(m_target, STRIDE * m_limit, NULL, create_flags );
@@ -169,7 +170,7 @@ class GSBufferOGL {
 
 	void unmap()
 	{
-		glFlushMappedBufferRange(m_target, m_start * STRIDE, m_count * STRIDE);
+		// Nothing to do, the mapping is coherent.
 	}
 
 	void upload(const void* src, size_t count)
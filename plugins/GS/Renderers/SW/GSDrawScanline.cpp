@@ -281,6 +281,28 @@ void GSDrawScanline::FillBlock(const int* RESTRICT row, const int* RESTRICT col,
 
 	T* vm = (T*)m_global.vm;
 
+#if GS_AVX512
+
+	GSVector16i c512 = GSVector16i::broadcast256(c);
+	GSVector16i m512 = GSVector16i::broadcast256(m);
+
+	for(int y = r.y; y < r.w; y += 8)
+	{
+		T* RESTRICT d = &vm[row[y]];
+
+		for(int x = r.x; x < r.z; x += 8 * 4 / sizeof(T))
+		{
+			u8* RESTRICT p = (u8*)&d[col[x]];
+
+			for(int i = 0; i < 256; i += 64)
+			{
+				GSVector16i::store(p + i, !masked ? c512 : (c512 | (GSVector16i::load(p + i) & m512)));
+			}
+		}
+	}
+
+#else
+
 	for(int y = r.y; y < r.w; y += 8)
 	{
 		T* RESTRICT d = &vm[row[y]];
@@ -299,6 +321,8 @@ void GSDrawScanline::FillBlock(const int* RESTRICT row, const int* RESTRICT col,
 			p[7] = !masked ? c : (c | (p[7] & m));
 		}
 	}
+
+#endif
 }
 
 #else
@@ -310,6 +334,28 @@ void GSDrawScanline::FillBlock(const int* RESTRICT row, const int* RESTRICT col,
 
 	T* vm = (T*)m_global.vm;
 
+#if GS_AVX512
+
+	GSVector16i c512 = GSVector16i::broadcast128(c);
+	GSVector16i m512 = GSVector16i::broadcast128(m);
+
+	for(int y = r.y; y < r.w; y += 8)
+	{
+		T* RESTRICT d = &vm[row[y]];
+
+		for(int x = r.x; x < r.z; x += 8 * 4 / sizeof(T))
+		{
+			u8* RESTRICT p = (u8*)&d[col[x]];
+
+			for(int i = 0; i < 256; i += 64)
+			{
+				GSVector16i::store(p + i, !masked ? c512 : (c512 | (GSVector16i::load(p + i) & m512)));
+			}
+		}
+	}
+
+#else
+
 	for(int y = r.y; y < r.w; y += 8)
 	{
 		T* RESTRICT d = &vm[row[y]];
@@ -327,6 +373,8 @@ void GSDrawScanline::FillBlock(const int* RESTRICT row, const int* RESTRICT col,
 			}
 		}
 	}
+
+#endif
 }
 
 #endif
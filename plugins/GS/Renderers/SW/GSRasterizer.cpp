@@ -45,20 +45,38 @@ GSRasterizer::GSRasterizer(IDrawScanline* ds, int id, int threads)
 {
 	memset(&m_pixels, 0, sizeof(m_pixels));
 
-	m_thread_height = compute_best_thread_height(threads);
+	m_setup_last = 0;
+	m_setup_valid = false;
 
 	m_edge.buff = (GSVertexSW*)vmalloc(sizeof(GSVertexSW) * 2048, false);
 	m_edge.count = 0;
 
-	int rows = (2048 >> m_thread_height) + 16;
-	m_scanline = (u8*)_aligned_malloc(rows, 64);
+	// Sized for the smallest strip height (one scanline per row) plus the slack
+	// FindMyNextScanline() needs to run past the bottom of the table.
+	m_scanline = (u8*)_aligned_malloc(2048 + 16 + 64, 64);
+
+	m_thread_height = -1;
+
+	SetThreadHeight(compute_best_thread_height(threads));
+}
+
+// Rebuilds the strip ownership table for the given strip height. The height is
+// now per-draw (see GSRasterizerList::Queue), so this gets called whenever a
+// draw uses a different interleave than the previous one.
+void GSRasterizer::SetThreadHeight(int th)
+{
+	if(th == m_thread_height) return;
+
+	m_thread_height = th;
+
+	int rows = (2048 >> th) + 16;
 
 	int row = 0;
 
 	while(row < rows)
 	{
-		for(int i = 0; i < threads; i++, row++)
-			m_scanline[row] = i == id ? 1 : 0;
+		for(int i = 0; i < m_threads; i++, row++)
+			m_scanline[row] = i == m_id ? 1 : 0;
 	}
 }
 
@@ -131,11 +149,19 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 {
 	if(data->vertex != NULL && data->vertex_count == 0 || data->index != NULL && data->index_count == 0) return;
 
+	SetThreadHeight(data->thread_height);
+
 	m_pixels.actual = 0;
 	m_pixels.total = 0;
 
 	m_ds->BeginDraw(data);
 
+	// index of the provoking vertex per prim class (flat color / sprite uv)
+	static const int s_provoking[4] = {0, 1, 2, 1};
+
+	m_setup_last = s_provoking[data->primclass];
+	m_setup_valid = false; // BeginDraw switched the selector/jitted setup
+
 	const GSVertexSW* vertex = data->vertex;
 	const GSVertexSW* vertex_end = data->vertex + data->vertex_count;
 
@@ -240,7 +266,7 @@ void GSRasterizer::DrawPoint(const GSVertexSW* vertex, int vertex_count, const u
 			{
 				if(IsOneOfMyScanlines(p.y))
 				{
-					m_ds->SetupPrim(vertex, index, GSVertexSW::zero());
+					SetupPrim(vertex, index, GSVertexSW::zero());
 
 					DrawScanline(1, p.x, p.y, v);
 				}
@@ -261,7 +287,7 @@ void GSRasterizer::DrawPoint(const GSVertexSW* vertex, int vertex_count, const u
 			{
 				if(IsOneOfMyScanlines(p.y))
 				{
-					m_ds->SetupPrim(vertex, tmp_index, GSVertexSW::zero());
+					SetupPrim(vertex, tmp_index, GSVertexSW::zero());
 
 					DrawScanline(1, p.x, p.y, v);
 				}
@@ -327,7 +353,7 @@ void GSRasterizer::DrawLine(const GSVertexSW* vertex, const u32* index)
 
 					scan += dscan * (l - scan.p).xxxx();
 
-					m_ds->SetupPrim(vertex, index, dscan);
+					SetupPrim(vertex, index, dscan);
 
 					DrawScanline(pixels, left, p.y, scan);
 				}
@@ -841,7 +867,7 @@ void GSRasterizer::DrawSprite(const GSVertexSW* vertex, const u32* index)
 	if((m & 2) == 0) scan.t += dedge.t * prestep.yyyy();
 	if((m & 1) == 0) scan.t += dscan.t * prestep.xxxx();
 
-	m_ds->SetupPrim(vertex, index, dscan);
+	SetupPrim(vertex, index, dscan);
 
 	while(1)
 	{
@@ -1047,6 +1073,38 @@ void GSRasterizer::DrawEdge(const GSVertexSW& v0, const GSVertexSW& v1, const GS
 	m_edge.count += e - &m_edge.buff[m_edge.count];
 }
 
+void GSRasterizer::SetupPrim(const GSVertexSW* vertex, const u32* index, const GSVertexSW& dscan)
+{
+	const GSVertexSW& v = vertex[index[m_setup_last]];
+
+	if(m_setup_valid)
+	{
+		// Integer compare: a spurious mismatch (-0.0f vs 0.0f) only costs a
+		// redundant setup, never a wrong skip.
+		GSVector4i eq =
+			(GSVector4i::cast(dscan.p) == GSVector4i::cast(m_setup_dscan.p)) &
+			(GSVector4i::cast(dscan.t) == GSVector4i::cast(m_setup_dscan.t)) &
+			(GSVector4i::cast(dscan.c) == GSVector4i::cast(m_setup_dscan.c)) &
+			(GSVector4i::cast(v.p) == GSVector4i::cast(m_setup_vert.p)) &
+			(GSVector4i::cast(v.t) == GSVector4i::cast(m_setup_vert.t)) &
+			(GSVector4i::cast(v.c) == GSVector4i::cast(m_setup_vert.c));
+
+		if(eq.alltrue()) return;
+	}
+
+	m_ds->SetupPrim(vertex, index, dscan);
+
+	m_setup_dscan.p = dscan.p;
+	m_setup_dscan.t = dscan.t;
+	m_setup_dscan.c = dscan.c;
+
+	m_setup_vert.p = v.p;
+	m_setup_vert.t = v.t;
+	m_setup_vert.c = v.c;
+
+	m_setup_valid = true;
+}
+
 void GSRasterizer::AddScanline(GSVertexSW* e, int pixels, int left, int top, const GSVertexSW& scan)
 {
 	*e = scan;
@@ -1064,7 +1122,7 @@ void GSRasterizer::Flush(const GSVertexSW* vertex, const u32* index, const GSVer
 
 	if(count > 0)
 	{
-		m_ds->SetupPrim(vertex, index, dscan);
+		SetupPrim(vertex, index, dscan);
 
 		const GSVertexSW* RESTRICT e = m_edge.buff;
 		const GSVertexSW* RESTRICT ee = e + count;
@@ -1130,24 +1188,10 @@ void GSRasterizer::DrawEdge(int pixels, int left, int top, const GSVertexSW& sca
 GSRasterizerList::GSRasterizerList(int threads)
 {
 	m_thread_height = compute_best_thread_height(threads);
-
-	int rows = (2048 >> m_thread_height) + 16;
-	m_scanline = (u8*)_aligned_malloc(rows, 64);
-
-	int row = 0;
-
-	while(row < rows)
-	{
-		for(int i = 0; i < threads; i++, row++)
-		{
-			m_scanline[row] = (u8)i;
-		}
-	}
 }
 
 GSRasterizerList::~GSRasterizerList()
 {
-	_aligned_free(m_scanline);
 }
 
 void GSRasterizerList::Queue(const std::shared_ptr<GSRasterizerData>& data)
@@ -1156,12 +1200,24 @@ void GSRasterizerList::Queue(const std::shared_ptr<GSRasterizerData>& data)
 
 	ASSERT(r.top >= 0 && r.top < 2048 && r.bottom >= 0 && r.bottom < 2048);
 
-	int top = r.top >> m_thread_height;
-	int bottom = std::min<int>((r.bottom + (1 << m_thread_height) - 1) >> m_thread_height, top + m_workers.size());
+	// Shrink the strip height for short draws so they still cover every worker.
+	// With the fixed interleave a draw concentrated in a few strips (large
+	// full-screen sprites are the usual case) lands on one or two threads and
+	// the rest idle through it.
+	int th = m_thread_height;
+
+	while(th > 0 && ((r.bottom - r.top) >> th) < (int)m_workers.size())
+		th--;
+
+	data->thread_height = th;
+
+	int top = r.top >> th;
+	int bottom = std::min<int>((r.bottom + (1 << th) - 1) >> th, top + (int)m_workers.size());
 
 	while(top < bottom)
 	{
-		m_workers[m_scanline[top++]]->Push(data);
+		m_workers[top % (int)m_workers.size()]->Push(data);
+		top++;
 	}
 }
 
@@ -44,6 +44,7 @@ public:
 	u64 frame;
 	int pixels;
 	int counter;
+	int thread_height; // strip interleave (log2 of rows) the rasterizers use for this draw
 
 	GSRasterizerData() 
 		: scissor(GSVector4i::zero())
@@ -56,6 +57,7 @@ public:
 		, index_count(0)
 		, frame(0)
 		, pixels(0)
+		, thread_height(4)
 	{
 		counter = s_counter++;
 	}
@@ -121,6 +123,17 @@ protected:
 	struct {GSVertexSW* buff; int count;} m_edge;
 	struct {int sum, actual, total;} m_pixels;
 
+	// Redundant SetupPrim elimination.  The jitted setup only reads dscan and
+	// the provoking vertex (flat color, sprite depth/uv), so prims repeating
+	// the same gradients - quads split into two triangles, or static geometry
+	// redrawn every frame - can reuse the deltas already in the scanline
+	// local data.  Invalidated on every Draw since BeginDraw switches the
+	// selector (and with it the jitted setup).
+	GSVertexSW m_setup_dscan;
+	GSVertexSW m_setup_vert;
+	int m_setup_last;
+	bool m_setup_valid;
+
 	typedef void (GSRasterizer::*DrawPrimPtr)(const GSVertexSW* v, int count);
 
 	template<bool scissor_test>
@@ -137,6 +150,8 @@ protected:
 
 	void DrawEdge(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& dv, int orientation, int side);
 
+	__forceinline void SetupPrim(const GSVertexSW* vertex, const u32* index, const GSVertexSW& dscan);
+
 	__forceinline void AddScanline(GSVertexSW* e, int pixels, int left, int top, const GSVertexSW& scan);
 	__forceinline void Flush(const GSVertexSW* vertex, const u32* index, const GSVertexSW& dscan, bool edge = false);
 
@@ -147,6 +162,8 @@ public:
 	GSRasterizer(IDrawScanline* ds, int id, int threads);
 	virtual ~GSRasterizer();
 
+	void SetThreadHeight(int th);
+
 	__forceinline bool IsOneOfMyScanlines(int top) const;
 	__forceinline bool IsOneOfMyScanlines(int top, int bottom) const;
 	__forceinline int FindMyNextScanline(int top) const;
@@ -169,7 +186,6 @@ protected:
 	// Worker threads depend on the rasterizers, so don't change the order.
 	std::vector<std::unique_ptr<GSRasterizer>> m_r;
 	std::vector<std::unique_ptr<GSWorker>> m_workers;
-	u8* m_scanline;
 	int m_thread_height;
 
 	GSRasterizerList(int threads);
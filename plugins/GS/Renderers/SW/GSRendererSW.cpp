@@ -22,6 +22,136 @@
 #include "Pcsx2Types.h"
 
 #include "GSRendererSW.h"
+#include "options_tools.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Recycling pool for the per-draw scratch buffers (vertex/index copy, clut,
+// dithering matrix).  One draw used to cost up to three _aligned_malloc /
+// _aligned_free pairs; SharedData returns its buffers here instead, so a
+// steady state frame never touches the heap.  SharedData can be released by
+// whichever thread drops the last reference, hence the lock.
+namespace
+{
+	class ScratchPool
+	{
+		static const int NBUCKETS = 10;          // MIN_BUCKET << b, up to 2MB
+		static const size_t MIN_BUCKET = 4096;
+		static const size_t HEADER = 64;         // keeps the user pointer 64 byte aligned
+		static const size_t MAX_FREE = 64;       // per bucket, release beyond this
+
+		std::mutex m_lock;
+		std::vector<void*> m_free[NBUCKETS];
+
+		// Outstanding bytes (bucket capacity, not request size) and the peak
+		// since the last report, for sizing the pool against real workloads.
+		std::atomic<size_t> m_live;
+		std::atomic<size_t> m_peak;
+
+		void Account(size_t cap)
+		{
+			size_t live = m_live += cap;
+			size_t peak = m_peak.load(std::memory_order_relaxed);
+
+			while (live > peak && !m_peak.compare_exchange_weak(peak, live))
+				;
+		}
+
+		static int BucketFor(size_t size)
+		{
+			int b = 0;
+
+			while ((MIN_BUCKET << b) < size)
+				b++;
+
+			return b;
+		}
+
+	public:
+		ScratchPool()
+			: m_live(0)
+			, m_peak(0)
+		{
+		}
+
+		~ScratchPool()
+		{
+			for (int b = 0; b < NBUCKETS; b++)
+				for (void* p : m_free[b])
+					_aligned_free(p);
+		}
+
+		void* Alloc(size_t size)
+		{
+			u8* raw;
+
+			if (size > (MIN_BUCKET << (NBUCKETS - 1)))
+			{
+				// Oversized request, don't pool it.
+				raw = (u8*)_aligned_malloc(HEADER + size, 64);
+				if (raw == NULL) return NULL;
+				*(u32*)raw = ~0u;
+				*(u32*)(raw + 4) = (u32)size;
+				Account(size);
+				return raw + HEADER;
+			}
+
+			const int b = BucketFor(size);
+
+			Account(MIN_BUCKET << b);
+
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if (!m_free[b].empty())
+				{
+					raw = (u8*)m_free[b].back();
+					m_free[b].pop_back();
+					return raw + HEADER;
+				}
+			}
+
+			raw = (u8*)_aligned_malloc(HEADER + (MIN_BUCKET << b), 64);
+			if (raw == NULL) return NULL;
+			*(u32*)raw = (u32)b;
+			return raw + HEADER;
+		}
+
+		void Free(void* p)
+		{
+			if (p == NULL) return;
+
+			u8* raw = (u8*)p - HEADER;
+			const u32 b = *(u32*)raw;
+
+			m_live -= (b != ~0u) ? (MIN_BUCKET << b) : *(u32*)(raw + 4);
+
+			if (b != ~0u)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if (m_free[b].size() < MAX_FREE)
+				{
+					m_free[b].push_back(raw);
+					return;
+				}
+			}
+
+			_aligned_free(raw);
+		}
+
+		// Returns the high-water mark since the last call and restarts the
+		// window at the current outstanding size.
+		size_t DrainPeak()
+		{
+			return m_peak.exchange(m_live.load(std::memory_order_relaxed));
+		}
+	};
+
+	ScratchPool s_scratch_pool;
+}
 
 GSVector4 GSRendererSW::m_pos_scale;
 #if _M_SSE >= 0x501
@@ -57,6 +187,9 @@ GSRendererSW::GSRendererSW(int threads)
 		m_tex_pages[i] = 0;
 	}
 
+	memset(m_skip_dirty_pages, 0, sizeof(m_skip_dirty_pages));
+	m_skip_dirty = false;
+
 	#define InitCVB2(P, Q) \
 		m_cvb[P][0][0][Q] = &GSRendererSW::ConvertVertexBuffer<P, 0, 0, Q>; \
 		m_cvb[P][0][1][Q] = &GSRendererSW::ConvertVertexBuffer<P, 0, 1, Q>; \
@@ -108,6 +241,17 @@ void GSRendererSW::VSync(int field)
 	Sync(0); // IncAge might delete a cached texture in use
 	GSRenderer::VSync(field);
 	m_tc->IncAge();
+
+	// Scratch pool high-water mark, same reporting cadence as the merge
+	// statistics in GSRenderer::VSync.
+	static u32 s_scratch_frames = 0;
+
+	if(++s_scratch_frames == 600)
+	{
+		s_scratch_frames = 0;
+
+		log_cb(RETRO_LOG_DEBUG, "GS: scratch pool peak %zu KB over last 600 frames\n", s_scratch_pool.DrainPeak() / 1024);
+	}
 }
 
 void GSRendererSW::ResetDevice()
@@ -133,15 +277,33 @@ GSTexture* GSRendererSW::GetOutput(int i, int& y_offset)
 
 	if(m_dev->ResizeTexture(&m_texture[i], w, h))
 	{
-		static int pitch = 1024 * 4;
-
 		GSVector4i r(0, 0, w, h);
 
 		const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[DISPFB.PSM];
 
-		(m_mem.*psm.rtx)(m_mem.GetOffset(DISPFB.Block(), DISPFB.FBW, DISPFB.PSM), r.ralign<Align_Outside>(psm.bs), m_output, pitch, m_env.TEXA);
+		const GSVector4i ra = r.ralign<Align_Outside>(psm.bs);
+
+		GSTexture::GSMap m;
+
+		// Read the frame straight into the texture's staging memory when the
+		// display rect is block aligned (it virtually always is: FBW rounds
+		// the width to a multiple of 64), skipping the bounce through
+		// m_output.  Presentation itself is already zero-copy - the frontend
+		// gets the finished texture through the hw-render interface.
+		if(ra.eq(r) && m_texture[i]->Map(m, &r))
+		{
+			(m_mem.*psm.rtx)(m_mem.GetOffset(DISPFB.Block(), DISPFB.FBW, DISPFB.PSM), ra, m.bits, m.pitch, m_env.TEXA);
+
+			m_texture[i]->Unmap();
+		}
+		else
+		{
+			static int pitch = 1024 * 4;
 
-		m_texture[i]->Update(r, m_output, pitch);
+			(m_mem.*psm.rtx)(m_mem.GetOffset(DISPFB.Block(), DISPFB.FBW, DISPFB.PSM), ra, m_output, pitch, m_env.TEXA);
+
+			m_texture[i]->Update(r, m_output, pitch);
+		}
 	}
 
 	return m_texture[i];
@@ -173,7 +335,7 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 	GSVector8i o2((GSVector4i)m_context->XYOFFSET);
 	GSVector8 tsize2(GSVector4(0x10000 << m_context->TEX0.TW, 0x10000 << m_context->TEX0.TH, 1, 0));
 
-	for(int i = (int)m_vertex.next; i > 0; i -= 2, src += 2, dst += 2) // ok to overflow, allocator makes sure there is one more dummy vertex
+	for(int i = (int)count; i > 0; i -= 2, src += 2, dst += 2) // ok to overflow, allocator makes sure there is one more dummy vertex
 	{
 		GSVector8i v0 = GSVector8i::load<true>(src[0].m);
 		GSVector8i v1 = GSVector8i::load<true>(src[1].m);
@@ -247,7 +409,7 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 
 	#endif
 
-	for(int i = (int)m_vertex.next; i > 0; i--, src++, dst++)
+	for(int i = (int)count; i > 0; i--, src++, dst++)
 	{
 		GSVector4 stcq = GSVector4::load<true>(&src->m[0]); // s t rgba q
 
@@ -336,6 +498,21 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 
 void GSRendererSW::Draw()
 {
+	// During skipped frames the vertex kick handlers are NOP'd, but a prim in
+	// flight across the toggle can still leave vertices behind - make sure
+	// nothing reaches the rasterizer.
+	if (m_frameskip)
+		return;
+
+	// Settle invalidations deferred while frames were being skipped before the
+	// texture cache is consulted again.
+	if (m_skip_dirty)
+	{
+		m_tc->InvalidateDirtyPages(m_skip_dirty_pages);
+		memset(m_skip_dirty_pages, 0, sizeof(m_skip_dirty_pages));
+		m_skip_dirty = false;
+	}
+
 	const GSDrawingContext* context = m_context;
 
 	SharedData* sd = new SharedData(this);
@@ -343,7 +520,7 @@ void GSRendererSW::Draw()
 	std::shared_ptr<GSRasterizerData> data(sd);
 
 	sd->primclass = m_vt.m_primclass;
-	sd->buff = (u8*)_aligned_malloc(sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(u32) * m_index.tail, 64);
+	sd->buff = (u8*)s_scratch_pool.Alloc(sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1) + sizeof(u32) * m_index.tail);
 	sd->vertex = (GSVertexSW*)sd->buff;
 	sd->vertex_count = m_vertex.next;
 	sd->index = (u32*)(sd->buff + sizeof(GSVertexSW) * ((m_vertex.next + 1) & ~1));
@@ -386,14 +563,19 @@ void GSRendererSW::Draw()
 	u32* fb_pages = NULL;
 	u32* zb_pages = NULL;
 
+	// The page lists travel with SharedData and are released from whichever
+	// thread drops it, so they come from the scratch pool like the rest of
+	// the per-draw data (GetPages fills a caller buffer sized for the worst
+	// case instead of sizing one on the heap).
+
 	if(sd->global.sel.fb)
 	{
-		fb_pages = m_context->offset.fb->GetPages(r);
+		fb_pages = m_context->offset.fb->GetPages(r, (u32*)s_scratch_pool.Alloc(sizeof(u32) * (MAX_PAGES + 1)));
 	}
 
 	if(sd->global.sel.zb)
 	{
-		zb_pages = m_context->offset.zb->GetPages(r);
+		zb_pages = m_context->offset.zb->GetPages(r, (u32*)s_scratch_pool.Alloc(sizeof(u32) * (MAX_PAGES + 1)));
 	}
 
 	// check if there is an overlap between this and previous targets
@@ -482,6 +664,19 @@ void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 		}
 	}
 
+	if (m_frameskip)
+	{
+		// Draws are elided while skipping, so nothing consults the texture
+		// cache until the next rendered frame; batch the dirty pages into a
+		// bitmap and invalidate them in one pass when drawing resumes.
+		for (u32* RESTRICT p = m_tmp_pages; *p != GSOffset::EOP; p++)
+			m_skip_dirty_pages[*p >> 5] |= 1u << (*p & 31);
+
+		m_skip_dirty = true;
+
+		return;
+	}
+
 	m_tc->InvalidatePages(m_tmp_pages, off->psm); // if texture update runs on a thread and Sync(5) happens then this must come later
 }
 
@@ -563,8 +758,8 @@ bool GSRendererSW::CheckTargetPages(const u32* fb_pages, const u32* zb_pages, co
 		m_fzb = m_context->offset.fzb4;
 		m_fzb_bbox = r;
 
-		if(fb_pages == NULL) fb_pages = m_context->offset.fb->GetPages(r);
-		if(zb_pages == NULL) zb_pages = m_context->offset.zb->GetPages(r);
+		if(fb_pages == NULL) fb_pages = m_context->offset.fb->GetPages(r, (u32*)s_scratch_pool.Alloc(sizeof(u32) * (MAX_PAGES + 1)));
+		if(zb_pages == NULL) zb_pages = m_context->offset.zb->GetPages(r, (u32*)s_scratch_pool.Alloc(sizeof(u32) * (MAX_PAGES + 1)));
 
 		memset(m_fzb_cur_pages, 0, sizeof(m_fzb_cur_pages));
 
@@ -690,8 +885,8 @@ bool GSRendererSW::CheckTargetPages(const u32* fb_pages, const u32* zb_pages, co
 		}
 	}
 
-	if(!fb && fb_pages != NULL) delete [] fb_pages;
-	if(!zb && zb_pages != NULL) delete [] zb_pages;
+	if(!fb && fb_pages != NULL) s_scratch_pool.Free((void*)fb_pages);
+	if(!zb && zb_pages != NULL) s_scratch_pool.Free((void*)zb_pages);
 
 	return res;
 }
@@ -825,7 +1020,7 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 			{
 				gd.sel.tlu = 1;
 
-				gd.clut = (u32*)_aligned_malloc(sizeof(u32) * 256, 32); // FIXME: might address uninitialized data of the texture (0xCD) that is not in 0-15 range for 4-bpp formats
+				gd.clut = (u32*)s_scratch_pool.Alloc(sizeof(u32) * 256); // FIXME: might address uninitialized data of the texture (0xCD) that is not in 0-15 range for 4-bpp formats
 
 				memcpy(gd.clut, (const u32*)m_mem.m_clut, sizeof(u32) * GSLocalMemory::m_psm[context->TEX0.PSM].pal);
 			}
@@ -1094,7 +1289,7 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 		{
 			gd.sel.dthe = 1;
 
-			gd.dimx = (GSVector4i*)_aligned_malloc(sizeof(env.dimx), 32);
+			gd.dimx = (GSVector4i*)s_scratch_pool.Alloc(sizeof(env.dimx));
 
 			memcpy(gd.dimx, env.dimx, sizeof(env.dimx));
 		}
@@ -1191,6 +1386,16 @@ bool GSRendererSW::GetScanlineGlobalData(SharedData* data)
 	return true;
 }
 
+void* GSRendererSW::SharedData::operator new(size_t size)
+{
+	return s_scratch_pool.Alloc(size);
+}
+
+void GSRendererSW::SharedData::operator delete(void* p)
+{
+	s_scratch_pool.Free(p);
+}
+
 GSRendererSW::SharedData::SharedData(GSRendererSW* parent)
 	: m_parent(parent)
 	, m_fb_pages(NULL)
@@ -1212,8 +1417,13 @@ GSRendererSW::SharedData::~SharedData()
 {
 	ReleasePages();
 
-	if(global.clut) _aligned_free(global.clut);
-	if(global.dimx) _aligned_free(global.dimx);
+	// Return the scratch buffers to the pool before the base destructor
+	// would hand them to _aligned_free.
+	s_scratch_pool.Free(buff);
+	buff = NULL;
+
+	if(global.clut) s_scratch_pool.Free(global.clut);
+	if(global.dimx) s_scratch_pool.Free(global.dimx);
 }
 
 //static TransactionScope::Lock s_lock;
@@ -1272,8 +1482,8 @@ void GSRendererSW::SharedData::ReleasePages()
 		}
 	}
 
-	delete [] m_fb_pages;
-	delete [] m_zb_pages;
+	s_scratch_pool.Free((void*)m_fb_pages);
+	s_scratch_pool.Free((void*)m_zb_pages);
 
 	m_fb_pages = NULL;
 	m_zb_pages = NULL;
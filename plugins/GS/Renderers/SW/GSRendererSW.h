@@ -55,6 +55,12 @@ class GSRendererSW : public GSRenderer
 		SharedData(GSRendererSW* parent);
 		virtual ~SharedData();
 
+		// One SharedData per draw, released by whichever thread drops the
+		// last reference; allocated from the renderer's scratch pool instead
+		// of the global heap (overrides GSAlignedClass).
+		void* operator new(size_t size);
+		void operator delete(void* p);
+
 		void UsePages(const u32* fb_pages, int fpsm, const u32* zb_pages, int zpsm);
 		void ReleasePages();
 
@@ -80,6 +86,8 @@ protected:
 	std::atomic<u32> m_fzb_pages[512]; // uint16 frame/zbuf pages interleaved
 	std::atomic<u16> m_tex_pages[512];
 	u32 m_tmp_pages[512 + 1];
+	u32 m_skip_dirty_pages[MAX_PAGES / 32]; // pages written during skipped frames
+	bool m_skip_dirty;
 
 	void Reset();
 	void VSync(int field);
@@ -106,6 +106,41 @@ void GSTextureCacheSW::InvalidatePages(const u32* pages, u32 psm)
 	}
 }
 
+// Batched variant of InvalidatePages, taking a bitmap of MAX_PAGES bits
+// accumulated over several transfers. The per-transfer psm was lost when the
+// pages were deferred, so no HasSharedBits filtering is done here; that can
+// only over-invalidate, which is always safe.
+
+void GSTextureCacheSW::InvalidateDirtyPages(const u32* bitmap)
+{
+	for(u32 page = 0; page < MAX_PAGES; page++)
+	{
+		if((bitmap[page >> 5] & (1u << (page & 31))) == 0)
+		{
+			continue;
+		}
+
+		for(Texture* t : m_map[page])
+		{
+			u32* RESTRICT valid = t->m_valid;
+
+			if(t->m_repeating)
+			{
+				for(const GSVector2i& j : t->m_p2t[page])
+				{
+					valid[j.x] &= j.y;
+				}
+			}
+			else
+			{
+				valid[page] = 0;
+			}
+
+			t->m_complete = false;
+		}
+	}
+}
+
 void GSTextureCacheSW::RemoveAll()
 {
 	for(auto i : m_textures) delete i;
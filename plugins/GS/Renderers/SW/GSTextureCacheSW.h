@@ -72,6 +72,7 @@ public:
 	Texture* Lookup(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, u32 tw0 = 0);
 
 	void InvalidatePages(const u32* pages, u32 psm);
+	void InvalidateDirtyPages(const u32* bitmap);
 
 	void RemoveAll();
 	void IncAge();
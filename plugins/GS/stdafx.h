@@ -164,6 +164,19 @@
 
 #endif
 
+// AVX-512 is an add-on to the existing tiers rather than a new _M_SSE level:
+// the scanline code generators top out at AVX2, so this only enables the wider
+// C++ kernels (GSVector16i).
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+	#define GS_AVX512 1
+
+#else
+
+	#define GS_AVX512 0
+
+#endif
+
 #if _M_SSE >= 0x200
 
 	#include <xmmintrin.h>
@@ -250,6 +263,7 @@ extern std::string format(const char* fmt, ...);
 
 extern void* vmalloc(size_t size, bool code);
 extern void vmfree(void* ptr, size_t size);
+extern void vm_hint_hugepages(void* ptr, size_t size);
 
 extern void* fifo_alloc(size_t size, size_t repeat);
 extern void fifo_free(void* ptr, size_t size, size_t repeat);